@@ -12,6 +12,7 @@
 #include <vector>
 
 #include <Common.h>
+#include <FramePipeline.h>
 
 
 struct V3F_T2F
@@ -69,6 +70,46 @@ static void error_callback(int code, const char *msg)
 	printf("glfw error : %s\n", msg);
 }
 
+struct BlobInput
+{
+	double cursorX;
+	double cursorY;
+	double time;
+};
+
+struct BlobState
+{
+	glm::vec4 innerColor;
+	GLfloat radiusInner;
+	GLfloat radiusOuter;
+};
+
+static const char *frameModeNames[] = { "serial", "double buffer", "triple buffer" };
+static FRAME_MODE requestedMode = FRAME_MODE::TRIPLE_BUFFER;
+
+// P cycles the frame pipelining modes
+static void key_callback(GLFWwindow *window, int key, int scancode, int action, int mods)
+{
+	if (key == GLFW_KEY_P && action == GLFW_PRESS)
+		requestedMode = FRAME_MODE((int(requestedMode) + 1) % ARRAY_LENGTH(frameModeNames));
+}
+
+static void simulate_blob(const BlobInput &input, BlobState &state, uint64_t frame)
+{
+	float pulse = float(0.5 + 0.5 * sin(input.time * 2.0));
+	state.radiusInner = 0.15f + 0.1f * pulse;
+	state.radiusOuter = state.radiusInner + 0.2f;
+	state.innerColor = glm::vec4(glm::clamp(float(input.cursorX / 640.0), 0.0f, 1.0f), glm::clamp(float(input.cursorY / 640.0), 0.0f, 1.0f), 0.75f, 1.0f);
+}
+
+static void print_frame_stats(const FramePipeline<BlobInput, BlobState> &pipeline)
+{
+	FrameStats stats = pipeline.stats();
+	printf("%s : %.1f fps, input to present %.2f ms avg %.2f ms max, %llu simulated, %llu presented, %llu repeated, %.1f ms render wait\n",
+		frameModeNames[int(pipeline.mode())], stats.throughput, stats.latencyAverage, stats.latencyMax,
+		(unsigned long long)stats.simulated, (unsigned long long)stats.presented, (unsigned long long)stats.repeated, stats.renderWait);
+}
+
 int main(void)
 {
 	GLFWwindow* window;
@@ -189,6 +230,7 @@ int main(void)
 	glVertexAttribPointer(texCoordLocation, sizeof(V3F_T2F::texCoord) / sizeof(float), GL_FLOAT, GL_FALSE, sizeof(V3F_T2F), (const char *)OFFSET_OF(V3F_T2F, texCoord));
 
 	glBindBuffer(GL_ARRAY_BUFFER, vobBuf[GLsizei(VOB_TYPE::UNIFORM_DATA)]);
+	GLint offset[4];
 	{
 		GLuint blockIndex = glGetUniformBlockIndex(program, "BlobSettings");
 		ASSERT_MSG(blockIndex != GL_INVALID_INDEX, "get index of BlobSettings failed!");
@@ -198,7 +240,6 @@ int main(void)
 		const char *names[] = { "InnerColor", "OuterColor", "RadiusInner", "RadiusOuter" };
 		GLuint indices[ARRAY_LENGTH (names)];
 		glGetUniformIndices(program, ARRAY_LENGTH (names), names, indices);
-		GLint offset[ARRAY_LENGTH (names)];
 		glGetActiveUniformsiv(program, ARRAY_LENGTH (names), indices, GL_UNIFORM_OFFSET, offset);
 		GLfloat outerColor[] = { 0.1f, 0.0f, 0.0f, 1.0f };
 		GLfloat innerColor[] = { 1.0f, 1.0f, 0.75f, 1.0f };
@@ -215,9 +256,24 @@ int main(void)
 	GLushort indices[] = {
 		0, 1, 2, 2, 3, 0
 	};
+	glfwSetKeyCallback(window, key_callback);
+	FramePipeline<BlobInput, BlobState> pipeline(requestedMode, simulate_blob);
+
 	/* Loop until the user closes the window */
 	while (!glfwWindowShouldClose(window))
 	{
+		if (requestedMode != pipeline.mode()) {
+			print_frame_stats(pipeline);
+			pipeline.set_mode(requestedMode);
+		}
+
+		/* Upload the state simulated for this frame */
+		const BlobState &state = pipeline.begin_frame();
+		glBindBuffer(GL_UNIFORM_BUFFER, vobBuf[GLsizei(VOB_TYPE::UNIFORM_DATA)]);
+		glBufferSubData(GL_UNIFORM_BUFFER, offset[0], sizeof(state.innerColor), &state.innerColor);
+		glBufferSubData(GL_UNIFORM_BUFFER, offset[2], sizeof(state.radiusInner), &state.radiusInner);
+		glBufferSubData(GL_UNIFORM_BUFFER, offset[3], sizeof(state.radiusOuter), &state.radiusOuter);
+
 		/* Render here */
 		glClear(GL_COLOR_BUFFER_BIT);
 		glBindVertexArray(vao);
@@ -246,10 +302,16 @@ int main(void)
 		
 		/* Swap front and back buffers */
 		glfwSwapBuffers(window);
+		pipeline.end_frame();
 
 		/* Poll for and process events */
 		glfwPollEvents();
+		BlobInput input;
+		glfwGetCursorPos(window, &input.cursorX, &input.cursorY);
+		input.time = glfwGetTime();
+		pipeline.submit_input(input);
 	}
+	print_frame_stats(pipeline);
 
 	glUseProgram(0);
 	glDeleteProgram(program);
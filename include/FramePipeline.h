@@ -0,0 +1,348 @@
+#ifndef _FRAME_PIPELINE_H_
+#define _FRAME_PIPELINE_H_
+
+// Simulation on its own thread, one frame ahead of the GL thread.
+//
+// The GL thread submits the input after glfwPollEvents, takes the newest simulated state before
+// drawing and ends the frame after glfwSwapBuffers. The simulation thread reads the newest input
+// and writes the whole state of the next frame. States and inputs are exchanged through buffers
+// and atomic indices, neither thread takes a lock.
+//
+// FRAME_MODE::SERIAL       simulates on the GL thread inside begin_frame(), as the samples used to.
+// FRAME_MODE::DOUBLE_BUFFER the GL thread draws frame N from one buffer while frame N+1 is written
+//                          to the other. Every simulated frame is drawn, each thread waits for the other.
+// FRAME_MODE::TRIPLE_BUFFER the GL thread never waits: it draws the newest published frame, or the
+//                          previous one again when the simulation is late. The simulation starts the
+//                          next frame, with fresh input, as soon as the GL thread took the last one.
+//
+// Latency is measured from submit_input() to the end_frame() of the first frame drawn with that input.
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include <Common.h>
+
+enum class FRAME_MODE
+{
+	SERIAL,
+	DOUBLE_BUFFER,
+	TRIPLE_BUFFER
+};
+
+struct FrameStats
+{
+	uint64_t presented;
+	uint64_t simulated;
+	// Frames drawn again because no new state was ready
+	uint64_t repeated;
+	double latencyAverage;
+	double latencyMax;
+	// Presented frames per second
+	double throughput;
+	// Time the GL thread spent waiting for the simulation, in milliseconds
+	double renderWait;
+};
+
+// Latest value wins buffer between one producer and one consumer thread
+template <typename T>
+class FrameMailbox
+{
+public:
+	FrameMailbox() : m_shared(2), m_write(0), m_read(1) {}
+
+	// Producer: buffer to fill, then publish it
+	T &write_buffer() { return m_buffers[m_write]; }
+	void publish() { m_write = m_shared.exchange(m_write | FRESH, std::memory_order_acq_rel) & INDEX; }
+
+	// Consumer: take the newest published buffer, returns false when there is none since the last call
+	bool update()
+	{
+		if ((m_shared.load(std::memory_order_relaxed) & FRESH) == 0)
+			return false;
+		m_read = m_shared.exchange(m_read, std::memory_order_acq_rel) & INDEX;
+		return true;
+	}
+	const T &read_buffer() const { return m_buffers[m_read]; }
+
+	// True while a published buffer wasn't taken
+	bool pending() const { return (m_shared.load(std::memory_order_acquire) & FRESH) != 0; }
+
+private:
+	static const uint32_t INDEX = 3;
+	static const uint32_t FRESH = 4;
+
+	T m_buffers[3];
+	std::atomic<uint32_t> m_shared;
+	uint32_t m_write;
+	uint32_t m_read;
+};
+
+template <typename Input, typename State>
+class FramePipeline
+{
+public:
+	// Write the whole state of a frame from the input
+	typedef std::function<void(const Input &input, State &state, uint64_t frame)> SimulateFunction;
+
+	FramePipeline(FRAME_MODE mode, SimulateFunction simulate);
+	~FramePipeline();
+
+	FRAME_MODE mode() const { return m_mode; }
+
+	// Waits for the simulation thread to finish its frame, then restarts in the new mode
+	void set_mode(FRAME_MODE mode);
+
+	// GL thread
+	void submit_input(const Input &input);
+	const State &begin_frame();
+	void end_frame();
+
+	FrameStats stats() const;
+	void reset_stats();
+
+private:
+	FramePipeline(const FramePipeline &);
+	FramePipeline &operator=(const FramePipeline &);
+
+	typedef std::chrono::steady_clock Clock;
+
+	struct StampedInput
+	{
+		Input input;
+		Clock::time_point time;
+	};
+
+	struct Frame
+	{
+		State state;
+		Clock::time_point inputTime;
+		uint64_t number;
+	};
+
+	void start();
+	void stop();
+	void simulate();
+	double milliseconds(Clock::duration duration) const { return std::chrono::duration<double, std::milli>(duration).count(); }
+
+	FRAME_MODE m_mode;
+	SimulateFunction m_simulate;
+	std::thread m_thread;
+	std::atomic<bool> m_stop;
+
+	FrameMailbox<StampedInput> m_inputs;
+	StampedInput m_input;
+
+	// TRIPLE_BUFFER
+	FrameMailbox<Frame> m_frames;
+
+	// SERIAL uses m_buffers[0], DOUBLE_BUFFER alternates, frame n is in m_buffers[n % 2]
+	Frame m_buffers[2];
+	std::atomic<uint64_t> m_produced;
+	std::atomic<uint64_t> m_released;
+	std::atomic<uint64_t> m_simulated;
+
+	const Frame *m_current;
+	uint64_t m_lastDrawn;
+	// Submit time of the newest input drawn, frames drawn with an older input add no latency sample
+	Clock::time_point m_lastInputDrawn;
+	uint64_t m_nextFrame;
+
+	FrameStats m_stats;
+	Clock::time_point m_statsBegin;
+	double m_latencySum;
+	uint64_t m_latencyCount;
+};
+
+template <typename Input, typename State>
+FramePipeline<Input, State>::FramePipeline(FRAME_MODE mode, SimulateFunction simulate) :
+	m_mode(mode),
+	m_simulate(simulate),
+	m_stop(false),
+	m_produced(0),
+	m_released(0),
+	m_simulated(0),
+	m_current(nullptr),
+	m_lastDrawn(~uint64_t(0)),
+	m_nextFrame(0)
+{
+	m_input.input = Input();
+	m_input.time = Clock::now();
+	m_lastInputDrawn = m_input.time;
+	reset_stats();
+	start();
+}
+
+template <typename Input, typename State>
+FramePipeline<Input, State>::~FramePipeline()
+{
+	stop();
+}
+
+template <typename Input, typename State>
+void FramePipeline<Input, State>::start()
+{
+	m_stop.store(false);
+	m_current = nullptr;
+	m_produced.store(m_nextFrame);
+	m_released.store(m_nextFrame);
+	m_frames.update();
+	if (m_mode != FRAME_MODE::SERIAL)
+		m_thread = std::thread(&FramePipeline::simulate, this);
+}
+
+template <typename Input, typename State>
+void FramePipeline<Input, State>::stop()
+{
+	m_stop.store(true);
+	if (m_thread.joinable())
+		m_thread.join();
+}
+
+template <typename Input, typename State>
+void FramePipeline<Input, State>::set_mode(FRAME_MODE mode)
+{
+	stop();
+	m_mode = mode;
+	reset_stats();
+	start();
+}
+
+template <typename Input, typename State>
+void FramePipeline<Input, State>::submit_input(const Input &input)
+{
+	if (m_mode == FRAME_MODE::SERIAL) {
+		m_input.input = input;
+		m_input.time = Clock::now();
+		return;
+	}
+
+	StampedInput &buffer = m_inputs.write_buffer();
+	buffer.input = input;
+	buffer.time = Clock::now();
+	m_inputs.publish();
+}
+
+// Simulation thread
+template <typename Input, typename State>
+void FramePipeline<Input, State>::simulate()
+{
+	while (!m_stop.load(std::memory_order_relaxed)) {
+		uint64_t number = m_produced.load(std::memory_order_relaxed);
+		Frame *frame = nullptr;
+		if (m_mode == FRAME_MODE::DOUBLE_BUFFER) {
+			// The other buffer is free once the GL thread released the frame before
+			while (number - m_released.load(std::memory_order_acquire) >= 2) {
+				if (m_stop.load(std::memory_order_relaxed))
+					return;
+				std::this_thread::yield();
+			}
+			frame = &m_buffers[number % 2];
+		}
+		else {
+			// Start when the GL thread took the last frame, with the newest input
+			while (m_frames.pending()) {
+				if (m_stop.load(std::memory_order_relaxed))
+					return;
+				std::this_thread::yield();
+			}
+			frame = &m_frames.write_buffer();
+		}
+
+		// The mailbox may still hold an input published before a SERIAL period, older than m_input
+		if (m_inputs.update() && m_inputs.read_buffer().time > m_input.time)
+			m_input = m_inputs.read_buffer();
+		m_simulate(m_input.input, frame->state, number);
+		frame->inputTime = m_input.time;
+		frame->number = number;
+
+		if (m_mode == FRAME_MODE::TRIPLE_BUFFER)
+			m_frames.publish();
+		m_produced.store(number + 1, std::memory_order_release);
+		m_simulated.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+template <typename Input, typename State>
+const State &FramePipeline<Input, State>::begin_frame()
+{
+	Clock::time_point begin = Clock::now();
+	switch (m_mode) {
+	case FRAME_MODE::SERIAL:
+		m_simulate(m_input.input, m_buffers[0].state, m_nextFrame);
+		m_buffers[0].inputTime = m_input.time;
+		m_buffers[0].number = m_nextFrame++;
+		m_simulated.fetch_add(1, std::memory_order_relaxed);
+		m_current = &m_buffers[0];
+		break;
+
+	case FRAME_MODE::DOUBLE_BUFFER:
+		while (m_produced.load(std::memory_order_acquire) == m_released.load(std::memory_order_relaxed))
+			std::this_thread::yield();
+		m_current = &m_buffers[m_released.load(std::memory_order_relaxed) % 2];
+		break;
+
+	case FRAME_MODE::TRIPLE_BUFFER:
+		// Only the first frame waits
+		while (!m_frames.update() && m_current == nullptr)
+			std::this_thread::yield();
+		m_current = &m_frames.read_buffer();
+		break;
+	}
+	m_stats.renderWait += milliseconds(Clock::now() - begin);
+	return m_current->state;
+}
+
+template <typename Input, typename State>
+void FramePipeline<Input, State>::end_frame()
+{
+	ASSERT_MSG(m_current != nullptr, "%s\n", "end_frame() without begin_frame()");
+
+	m_stats.presented++;
+	if (m_current->number == m_lastDrawn)
+		m_stats.repeated++;
+	else if (m_current->inputTime > m_lastInputDrawn) {
+		m_lastInputDrawn = m_current->inputTime;
+		double latency = milliseconds(Clock::now() - m_current->inputTime);
+		m_latencySum += latency;
+		m_latencyCount++;
+		m_stats.latencyMax = latency > m_stats.latencyMax ? latency : m_stats.latencyMax;
+	}
+	m_lastDrawn = m_current->number;
+	m_nextFrame = m_lastDrawn + 1;
+
+	if (m_mode == FRAME_MODE::DOUBLE_BUFFER)
+		m_released.fetch_add(1, std::memory_order_release);
+}
+
+template <typename Input, typename State>
+FrameStats FramePipeline<Input, State>::stats() const
+{
+	FrameStats stats = m_stats;
+	double duration = milliseconds(Clock::now() - m_statsBegin);
+	stats.simulated = m_simulated.load(std::memory_order_relaxed);
+	stats.latencyAverage = m_latencyCount ? m_latencySum / double(m_latencyCount) : 0.0;
+	stats.throughput = duration > 0.0 ? double(m_stats.presented) * 1000.0 / duration : 0.0;
+	return stats;
+}
+
+template <typename Input, typename State>
+void FramePipeline<Input, State>::reset_stats()
+{
+	m_stats.presented = 0;
+	m_stats.simulated = 0;
+	m_stats.repeated = 0;
+	m_stats.latencyAverage = 0.0;
+	m_stats.latencyMax = 0.0;
+	m_stats.throughput = 0.0;
+	m_stats.renderWait = 0.0;
+	m_simulated.store(0, std::memory_order_relaxed);
+	m_latencySum = 0.0;
+	m_latencyCount = 0;
+	m_statsBegin = Clock::now();
+}
+
+#endif // !_FRAME_PIPELINE_H_
@@ -0,0 +1,665 @@
+#ifndef _JOB_SYSTEM_H_
+#define _JOB_SYSTEM_H_
+
+// Work stealing job system for the CPU side of a frame.
+//
+// Every thread, the main thread included, owns a fixed size deque of jobs: it pushes and pops at
+// the bottom, idle threads steal from the top (Chase-Lev, no lock). Jobs signal a JobCounter when
+// they finish and may wait for another counter before starting, which chains them into a graph.
+// Jobs with JOB_AFFINITY::MAIN_THREAD, such as GL calls, only run on the thread that created the
+// JobSystem, inside wait() or run_main_thread_jobs().
+//
+// Jobs are created from the main thread or from other jobs. Each thread allocates them from a pool
+// of JOB_POOL_SIZE jobs, returned by the thread that ran them, and from the heap when it is empty.
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Common.h>
+
+typedef void (*JobFunction)(void *data, uint32_t begin, uint32_t end);
+
+enum class JOB_AFFINITY
+{
+	ANY,
+	MAIN_THREAD
+};
+
+struct Job;
+class JobSystem;
+
+// Number of unfinished jobs signalling the counter, and the jobs waiting for it to reach zero.
+// A counter must outlive its jobs and not be reused before it reached zero.
+class JobCounter
+{
+public:
+	JobCounter() : m_value(0), m_lock(false), m_waiters(nullptr) {}
+
+	bool done() const { return m_value.load(std::memory_order_acquire) == 0; }
+
+private:
+	friend class JobSystem;
+
+	JobCounter(const JobCounter &);
+	JobCounter &operator=(const JobCounter &);
+
+	// Set by the job that brings the counter to zero while it releases the waiters
+	static const uint32_t RELEASING = 0x80000000u;
+
+	std::atomic<uint32_t> m_value;
+	std::atomic<bool> m_lock;
+	Job *m_waiters;
+};
+
+struct Job
+{
+	JobFunction function;
+	void *data;
+	uint32_t begin;
+	uint32_t end;
+	// Ranges larger than grain are split in halves for other threads to steal, 0 never splits
+	uint32_t grain;
+	JobCounter *signal;
+	const char *name;
+	JOB_AFFINITY affinity;
+	// Thread whose pool the job comes from
+	uint32_t owner;
+	Job *next;
+};
+
+// One job run, in microseconds since begin_timeline()
+struct JobTimelineEvent
+{
+	const char *name;
+	double begin;
+	double end;
+};
+
+class JobSystem
+{
+public:
+	static const uint32_t JOB_POOL_SIZE = 4096;
+	static const uint32_t DEQUE_SIZE = 4096;
+
+	// threadCount includes the calling thread, which becomes the main thread. 0 means one per hardware thread.
+	explicit JobSystem(unsigned threadCount = 0);
+	~JobSystem();
+
+	unsigned thread_count() const { return unsigned(m_threads.size()); }
+
+	// Index of the calling thread, 0 for the main thread
+	unsigned thread_index() const;
+
+	// Run function(data, begin, end) once dependency, if any, reaches zero. signal, if any, is
+	// incremented now and decremented when the job returns.
+	void run(JobFunction function, void *data, JobCounter *signal = nullptr, JobCounter *dependency = nullptr,
+		JOB_AFFINITY affinity = JOB_AFFINITY::ANY, const char *name = nullptr);
+
+	// Run function on [0, count) in ranges of at least grain indices, split as threads steal them.
+	void parallel_for(JobFunction function, void *data, uint32_t count, uint32_t grain,
+		JobCounter *signal = nullptr, JobCounter *dependency = nullptr, const char *name = nullptr);
+
+	// Call func(begin, end) on [0, count) in parallel and return when every range is done.
+	template <typename F>
+	void parallel_for(uint32_t count, uint32_t grain, const F &func, const char *name = nullptr)
+	{
+		JobCounter counter;
+		parallel_for(&JobSystem::invoke<F>, const_cast<F *>(&func), count, grain, &counter, nullptr, name);
+		wait(counter);
+	}
+
+	// Run other jobs until counter reaches zero. Main thread jobs only run when called on the main thread.
+	void wait(const JobCounter &counter);
+
+	// Run the pending main thread jobs, for example once per frame in the GLFW loop. Returns how many ran.
+	unsigned run_main_thread_jobs();
+
+	// Record every job run until end_timeline(), when no job is running.
+	void begin_timeline();
+	void end_timeline();
+
+	const std::vector<JobTimelineEvent> &timeline(unsigned thread) const { return m_threads[thread]->events; }
+
+	// Fraction of the recorded time the thread spent running jobs
+	double utilization(unsigned thread) const;
+
+	// Write the recorded jobs in the Chrome trace event format, for chrome://tracing or Perfetto
+	bool export_timeline(const char *path) const;
+
+private:
+	JobSystem(const JobSystem &);
+	JobSystem &operator=(const JobSystem &);
+
+	struct ThreadState
+	{
+		ThreadState();
+
+		// Chase-Lev deque, top and bottom on their own cache lines
+		char padding0[64];
+		std::atomic<int64_t> top;
+		char padding1[64];
+		std::atomic<int64_t> bottom;
+		char padding2[64];
+		std::atomic<Job *> deque[DEQUE_SIZE];
+
+		Job jobs[JOB_POOL_SIZE];
+		Job *freeJobs;
+		// Jobs of the pool freed by other threads
+		std::atomic<Job *> returnedJobs;
+		uint32_t random;
+
+		std::vector<JobTimelineEvent> events;
+		double busy;
+	};
+
+	static const uint32_t HEAP_JOB = 0xFFFFFFFFu;
+
+	template <typename F>
+	static void invoke(void *data, uint32_t begin, uint32_t end)
+	{
+		(*static_cast<const F *>(data))(begin, end);
+	}
+
+	Job *allocate(unsigned thread);
+	void release(unsigned thread, Job *job);
+	void push(unsigned thread, Job *job);
+	Job *pop(unsigned thread);
+	Job *steal(unsigned thread);
+	Job *pop_main_thread_job();
+	Job *find_job(unsigned thread);
+	void submit(unsigned thread, Job *job, JobCounter *dependency);
+	void execute(unsigned thread, Job *job);
+	void finish(unsigned thread, JobCounter *counter);
+	void wake(bool all);
+	void worker(unsigned thread);
+	double now() const;
+
+	std::vector<ThreadState *> m_threads;
+	std::vector<std::thread> m_workers;
+
+	// Main thread jobs pushed by any thread, popped all at once by the main thread
+	std::atomic<Job *> m_mainJobs;
+	Job *m_mainPending;
+
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::atomic<uint64_t> m_epoch;
+	std::atomic<unsigned> m_sleeping;
+	std::atomic<bool> m_stop;
+
+	std::atomic<bool> m_recording;
+	std::chrono::steady_clock::time_point m_timelineBegin;
+	std::chrono::steady_clock::time_point m_timelineEnd;
+};
+
+namespace job_system_detail
+{
+	struct ThreadBinding
+	{
+		const JobSystem *system;
+		unsigned index;
+	};
+
+	inline ThreadBinding &binding()
+	{
+		static thread_local ThreadBinding current = { nullptr, 0 };
+		return current;
+	}
+
+	inline void lock(std::atomic<bool> &flag)
+	{
+		while (flag.exchange(true, std::memory_order_acquire))
+			std::this_thread::yield();
+	}
+
+	inline void unlock(std::atomic<bool> &flag)
+	{
+		flag.store(false, std::memory_order_release);
+	}
+}
+
+inline JobSystem::ThreadState::ThreadState() :
+	top(0),
+	bottom(0),
+	freeJobs(nullptr),
+	returnedJobs(nullptr),
+	random(0),
+	busy(0.0)
+{
+	for (uint32_t i = 0; i < DEQUE_SIZE; i++)
+		deque[i].store(nullptr, std::memory_order_relaxed);
+}
+
+inline JobSystem::JobSystem(unsigned threadCount) :
+	m_mainJobs(nullptr),
+	m_mainPending(nullptr),
+	m_epoch(0),
+	m_sleeping(0),
+	m_stop(false),
+	m_recording(false)
+{
+	if (threadCount == 0)
+		threadCount = std::thread::hardware_concurrency();
+	if (threadCount == 0)
+		threadCount = 1;
+
+	for (unsigned i = 0; i < threadCount; i++) {
+		ThreadState *state = new ThreadState;
+		state->random = 0x9E3779B9u * (i + 1);
+		for (uint32_t j = JOB_POOL_SIZE; j-- > 0;) {
+			state->jobs[j].owner = i;
+			state->jobs[j].next = state->freeJobs;
+			state->freeJobs = &state->jobs[j];
+		}
+		m_threads.push_back(state);
+	}
+
+	job_system_detail::ThreadBinding &main = job_system_detail::binding();
+	ASSERT_MSG(main.system == nullptr, "%s\n", "a thread can only be the main thread of one JobSystem");
+	main.system = this;
+	main.index = 0;
+
+	m_timelineBegin = m_timelineEnd = std::chrono::steady_clock::now();
+	for (unsigned i = 1; i < threadCount; i++)
+		m_workers.push_back(std::thread(&JobSystem::worker, this, i));
+}
+
+inline JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop.store(true);
+	}
+	m_wake.notify_all();
+	for (size_t i = 0; i < m_workers.size(); i++)
+		m_workers[i].join();
+
+	job_system_detail::binding().system = nullptr;
+	for (size_t i = 0; i < m_threads.size(); i++)
+		delete m_threads[i];
+}
+
+inline unsigned JobSystem::thread_index() const
+{
+	const job_system_detail::ThreadBinding &current = job_system_detail::binding();
+	ASSERT_MSG(current.system == this, "%s\n", "jobs are created from the main thread or from jobs");
+	return current.index;
+}
+
+inline double JobSystem::now() const
+{
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_timelineBegin).count();
+}
+
+inline Job *JobSystem::allocate(unsigned thread)
+{
+	ThreadState &state = *m_threads[thread];
+	if (state.freeJobs == nullptr)
+		state.freeJobs = state.returnedJobs.exchange(nullptr, std::memory_order_acquire);
+
+	Job *job = state.freeJobs;
+	if (job == nullptr) {
+		job = new Job;
+		job->owner = HEAP_JOB;
+		return job;
+	}
+	state.freeJobs = job->next;
+	return job;
+}
+
+inline void JobSystem::release(unsigned thread, Job *job)
+{
+	if (job->owner == HEAP_JOB) {
+		delete job;
+		return;
+	}
+
+	ThreadState &state = *m_threads[job->owner];
+	if (job->owner == thread) {
+		job->next = state.freeJobs;
+		state.freeJobs = job;
+		return;
+	}
+
+	Job *head = state.returnedJobs.load(std::memory_order_relaxed);
+	do {
+		job->next = head;
+	} while (!state.returnedJobs.compare_exchange_weak(head, job, std::memory_order_release, std::memory_order_relaxed));
+}
+
+inline void JobSystem::push(unsigned thread, Job *job)
+{
+	if (job->affinity == JOB_AFFINITY::MAIN_THREAD) {
+		Job *head = m_mainJobs.load(std::memory_order_relaxed);
+		do {
+			job->next = head;
+		} while (!m_mainJobs.compare_exchange_weak(head, job, std::memory_order_release, std::memory_order_relaxed));
+		return;
+	}
+
+	ThreadState &state = *m_threads[thread];
+	int64_t b = state.bottom.load(std::memory_order_relaxed);
+	int64_t t = state.top.load(std::memory_order_acquire);
+	if (b - t >= int64_t(DEQUE_SIZE)) {
+		// Full, the job runs now rather than being lost
+		execute(thread, job);
+		return;
+	}
+	state.deque[b & (DEQUE_SIZE - 1)].store(job, std::memory_order_relaxed);
+	state.bottom.store(b + 1, std::memory_order_release);
+	wake(false);
+}
+
+inline Job *JobSystem::pop(unsigned thread)
+{
+	ThreadState &state = *m_threads[thread];
+	int64_t b = state.bottom.load(std::memory_order_relaxed) - 1;
+	// Sequentially consistent, a thief can't read the old bottom after this thread read top
+	state.bottom.store(b, std::memory_order_seq_cst);
+	int64_t t = state.top.load(std::memory_order_seq_cst);
+	if (t > b) {
+		state.bottom.store(b + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	Job *job = state.deque[b & (DEQUE_SIZE - 1)].load(std::memory_order_relaxed);
+	if (t == b) {
+		// Last job, race the thieves for it
+		if (!state.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			job = nullptr;
+		state.bottom.store(b + 1, std::memory_order_relaxed);
+	}
+	return job;
+}
+
+inline Job *JobSystem::steal(unsigned thread)
+{
+	ThreadState &thief = *m_threads[thread];
+	unsigned count = unsigned(m_threads.size());
+
+	// xorshift, so that thieves don't all start with the same victim
+	thief.random ^= thief.random << 13;
+	thief.random ^= thief.random >> 17;
+	thief.random ^= thief.random << 5;
+
+	for (unsigned i = 0, first = thief.random % count; i < count; i++) {
+		unsigned victim = (first + i) % count;
+		if (victim == thread)
+			continue;
+
+		ThreadState &state = *m_threads[victim];
+		int64_t t = state.top.load(std::memory_order_seq_cst);
+		int64_t b = state.bottom.load(std::memory_order_seq_cst);
+		if (t >= b)
+			continue;
+
+		Job *job = state.deque[t & (DEQUE_SIZE - 1)].load(std::memory_order_relaxed);
+		if (state.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return job;
+	}
+	return nullptr;
+}
+
+inline Job *JobSystem::pop_main_thread_job()
+{
+	if (m_mainPending == nullptr) {
+		Job *list = m_mainJobs.exchange(nullptr, std::memory_order_acquire);
+		// Pushed last first, reversed to run them in order
+		while (list) {
+			Job *next = list->next;
+			list->next = m_mainPending;
+			m_mainPending = list;
+			list = next;
+		}
+	}
+
+	Job *job = m_mainPending;
+	if (job)
+		m_mainPending = job->next;
+	return job;
+}
+
+inline Job *JobSystem::find_job(unsigned thread)
+{
+	Job *job = pop(thread);
+	if (job == nullptr && thread == 0)
+		job = pop_main_thread_job();
+	if (job == nullptr && m_threads.size() > 1)
+		job = steal(thread);
+	return job;
+}
+
+inline void JobSystem::wake(bool all)
+{
+	// Workers check the epoch under the mutex before sleeping, no wake up is lost
+	m_epoch.fetch_add(1);
+	if (m_sleeping.load() == 0)
+		return;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (all)
+		m_wake.notify_all();
+	else
+		m_wake.notify_one();
+}
+
+inline void JobSystem::submit(unsigned thread, Job *job, JobCounter *dependency)
+{
+	if (job->signal)
+		job->signal->m_value.fetch_add(1, std::memory_order_relaxed);
+
+	if (dependency) {
+		job_system_detail::lock(dependency->m_lock);
+		uint32_t value = dependency->m_value.load(std::memory_order_acquire);
+		bool wait = value != 0 && (value & JobCounter::RELEASING) == 0;
+		if (wait) {
+			job->next = dependency->m_waiters;
+			dependency->m_waiters = job;
+		}
+		job_system_detail::unlock(dependency->m_lock);
+		if (wait)
+			return;
+	}
+	push(thread, job);
+}
+
+inline void JobSystem::run(JobFunction function, void *data, JobCounter *signal, JobCounter *dependency,
+	JOB_AFFINITY affinity, const char *name)
+{
+	unsigned thread = thread_index();
+	Job *job = allocate(thread);
+	job->function = function;
+	job->data = data;
+	job->begin = 0;
+	job->end = 1;
+	job->grain = 0;
+	job->signal = signal;
+	job->name = name;
+	job->affinity = affinity;
+	job->next = nullptr;
+	submit(thread, job, dependency);
+}
+
+inline void JobSystem::parallel_for(JobFunction function, void *data, uint32_t count, uint32_t grain,
+	JobCounter *signal, JobCounter *dependency, const char *name)
+{
+	if (count == 0)
+		return;
+
+	unsigned thread = thread_index();
+	Job *job = allocate(thread);
+	job->function = function;
+	job->data = data;
+	job->begin = 0;
+	job->end = count;
+	job->grain = grain > 0 ? grain : 1;
+	job->signal = signal;
+	job->name = name;
+	job->affinity = JOB_AFFINITY::ANY;
+	job->next = nullptr;
+	submit(thread, job, dependency);
+}
+
+inline void JobSystem::finish(unsigned thread, JobCounter *counter)
+{
+	// The last job marks the counter as releasing rather than zero, so that wait() doesn't return
+	// and let the counter be destroyed before the waiters are taken
+	uint32_t value = counter->m_value.load(std::memory_order_relaxed);
+	while (!counter->m_value.compare_exchange_weak(value, value == 1 ? JobCounter::RELEASING : value - 1,
+		std::memory_order_acq_rel, std::memory_order_relaxed)) {
+	}
+	if (value != 1)
+		return;
+
+	job_system_detail::lock(counter->m_lock);
+	Job *waiters = counter->m_waiters;
+	counter->m_waiters = nullptr;
+	job_system_detail::unlock(counter->m_lock);
+	// Keeps the jobs added to the counter meanwhile
+	counter->m_value.fetch_and(~JobCounter::RELEASING, std::memory_order_release);
+
+	while (waiters) {
+		Job *next = waiters->next;
+		push(thread, waiters);
+		waiters = next;
+	}
+}
+
+inline void JobSystem::execute(unsigned thread, Job *job)
+{
+	// Leave the upper halves of large ranges to the thieves
+	while (job->grain > 0 && job->end - job->begin > job->grain) {
+		uint32_t chunks = (job->end - job->begin + job->grain - 1) / job->grain;
+		Job *half = allocate(thread);
+		uint32_t owner = half->owner;
+		*half = *job;
+		half->owner = owner;
+		half->begin = job->begin + chunks / 2 * job->grain;
+		job->end = half->begin;
+		if (half->signal)
+			half->signal->m_value.fetch_add(1, std::memory_order_relaxed);
+		push(thread, half);
+	}
+
+	ThreadState &state = *m_threads[thread];
+	if (m_recording.load(std::memory_order_relaxed)) {
+		JobTimelineEvent event;
+		event.name = job->name ? job->name : "job";
+		event.begin = now();
+		job->function(job->data, job->begin, job->end);
+		event.end = now();
+		state.events.push_back(event);
+		state.busy += event.end - event.begin;
+	}
+	else
+		job->function(job->data, job->begin, job->end);
+
+	JobCounter *signal = job->signal;
+	release(thread, job);
+	if (signal)
+		finish(thread, signal);
+}
+
+inline void JobSystem::wait(const JobCounter &counter)
+{
+	unsigned thread = thread_index();
+	while (!counter.done()) {
+		Job *job = find_job(thread);
+		if (job)
+			execute(thread, job);
+		else
+			std::this_thread::yield();
+	}
+}
+
+inline unsigned JobSystem::run_main_thread_jobs()
+{
+	ASSERT_MSG(thread_index() == 0, "%s\n", "main thread jobs run on the main thread");
+	unsigned count = 0;
+	while (Job *job = pop_main_thread_job()) {
+		execute(0, job);
+		count++;
+	}
+	return count;
+}
+
+inline void JobSystem::worker(unsigned thread)
+{
+	job_system_detail::ThreadBinding &current = job_system_detail::binding();
+	current.system = this;
+	current.index = thread;
+
+	unsigned idle = 0;
+	while (!m_stop.load(std::memory_order_relaxed)) {
+		uint64_t epoch = m_epoch.load();
+		Job *job = find_job(thread);
+		if (job) {
+			execute(thread, job);
+			idle = 0;
+			continue;
+		}
+		if (++idle < 64) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_sleeping.fetch_add(1);
+		while (m_epoch.load() == epoch && !m_stop.load())
+			m_wake.wait(lock);
+		m_sleeping.fetch_sub(1);
+		idle = 0;
+	}
+}
+
+inline void JobSystem::begin_timeline()
+{
+	for (size_t i = 0; i < m_threads.size(); i++) {
+		m_threads[i]->events.clear();
+		m_threads[i]->busy = 0.0;
+	}
+	m_timelineBegin = m_timelineEnd = std::chrono::steady_clock::now();
+	m_recording = true;
+}
+
+inline void JobSystem::end_timeline()
+{
+	m_recording = false;
+	m_timelineEnd = std::chrono::steady_clock::now();
+}
+
+inline double JobSystem::utilization(unsigned thread) const
+{
+	double duration = std::chrono::duration<double, std::micro>(m_timelineEnd - m_timelineBegin).count();
+	return duration > 0.0 ? m_threads[thread]->busy / duration : 0.0;
+}
+
+inline bool JobSystem::export_timeline(const char *path) const
+{
+	FILE *file = fopen(path, "w");
+	if (!file)
+		return false;
+
+	fprintf(file, "{\"traceEvents\":[\n");
+	const char *separator = "";
+	for (size_t i = 0; i < m_threads.size(); i++) {
+		fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s %u (%.1f%%)\"}}",
+			separator, unsigned(i), i == 0 ? "main" : "worker", unsigned(i), utilization(unsigned(i)) * 100.0);
+		separator = ",\n";
+		const std::vector<JobTimelineEvent> &events = m_threads[i]->events;
+		for (size_t j = 0; j < events.size(); j++) {
+			fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+				separator, events[j].name, unsigned(i), events[j].begin, events[j].end - events[j].begin);
+		}
+	}
+	fprintf(file, "\n]}\n");
+	return fclose(file) == 0;
+}
+
+#endif // !_JOB_SYSTEM_H_
@@ -0,0 +1,628 @@
+#ifndef _TEXTURE_STREAMER_H_
+#define _TEXTURE_STREAMER_H_
+
+// Asynchronous texture streaming.
+//
+// Textures are read and decoded by JobSystem jobs, coarsest mip level first. The GL thread uploads
+// them in update(), once per frame: rows are copied into a ring of pixel unpack buffers and copied to
+// the texture by glTexSubImage2D from there, each buffer reused once the fence of its last copy
+// signaled. A buffer still in use postpones the uploads to the next frame instead of stalling.
+//
+// Coarse levels of every requested texture are uploaded before finer ones. When a finer level is
+// complete it becomes GL_TEXTURE_BASE_LEVEL, and GL_TEXTURE_MIN_LOD, relative to the base level,
+// fades from 1 to 0 so that the sharper level doesn't pop in.
+// Above the memory budget, the finest levels of the least recently used textures are evicted, and
+// loaded again when these textures are used.
+//
+// Files are uncompressed 32 bit RGBA or BGRA DDS files with their mip levels. Only GL 4.0 functions
+// are used, the streamer runs on Mesa llvmpipe. request(), use(), release() and update() are
+// called on the GL thread, which is the main thread of the JobSystem. A JobSystem without workers
+// reads the files in update().
+
+#include <GL/glew.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <Common.h>
+#include <JobSystem.h>
+
+struct TextureStreamSettings
+{
+	TextureStreamSettings() :
+		bufferSize(4 << 20),
+		bufferCount(4),
+		uploadBytesPerFrame(8 << 20),
+		memoryBudget(256 << 20),
+		lodFadeFrames(8)
+	{}
+
+	// Size of each pixel unpack buffer of the ring, at least one row of the widest level
+	size_t bufferSize;
+	unsigned bufferCount;
+	size_t uploadBytesPerFrame;
+	// Bytes of resident mip levels above which levels are evicted
+	size_t memoryBudget;
+	// Frames for GL_TEXTURE_MIN_LOD to reach a newly uploaded level
+	unsigned lodFadeFrames;
+};
+
+struct TextureStreamStats
+{
+	// Worker threads
+	uint64_t bytesRead;
+	uint64_t failedLoads;
+	double readMilliseconds;
+
+	// GL thread
+	uint64_t bytesUploaded;
+	uint64_t levelsUploaded;
+	uint64_t levelsEvicted;
+	// Frames whose uploads stopped because the next buffer of the ring was still in use
+	uint64_t ringStalls;
+	// Frames whose uploads stopped at uploadBytesPerFrame
+	uint64_t budgetStalls;
+	// Uploads done without the ring because a pixel buffer couldn't be mapped
+	uint64_t mapFailures;
+	// Time spent mapping, copying and issuing the uploads, bytesUploaded over it is the upload bandwidth
+	double uploadMilliseconds;
+	size_t residentBytes;
+};
+
+class TextureStreamer
+{
+public:
+	typedef uint32_t Handle;
+
+	TextureStreamer(JobSystem &jobs, const TextureStreamSettings &settings = TextureStreamSettings());
+	~TextureStreamer();
+
+	// Create the texture and start loading it. Its name is valid immediately, the texture is
+	// incomplete until its coarsest level is uploaded.
+	Handle request(const char *path);
+	void release(Handle handle);
+
+	GLuint texture(Handle handle) const { return m_textures[handle].name; }
+
+	// Mark the texture as used this frame, loading its evicted levels again
+	void use(Handle handle);
+
+	// Finest resident mip level, the level count when none is resident yet
+	uint32_t resident_level(Handle handle) const { return m_textures[handle].baseLevel; }
+	uint32_t level_count(Handle handle) const { return m_textures[handle].levelCount; }
+
+	// Upload the decoded levels, fade the LODs and evict above the budget. Leaves the GL_TEXTURE_2D
+	// binding of the active texture unit and the GL_PIXEL_UNPACK_BUFFER binding to 0.
+	void update();
+
+	// True when no level is being read or waits to be uploaded
+	bool idle() const;
+
+	TextureStreamStats stats() const;
+
+private:
+	TextureStreamer(const TextureStreamer &);
+	TextureStreamer &operator=(const TextureStreamer &);
+
+	static const uint32_t ALL_LEVELS = 0xFFFFFFFFu;
+	static const uint32_t LOAD_FAILED = 0xFFFFFFFFu;
+
+	struct Texture
+	{
+		GLuint name;
+		std::string path;
+		uint32_t width;
+		uint32_t height;
+		uint32_t levelCount;
+		// Finest resident level
+		uint32_t baseLevel;
+		// Finest level resident or being loaded
+		uint32_t loadedLevel;
+		// GL_TEXTURE_MIN_LOD, relative to the base level
+		float minLod;
+		uint64_t lastUsed;
+		bool loading;
+	};
+
+	struct Level
+	{
+		Handle handle;
+		uint32_t level;
+		uint32_t levelCount;
+		uint32_t width;
+		uint32_t height;
+		uint32_t rowsUploaded;
+		std::vector<uint8_t> pixels;
+	};
+
+	struct Load
+	{
+		TextureStreamer *streamer;
+		Handle handle;
+		std::string path;
+		// Coarsest level to read, the finest is 0
+		uint32_t coarsest;
+	};
+
+	struct PixelBuffer
+	{
+		GLuint name;
+		GLsync fence;
+	};
+
+	static void load_job(void *data, uint32_t begin, uint32_t end);
+	void load(const Load &load);
+	void start_load(Handle handle, uint32_t coarsest);
+	bool upload(Level &level, size_t &budget);
+	void complete(Level &level);
+	void evict();
+	static size_t level_bytes(uint32_t width, uint32_t height, uint32_t level);
+
+	JobSystem &m_jobs;
+	TextureStreamSettings m_settings;
+	std::vector<Texture> m_textures;
+	uint64_t m_frame;
+
+	// Levels read by the workers
+	mutable std::mutex m_readyMutex;
+	std::vector<Level *> m_ready;
+	JobCounter m_loads;
+
+	// Levels waiting for upload, the first one may be partly uploaded
+	std::vector<Level *> m_pending;
+
+	std::vector<PixelBuffer> m_buffers;
+	unsigned m_nextBuffer;
+
+	std::atomic<uint64_t> m_bytesRead;
+	std::atomic<uint64_t> m_failedLoads;
+	std::atomic<uint64_t> m_readNanoseconds;
+	TextureStreamStats m_stats;
+};
+
+namespace texture_streamer_detail
+{
+	// DDS_HEADER and DDS_PIXELFORMAT, after the "DDS " magic
+	struct DdsHeader
+	{
+		uint32_t size;
+		uint32_t flags;
+		uint32_t height;
+		uint32_t width;
+		uint32_t pitchOrLinearSize;
+		uint32_t depth;
+		uint32_t mipMapCount;
+		uint32_t reserved1[11];
+		uint32_t pfSize;
+		uint32_t pfFlags;
+		uint32_t pfFourCC;
+		uint32_t pfRGBBitCount;
+		uint32_t pfRBitMask;
+		uint32_t pfGBitMask;
+		uint32_t pfBBitMask;
+		uint32_t pfABitMask;
+		uint32_t caps;
+		uint32_t caps2;
+		uint32_t caps3;
+		uint32_t caps4;
+		uint32_t reserved2;
+	};
+
+	static const uint32_t DDPF_RGB = 0x40;
+
+	// 64 bit offsets, long is 32 bits on Windows
+	inline bool file_seek(FILE *file, uint64_t offset)
+	{
+#ifdef _WIN32
+		return offset <= uint64_t(std::numeric_limits<int64_t>::max()) && _fseeki64(file, int64_t(offset), SEEK_SET) == 0;
+#else
+		return offset <= uint64_t(std::numeric_limits<off_t>::max()) && fseeko(file, off_t(offset), SEEK_SET) == 0;
+#endif
+	}
+
+	inline bool file_size(FILE *file, uint64_t &size)
+	{
+#ifdef _WIN32
+		int64_t end = _fseeki64(file, 0, SEEK_END) == 0 ? _ftelli64(file) : -1;
+#else
+		int64_t end = fseeko(file, 0, SEEK_END) == 0 ? int64_t(ftello(file)) : -1;
+#endif
+		size = end >= 0 ? uint64_t(end) : 0;
+		return end >= 0;
+	}
+}
+
+inline TextureStreamer::TextureStreamer(JobSystem &jobs, const TextureStreamSettings &settings) :
+	m_jobs(jobs),
+	m_settings(settings),
+	m_frame(0),
+	m_nextBuffer(0),
+	m_bytesRead(0),
+	m_failedLoads(0),
+	m_readNanoseconds(0)
+{
+	memset(&m_stats, 0, sizeof(m_stats));
+
+	m_buffers.resize(std::max(m_settings.bufferCount, 1u));
+	for (size_t i = 0; i < m_buffers.size(); i++) {
+		glGenBuffers(1, &m_buffers[i].name);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_buffers[i].name);
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, m_settings.bufferSize, nullptr, GL_STREAM_DRAW);
+		m_buffers[i].fence = nullptr;
+	}
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+inline TextureStreamer::~TextureStreamer()
+{
+	m_jobs.wait(m_loads);
+
+	for (size_t i = 0; i < m_ready.size(); i++)
+		delete m_ready[i];
+	for (size_t i = 0; i < m_pending.size(); i++)
+		delete m_pending[i];
+
+	for (size_t i = 0; i < m_buffers.size(); i++) {
+		if (m_buffers[i].fence)
+			glDeleteSync(m_buffers[i].fence);
+		glDeleteBuffers(1, &m_buffers[i].name);
+	}
+	for (size_t i = 0; i < m_textures.size(); i++)
+		glDeleteTextures(1, &m_textures[i].name);
+}
+
+inline size_t TextureStreamer::level_bytes(uint32_t width, uint32_t height, uint32_t level)
+{
+	return size_t(std::max(width >> level, 1u)) * std::max(height >> level, 1u) * 4;
+}
+
+inline TextureStreamer::Handle TextureStreamer::request(const char *path)
+{
+	Texture texture;
+	glGenTextures(1, &texture.name);
+	texture.path = path;
+	texture.width = 0;
+	texture.height = 0;
+	texture.levelCount = 0;
+	texture.baseLevel = 0;
+	texture.loadedLevel = 0;
+	texture.minLod = 0.0f;
+	texture.lastUsed = m_frame;
+	texture.loading = false;
+
+	glBindTexture(GL_TEXTURE_2D, texture.name);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	Handle handle = Handle(m_textures.size());
+	m_textures.push_back(texture);
+	start_load(handle, ALL_LEVELS);
+	return handle;
+}
+
+inline void TextureStreamer::release(Handle handle)
+{
+	Texture &texture = m_textures[handle];
+	if (texture.name == 0)
+		return;
+
+	// Levels still loading are dropped when they arrive
+	glDeleteTextures(1, &texture.name);
+	texture.name = 0;
+	if (texture.levelCount > 0) {
+		for (uint32_t level = texture.baseLevel; level < texture.levelCount; level++)
+			m_stats.residentBytes -= level_bytes(texture.width, texture.height, level);
+	}
+	texture.baseLevel = texture.levelCount;
+}
+
+inline void TextureStreamer::use(Handle handle)
+{
+	Texture &texture = m_textures[handle];
+	texture.lastUsed = m_frame;
+	if (!texture.loading && texture.name != 0 && texture.loadedLevel > 0)
+		start_load(handle, texture.loadedLevel - 1);
+}
+
+inline void TextureStreamer::start_load(Handle handle, uint32_t coarsest)
+{
+	Texture &texture = m_textures[handle];
+	texture.loading = true;
+	texture.loadedLevel = 0;
+
+	Load *load = new Load;
+	load->streamer = this;
+	load->handle = handle;
+	load->path = texture.path;
+	load->coarsest = coarsest;
+	m_jobs.run(&TextureStreamer::load_job, load, &m_loads, nullptr, JOB_AFFINITY::ANY, "texture load");
+}
+
+inline void TextureStreamer::load_job(void *data, uint32_t, uint32_t)
+{
+	Load *load = static_cast<Load *>(data);
+	load->streamer->load(*load);
+	delete load;
+}
+
+// Worker thread
+inline void TextureStreamer::load(const Load &load)
+{
+	using namespace texture_streamer_detail;
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+	FILE *file = fopen(load.path.c_str(), "rb");
+	char magic[4] = { 0 };
+	DdsHeader header;
+	bool valid = file != nullptr &&
+		fread(magic, sizeof(magic), 1, file) == 1 && memcmp(magic, "DDS ", 4) == 0 &&
+		fread(&header, sizeof(header), 1, file) == 1 &&
+		header.size == sizeof(header) && (header.pfFlags & DDPF_RGB) && header.pfRGBBitCount == 32 &&
+		header.width > 0 && header.height > 0;
+	bool bgra = valid && header.pfRBitMask == 0x00FF0000u;
+	valid = valid && (bgra || header.pfRBitMask == 0x000000FFu);
+
+	// A header larger than the file fails the load instead of allocating the missing pixels
+	uint64_t fileSize = 0;
+	valid = valid && file_size(file, fileSize) && uint64_t(header.width) * header.height <= fileSize / 4;
+
+	// Levels stop at 1x1, which also keeps the shifts of level_bytes below 32
+	uint32_t maxLevelCount = 1;
+	while (maxLevelCount < 32 && (std::max(header.width, header.height) >> maxLevelCount) != 0)
+		maxLevelCount++;
+	uint32_t levelCount = valid ? std::min(std::max(header.mipMapCount, 1u), maxLevelCount) : 0;
+	std::vector<uint64_t> offsets(levelCount);
+	uint64_t offset = 4 + sizeof(header);
+	for (uint32_t level = 0; level < levelCount; level++) {
+		offsets[level] = offset;
+		offset += level_bytes(header.width, header.height, level);
+	}
+	valid = valid && offset <= fileSize;
+
+	uint32_t coarsest = valid ? std::min(load.coarsest, levelCount - 1) : 0;
+	for (uint32_t level = coarsest + 1; valid && level-- > 0;) {
+		Level *result = new Level;
+		result->handle = load.handle;
+		result->level = level;
+		result->levelCount = levelCount;
+		result->width = header.width;
+		result->height = header.height;
+		result->rowsUploaded = 0;
+		result->pixels.resize(level_bytes(header.width, header.height, level));
+
+		valid = file_seek(file, offsets[level]) &&
+			fread(result->pixels.data(), result->pixels.size(), 1, file) == 1;
+		if (!valid) {
+			delete result;
+			break;
+		}
+		if (bgra) {
+			for (size_t i = 0; i < result->pixels.size(); i += 4)
+				std::swap(result->pixels[i], result->pixels[i + 2]);
+		}
+		m_bytesRead.fetch_add(result->pixels.size(), std::memory_order_relaxed);
+
+		std::lock_guard<std::mutex> lock(m_readyMutex);
+		m_ready.push_back(result);
+	}
+
+	if (file)
+		fclose(file);
+
+	if (!valid) {
+		// Tells the GL thread the load ended
+		Level *failure = new Level;
+		failure->handle = load.handle;
+		failure->level = LOAD_FAILED;
+		failure->rowsUploaded = 0;
+		m_failedLoads.fetch_add(1, std::memory_order_relaxed);
+		std::lock_guard<std::mutex> lock(m_readyMutex);
+		m_ready.push_back(failure);
+	}
+
+	m_readNanoseconds.fetch_add(uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - begin).count()), std::memory_order_relaxed);
+}
+
+// Copy rows of the level through the next pixel buffer, returns false when the ring or the budget is exhausted
+inline bool TextureStreamer::upload(Level &level, size_t &budget)
+{
+	Texture &texture = m_textures[level.handle];
+	uint32_t width = std::max(level.width >> level.level, 1u);
+	uint32_t height = std::max(level.height >> level.level, 1u);
+	size_t rowBytes = size_t(width) * 4;
+	ASSERT_MSG(rowBytes <= m_settings.bufferSize, "%s\n", "a row doesn't fit in the pixel buffers");
+
+	PixelBuffer &buffer = m_buffers[m_nextBuffer];
+	if (buffer.fence) {
+		if (glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED) {
+			m_stats.ringStalls++;
+			return false;
+		}
+		glDeleteSync(buffer.fence);
+		buffer.fence = nullptr;
+	}
+
+	uint32_t rows = uint32_t(std::min(std::min(m_settings.bufferSize, budget) / rowBytes, size_t(height - level.rowsUploaded)));
+	if (rows == 0) {
+		m_stats.budgetStalls++;
+		return false;
+	}
+	size_t bytes = rows * rowBytes;
+
+	glBindTexture(GL_TEXTURE_2D, texture.name);
+	if (level.rowsUploaded == 0) {
+		// With a pixel unpack buffer bound, the null pointer would be an offset in it
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glTexImage2D(GL_TEXTURE_2D, GLint(level.level), GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	}
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.name);
+	const uint8_t *pixels = level.pixels.data() + level.rowsUploaded * rowBytes;
+	void *mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes,
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+	bool staged = mapped != nullptr;
+	if (staged) {
+		memcpy(mapped, pixels, bytes);
+		// The buffer content is undefined when unmapping fails
+		staged = glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+	}
+	if (staged)
+		glTexSubImage2D(GL_TEXTURE_2D, GLint(level.level), 0, GLint(level.rowsUploaded), width, rows, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	else {
+		// Synchronous upload from the level instead
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glTexSubImage2D(GL_TEXTURE_2D, GLint(level.level), 0, GLint(level.rowsUploaded), width, rows, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+		m_stats.mapFailures++;
+	}
+	buffer.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	m_nextBuffer = (m_nextBuffer + 1) % m_buffers.size();
+
+	level.rowsUploaded += rows;
+	budget -= bytes;
+	m_stats.bytesUploaded += bytes;
+	return true;
+}
+
+// The level is fully uploaded, make it the base level
+inline void TextureStreamer::complete(Level &level)
+{
+	Texture &texture = m_textures[level.handle];
+	texture.minLod = texture.baseLevel < texture.levelCount ? 1.0f : 0.0f;
+	texture.baseLevel = level.level;
+	if (level.level == 0)
+		texture.loading = false;
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, GLint(level.level));
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_LOD, texture.minLod);
+	m_stats.levelsUploaded++;
+	m_stats.residentBytes += level.pixels.size();
+}
+
+inline void TextureStreamer::update()
+{
+	// Without workers, the loads run here
+	if (m_jobs.thread_count() == 1)
+		m_jobs.wait(m_loads);
+
+	{
+		std::lock_guard<std::mutex> lock(m_readyMutex);
+		m_pending.insert(m_pending.end(), m_ready.begin(), m_ready.end());
+		m_ready.clear();
+	}
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	size_t budget = m_settings.uploadBytesPerFrame;
+	while (!m_pending.empty()) {
+		// Finish the level in progress, otherwise take the coarsest level waiting
+		size_t next = 0;
+		if (m_pending[0]->rowsUploaded == 0) {
+			for (size_t i = 1; i < m_pending.size(); i++) {
+				if (m_pending[i]->level != LOAD_FAILED && m_pending[i]->level > m_pending[next]->level)
+					next = i;
+			}
+		}
+		std::swap(m_pending[0], m_pending[next]);
+
+		Level &level = *m_pending[0];
+		Texture &texture = m_textures[level.handle];
+		bool drop = level.level == LOAD_FAILED || texture.name == 0;
+		if (level.level == LOAD_FAILED || (level.level == 0 && drop))
+			texture.loading = false;
+
+		if (!drop && texture.levelCount == 0) {
+			texture.width = level.width;
+			texture.height = level.height;
+			texture.levelCount = level.levelCount;
+			texture.baseLevel = level.levelCount;
+			glBindTexture(GL_TEXTURE_2D, texture.name);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, GLint(level.levelCount - 1));
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, GLint(level.levelCount - 1));
+		}
+
+		if (!drop) {
+			if (!upload(level, budget))
+				break;
+			if (level.rowsUploaded < std::max(level.height >> level.level, 1u))
+				continue;
+			complete(level);
+		}
+
+		delete m_pending[0];
+		m_pending.erase(m_pending.begin());
+	}
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	m_stats.uploadMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+	// Fade the finer levels in
+	float step = 1.0f / float(std::max(m_settings.lodFadeFrames, 1u));
+	for (size_t i = 0; i < m_textures.size(); i++) {
+		Texture &texture = m_textures[i];
+		if (texture.name == 0 || texture.minLod <= 0.0f)
+			continue;
+		texture.minLod = std::max(texture.minLod - step, 0.0f);
+		glBindTexture(GL_TEXTURE_2D, texture.name);
+		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_LOD, texture.minLod);
+	}
+
+	evict();
+	glBindTexture(GL_TEXTURE_2D, 0);
+	m_frame++;
+}
+
+inline void TextureStreamer::evict()
+{
+	while (m_stats.residentBytes > m_settings.memoryBudget) {
+		// Least recently used texture not used this frame, not loading and with more than its coarsest level
+		Texture *victim = nullptr;
+		for (size_t i = 0; i < m_textures.size(); i++) {
+			Texture &texture = m_textures[i];
+			if (texture.name == 0 || texture.loading || texture.lastUsed == m_frame || texture.baseLevel + 1 >= texture.levelCount)
+				continue;
+			if (victim == nullptr || texture.lastUsed < victim->lastUsed)
+				victim = &texture;
+		}
+		if (victim == nullptr)
+			return;
+
+		uint32_t level = victim->baseLevel;
+		victim->baseLevel = level + 1;
+		victim->loadedLevel = level + 1;
+		victim->minLod = 0.0f;
+		glBindTexture(GL_TEXTURE_2D, victim->name);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, GLint(level + 1));
+		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_LOD, victim->minLod);
+		// Outside of the base and max levels, a 0x0 image frees the level without making the texture incomplete
+		glTexImage2D(GL_TEXTURE_2D, GLint(level), GL_RGBA8, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+		m_stats.residentBytes -= level_bytes(victim->width, victim->height, level);
+		m_stats.levelsEvicted++;
+	}
+}
+
+inline bool TextureStreamer::idle() const
+{
+	std::lock_guard<std::mutex> lock(m_readyMutex);
+	return m_loads.done() && m_ready.empty() && m_pending.empty();
+}
+
+inline TextureStreamStats TextureStreamer::stats() const
+{
+	TextureStreamStats stats = m_stats;
+	stats.bytesRead = m_bytesRead.load(std::memory_order_relaxed);
+	stats.failedLoads = m_failedLoads.load(std::memory_order_relaxed);
+	stats.readMilliseconds = double(m_readNanoseconds.load(std::memory_order_relaxed)) * 1e-6;
+	return stats;
+}
+
+#endif // !_TEXTURE_STREAMER_H_
@@ -0,0 +1,45 @@
+/// @ref core
+/// @file glm/detail/_extern.hpp
+///
+/// Explicit instantiation declarations of the default precision types, enabled by GLM_EXTERN_TEMPLATES.
+/// Their member functions are instantiated once by glm.cpp instead of in each translation unit.
+/// Declaring a class extern template instantiates its definition, so only the types used by
+/// most programs are listed: declaring every type of glm.cpp makes compilation slower.
+
+#pragma once
+
+#include "setup.hpp"
+
+#if defined(GLM_EXTERN_TEMPLATES) && GLM_HAS_EXTERN_TEMPLATE
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_MESSAGE_EXTERN_TEMPLATES_DISPLAYED)
+#	define GLM_MESSAGE_EXTERN_TEMPLATES_DISPLAYED
+#	pragma message("GLM: Default precision types are instantiated by glm.cpp")
+#endif//GLM_MESSAGES
+
+namespace glm
+{
+	extern template struct tvec2<int32, highp>;
+	extern template struct tvec2<uint32, highp>;
+	extern template struct tvec2<float32, highp>;
+	extern template struct tvec2<float64, highp>;
+
+	extern template struct tvec3<int32, highp>;
+	extern template struct tvec3<uint32, highp>;
+	extern template struct tvec3<float32, highp>;
+	extern template struct tvec3<float64, highp>;
+
+	extern template struct tvec4<int32, highp>;
+	extern template struct tvec4<uint32, highp>;
+	extern template struct tvec4<float32, highp>;
+	extern template struct tvec4<float64, highp>;
+
+	extern template struct tmat2x2<float32, highp>;
+	extern template struct tmat2x2<float64, highp>;
+	extern template struct tmat3x3<float32, highp>;
+	extern template struct tmat3x3<float64, highp>;
+	extern template struct tmat4x4<float32, highp>;
+	extern template struct tmat4x4<float64, highp>;
+}//namespace glm
+
+#endif//GLM_EXTERN_TEMPLATES
@@ -186,6 +186,85 @@ namespace detail
 		}
 	};
 
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template <precision P>
+	struct compute_abs_vector<double, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<double, P> call(tvec4<double, P> const & v)
+		{
+			tvec4<double, P> result(uninitialize);
+			result.data = glm_dvec4_abs(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_floor<double, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<double, P> call(tvec4<double, P> const & v)
+		{
+			tvec4<double, P> result(uninitialize);
+			result.data = glm_dvec4_floor(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_min_vector<double, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<double, P> call(tvec4<double, P> const & v1, tvec4<double, P> const & v2)
+		{
+			tvec4<double, P> result(uninitialize);
+			result.data = glm_dvec4_min(v1.data, v2.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_max_vector<double, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<double, P> call(tvec4<double, P> const & v1, tvec4<double, P> const & v2)
+		{
+			tvec4<double, P> result(uninitialize);
+			result.data = glm_dvec4_max(v1.data, v2.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_clamp_vector<double, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<double, P> call(tvec4<double, P> const & x, tvec4<double, P> const & minVal, tvec4<double, P> const & maxVal)
+		{
+			tvec4<double, P> result(uninitialize);
+			result.data = glm_dvec4_clamp(x.data, minVal.data, maxVal.data);
+			return result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	template <precision P>
+	struct compute_mix_vector<float, float, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x, tvec4<float, P> const & y, tvec4<float, P> const & a)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fma(a.data, glm_vec4_sub(y.data, x.data), x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mix_scalar<float, float, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x, tvec4<float, P> const & y, float const & a)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fma(_mm_set1_ps(a), glm_vec4_sub(y.data, x.data), x.data);
+			return Result;
+		}
+	};
+
 	template <precision P>
 	struct compute_mix_vector<float, bool, P, tvec4, true>
 	{
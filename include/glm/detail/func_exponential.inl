@@ -20,6 +20,42 @@ namespace detail
 		}
 #	endif
 
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_pow
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & base, vecType<T, P> const & exponent)
+		{
+			return detail::functor2<T, P, vecType>::call(std::pow, base, exponent);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_exp
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::exp, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_exp2
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::exp, static_cast<T>(0.69314718055994530941723212145818) * x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_log
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::log, x);
+		}
+	};
+
 	template <typename T, precision P, template <class, precision> class vecType, bool isFloat, bool Aligned>
 	struct compute_log2
 	{
@@ -69,7 +105,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> pow(vecType<T, P> const & base, vecType<T, P> const & exponent)
 	{
-		return detail::functor2<T, P, vecType>::call(pow, base, exponent);
+		return detail::compute_pow<vecType, T, P, detail::is_aligned<P>::value>::call(base, exponent);
 	}
 
 	// exp
@@ -77,7 +113,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> exp(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(exp, x);
+		return detail::compute_exp<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// log
@@ -85,7 +121,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> log(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(log, x);
+		return detail::compute_log<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	//exp2, ln2 = 0.69314718055994530941723212145818f
@@ -100,7 +136,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> exp2(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(exp2, x);
+		return detail::compute_exp2<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// log2, ln2 = 0.69314718055994530941723212145818f
@@ -29,6 +29,153 @@ namespace detail
 			return result;
 		}
 	};
+
+	// The polynomial and reciprocal square root estimate kernels are only used below highp, like
+	// glm_vec4_sqrt_lowp. aligned_highp keeps the results of the standard library.
+	template <>
+	struct compute_inversesqrt<tvec4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_mediump> call(tvec4<float, aligned_mediump> const & v)
+		{
+			tvec4<float, aligned_mediump> result(uninitialize);
+			result.data = glm_vec4_inversesqrt(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_pow<tvec4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_mediump> call(tvec4<float, aligned_mediump> const & base, tvec4<float, aligned_mediump> const & exponent)
+		{
+			tvec4<float, aligned_mediump> result(uninitialize);
+			result.data = glm_vec4_pow(base.data, exponent.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_exp<tvec4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_mediump> call(tvec4<float, aligned_mediump> const & v)
+		{
+			tvec4<float, aligned_mediump> result(uninitialize);
+			result.data = glm_vec4_exp(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_exp2<tvec4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_mediump> call(tvec4<float, aligned_mediump> const & v)
+		{
+			tvec4<float, aligned_mediump> result(uninitialize);
+			result.data = glm_vec4_exp2(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_log<tvec4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_mediump> call(tvec4<float, aligned_mediump> const & v)
+		{
+			tvec4<float, aligned_mediump> result(uninitialize);
+			result.data = glm_vec4_log(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_log2<float, aligned_mediump, tvec4, true, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_mediump> call(tvec4<float, aligned_mediump> const & v)
+		{
+			tvec4<float, aligned_mediump> result(uninitialize);
+			result.data = glm_vec4_log2(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_inversesqrt<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_inversesqrt(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_pow<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & base, tvec4<float, aligned_lowp> const & exponent)
+		{
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_pow(base.data, exponent.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_exp<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_exp(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_exp2<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_exp2(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_log<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_log(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_log2<float, aligned_lowp, tvec4, true, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_log2(v.data);
+			return result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template <precision P>
+	struct compute_sqrt<tvec4, double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<double, P> call(tvec4<double, P> const & v)
+		{
+			tvec4<double, P> result(uninitialize);
+			result.data = glm_dvec4_sqrt(v.data);
+			return result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
 }//namespace detail
 }//namespace glm
 
@@ -53,7 +53,7 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_dot<tvec3, T, P, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static T call(tvec3<T, P> const & x, tvec3<T, P> const & y)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static T call(tvec3<T, P> const & x, tvec3<T, P> const & y)
 		{
 			tvec3<T, P> tmp(x * y);
 			return tmp.x + tmp.y + tmp.z;
@@ -63,7 +63,7 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_dot<tvec4, T, P, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static T call(tvec4<T, P> const & x, tvec4<T, P> const & y)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static T call(tvec4<T, P> const & x, tvec4<T, P> const & y)
 		{
 			tvec4<T, P> tmp(x * y);
 			return (tmp.x + tmp.y) + (tmp.z + tmp.w);
@@ -73,7 +73,7 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_cross
 	{
-		GLM_FUNC_QUALIFIER static tvec3<T, P> call(tvec3<T, P> const & x, tvec3<T, P> const & y)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tvec3<T, P> call(tvec3<T, P> const & x, tvec3<T, P> const & y)
 		{
 			GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'cross' accepts only floating-point inputs");
 
@@ -168,7 +168,7 @@ namespace detail
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER T dot(vecType<T, P> const & x, vecType<T, P> const & y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 T dot(vecType<T, P> const & x, vecType<T, P> const & y)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'dot' accepts only floating-point inputs");
 		return detail::compute_dot<vecType, T, P, detail::is_aligned<P>::value>::call(x, y);
@@ -176,7 +176,7 @@ namespace detail
 
 	// cross
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> cross(tvec3<T, P> const & x, tvec3<T, P> const & y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> cross(tvec3<T, P> const & x, tvec3<T, P> const & y)
 	{
 		return detail::compute_cross<T, P, detail::is_aligned<P>::value>::call(x, y);
 	}
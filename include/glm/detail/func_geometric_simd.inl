@@ -35,18 +35,53 @@ namespace detail
 		}
 	};
 
+	template <precision P>
+	struct compute_length<tvec3, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec3<float, P> const & v)
+		{
+			return _mm_cvtss_f32(_mm_sqrt_ss(glm_vec3_dot(v.data, v.data)));
+		}
+	};
+
+	template <precision P>
+	struct compute_distance<tvec3, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec3<float, P> const & p0, tvec3<float, P> const & p1)
+		{
+			__m128 const sub0 = _mm_sub_ps(p0.data, p1.data);
+			return _mm_cvtss_f32(_mm_sqrt_ss(glm_vec3_dot(sub0, sub0)));
+		}
+	};
+
+	template <precision P>
+	struct compute_dot<tvec3, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec3<float, P> const& x, tvec3<float, P> const& y)
+		{
+			return _mm_cvtss_f32(glm_vec3_dot(x.data, y.data));
+		}
+	};
+
 	template <precision P>
 	struct compute_cross<float, P, true>
 	{
 		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b)
 		{
-			__m128 const set0 = _mm_set_ps(0.0f, a.z, a.y, a.x);
-			__m128 const set1 = _mm_set_ps(0.0f, b.z, b.y, b.x);
-			__m128 const xpd0 = glm_vec4_cross(set0, set1);
+			tvec3<float, P> result(uninitialize);
+			result.data = glm_vec4_cross(a.data, b.data);
+			return result;
+		}
+	};
 
-			tvec4<float, P> result(uninitialize);
-			result.data = xpd0;
-			return tvec3<float, P>(result);
+	template <precision P>
+	struct compute_normalize<float, P, tvec3, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tvec3<float, P> const & v)
+		{
+			tvec3<float, P> result(uninitialize);
+			result.data = glm_vec3_normalize(v.data);
+			return result;
 		}
 	};
 
@@ -93,6 +128,47 @@ namespace detail
 			return result;
 		}
 	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template <precision P>
+	struct compute_length<tvec4, double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(tvec4<double, P> const & v)
+		{
+			return std::sqrt(glm_dvec1_dot(v.data, v.data));
+		}
+	};
+
+	template <precision P>
+	struct compute_distance<tvec4, double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(tvec4<double, P> const & p0, tvec4<double, P> const & p1)
+		{
+			glm_dvec4 const sub0 = _mm256_sub_pd(p0.data, p1.data);
+			return std::sqrt(glm_dvec1_dot(sub0, sub0));
+		}
+	};
+
+	template <precision P>
+	struct compute_dot<tvec4, double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(tvec4<double, P> const& x, tvec4<double, P> const& y)
+		{
+			return glm_dvec1_dot(x.data, y.data);
+		}
+	};
+
+	template <precision P>
+	struct compute_normalize<double, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<double, P> call(tvec4<double, P> const & v)
+		{
+			tvec4<double, P> result(uninitialize);
+			result.data = glm_dvec4_normalize(v.data);
+			return result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
 }//namespace detail
 }//namespace glm
 
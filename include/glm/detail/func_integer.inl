@@ -27,7 +27,8 @@ namespace detail
 	template <typename T>
 	GLM_FUNC_QUALIFIER T mask(T Bits)
 	{
-		return Bits >= sizeof(T) * 8 ? ~static_cast<T>(0) : (static_cast<T>(1) << Bits) - static_cast<T>(1);
+		typedef typename make_unsigned<T>::type U;
+		return Bits >= static_cast<T>(sizeof(T) * 8) ? ~static_cast<T>(0) : static_cast<T>((static_cast<U>(1) << Bits) - static_cast<U>(1));
 	}
 
 	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, bool Aligned, bool EXEC>
@@ -102,8 +103,35 @@ namespace detail
 			}
 		};
 #		endif
+#	elif GLM_HAS_BITSCAN_BUILTIN
+		template <typename genIUType>
+		struct compute_findLSB<genIUType, 32>
+		{
+			GLM_FUNC_QUALIFIER static int call(genIUType Value)
+			{
+				return Value == 0 ? -1 : __builtin_ctz(static_cast<uint32>(Value));
+			}
+		};
+
+		template <typename genIUType>
+		struct compute_findLSB<genIUType, 64>
+		{
+			GLM_FUNC_QUALIFIER static int call(genIUType Value)
+			{
+				return Value == 0 ? -1 : __builtin_ctzll(static_cast<uint64>(Value));
+			}
+		};
 #	endif//GLM_HAS_BITSCAN_WINDOWS
 
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_findLSB_vec
+	{
+		GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<int, T, P, vecType>::call(compute_findLSB<T, sizeof(T) * 8>::call, x);
+		}
+	};
+
 	template <typename T, glm::precision P, template <class, glm::precision> class vecType, bool EXEC = true>
 	struct compute_findMSB_step_vec
 	{
@@ -122,7 +150,7 @@ namespace detail
 		}
 	};
 
-	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, int>
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, int, bool Aligned>
 	struct compute_findMSB_vec
 	{
 		GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & vec)
@@ -147,8 +175,8 @@ namespace detail
 			return IsNotNull ? int(Result) : -1;
 		}
 
-		template <typename T, glm::precision P, template<typename, glm::precision> class vecType>
-		struct compute_findMSB_vec<T, P, vecType, 32>
+		template <typename T, glm::precision P, template<typename, glm::precision> class vecType, bool Aligned>
+		struct compute_findMSB_vec<T, P, vecType, 32, Aligned>
 		{
 			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
 			{
@@ -165,8 +193,8 @@ namespace detail
 			return IsNotNull ? int(Result) : -1;
 		}
 
-		template <typename T, glm::precision P, template <class, glm::precision> class vecType>
-		struct compute_findMSB_vec<T, P, vecType, 64>
+		template <typename T, glm::precision P, template <class, glm::precision> class vecType, bool Aligned>
+		struct compute_findMSB_vec<T, P, vecType, 64, Aligned>
 		{
 			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
 			{
@@ -174,7 +202,141 @@ namespace detail
 			}
 		};
 #		endif
+#	elif GLM_HAS_BITSCAN_BUILTIN
+		template <typename genIUType>
+		GLM_FUNC_QUALIFIER int compute_findMSB_32(genIUType Value)
+		{
+			return Value == 0 ? -1 : 31 - __builtin_clz(static_cast<uint32>(Value));
+		}
+
+		template <typename T, glm::precision P, template<typename, glm::precision> class vecType, bool Aligned>
+		struct compute_findMSB_vec<T, P, vecType, 32, Aligned>
+		{
+			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
+			{
+				return detail::functor1<int, T, P, vecType>::call(compute_findMSB_32, x);
+			}
+		};
+
+		template <typename genIUType>
+		GLM_FUNC_QUALIFIER int compute_findMSB_64(genIUType Value)
+		{
+			return Value == 0 ? -1 : 63 - __builtin_clzll(static_cast<uint64>(Value));
+		}
+
+		template <typename T, glm::precision P, template <class, glm::precision> class vecType, bool Aligned>
+		struct compute_findMSB_vec<T, P, vecType, 64, Aligned>
+		{
+			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
+			{
+				return detail::functor1<int, T, P, vecType>::call(compute_findMSB_64, x);
+			}
+		};
 #	endif//GLM_HAS_BITSCAN_WINDOWS
+
+	template <glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_uaddCarry
+	{
+		GLM_FUNC_QUALIFIER static vecType<uint, P> call(vecType<uint, P> const & x, vecType<uint, P> const & y, vecType<uint, P> & Carry)
+		{
+			vecType<uint64, P> Value64(vecType<uint64, P>(x) + vecType<uint64, P>(y));
+			vecType<uint64, P> Max32((static_cast<uint64>(1) << static_cast<uint64>(32)) - static_cast<uint64>(1));
+			Carry = mix(vecType<uint32, P>(0), vecType<uint32, P>(1), greaterThan(Value64, Max32));
+			return vecType<uint32,P>(Value64 % (Max32 + static_cast<uint64>(1)));
+		}
+	};
+
+	template <glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_usubBorrow
+	{
+		GLM_FUNC_QUALIFIER static vecType<uint, P> call(vecType<uint, P> const & x, vecType<uint, P> const & y, vecType<uint, P> & Borrow)
+		{
+			Borrow = mix(vecType<uint, P>(1), vecType<uint, P>(0), greaterThanEqual(x, y));
+			vecType<uint, P> const YgeX(y - x);
+			vecType<uint, P> const XgeY(vecType<uint32, P>((static_cast<int64>(1) << static_cast<int64>(32)) + (vecType<int64, P>(y) - vecType<int64, P>(x))));
+			return mix(XgeY, YgeX, greaterThanEqual(y, x));
+		}
+	};
+
+	template <glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_umulExtended
+	{
+		GLM_FUNC_QUALIFIER static void call(vecType<uint, P> const & x, vecType<uint, P> const & y, vecType<uint, P> & msb, vecType<uint, P> & lsb)
+		{
+			vecType<uint64, P> Value64(vecType<uint64, P>(x) * vecType<uint64, P>(y));
+			msb = vecType<uint32, P>(Value64 >> static_cast<uint64>(32));
+			lsb = vecType<uint32, P>(Value64);
+		}
+	};
+
+	template <glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_imulExtended
+	{
+		GLM_FUNC_QUALIFIER static void call(vecType<int, P> const & x, vecType<int, P> const & y, vecType<int, P> & msb, vecType<int, P> & lsb)
+		{
+			vecType<int64, P> Value64(vecType<int64, P>(x) * vecType<int64, P>(y));
+			lsb = vecType<int32, P>(Value64 & static_cast<int64>(0xFFFFFFFF));
+			msb = vecType<int32, P>((Value64 >> static_cast<int64>(32)) & static_cast<int64>(0xFFFFFFFF));
+		}
+	};
+
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_bitfieldExtract
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & Value, int Offset, int Bits)
+		{
+			typedef typename make_unsigned<T>::type U;
+			int const Width = static_cast<int>(sizeof(T) * 8);
+
+			// Offset may be the bit width when Bits is 0
+			if(Bits == 0)
+				return vecType<T, P>(static_cast<T>(0));
+
+			// Shifting the field to the top then back down sign extends signed types
+			vecType<T, P> const Top(vecType<U, P>(Value) << static_cast<U>(Width - Offset - Bits));
+			return Top >> static_cast<T>(Width - Bits);
+		}
+	};
+
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_bitfieldInsert
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & Base, vecType<T, P> const & Insert, int Offset, int Bits)
+		{
+			typedef typename make_unsigned<T>::type U;
+
+			// Offset may be the bit width when Bits is 0
+			if(Bits == 0)
+				return Base;
+
+			T const Mask = static_cast<T>(static_cast<U>(detail::mask(Bits)) << Offset);
+			vecType<T, P> const Shifted(vecType<U, P>(Insert) << static_cast<U>(Offset));
+			return (Base & ~Mask) | (Shifted & Mask);
+		}
+	};
+
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_bitCount
+	{
+		GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & v)
+		{
+		#if GLM_COMPILER & GLM_COMPILER_VC
+		#pragma warning(push)
+		#pragma warning(disable : 4310) //cast truncates constant value
+		#endif
+			vecType<typename make_unsigned<T>::type, P> x(*reinterpret_cast<vecType<typename make_unsigned<T>::type, P> const *>(&v));
+			x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, is_aligned<P>::value, sizeof(T) * 8>=  2>::call(x, typename make_unsigned<T>::type(0x5555555555555555ull), typename make_unsigned<T>::type( 1));
+			x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, is_aligned<P>::value, sizeof(T) * 8>=  4>::call(x, typename make_unsigned<T>::type(0x3333333333333333ull), typename make_unsigned<T>::type( 2));
+			x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, is_aligned<P>::value, sizeof(T) * 8>=  8>::call(x, typename make_unsigned<T>::type(0x0F0F0F0F0F0F0F0Full), typename make_unsigned<T>::type( 4));
+			x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, is_aligned<P>::value, sizeof(T) * 8>= 16>::call(x, typename make_unsigned<T>::type(0x00FF00FF00FF00FFull), typename make_unsigned<T>::type( 8));
+			x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, is_aligned<P>::value, sizeof(T) * 8>= 32>::call(x, typename make_unsigned<T>::type(0x0000FFFF0000FFFFull), typename make_unsigned<T>::type(16));
+			x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, is_aligned<P>::value, sizeof(T) * 8>= 64>::call(x, typename make_unsigned<T>::type(0x00000000FFFFFFFFull), typename make_unsigned<T>::type(32));
+			return vecType<int, P>(x);
+		#if GLM_COMPILER & GLM_COMPILER_VC
+		#pragma warning(pop)
+		#endif
+		}
+	};
 }//namespace detail
 
 	// uaddCarry
@@ -189,10 +351,7 @@ namespace detail
 	template <precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<uint, P> uaddCarry(vecType<uint, P> const & x, vecType<uint, P> const & y, vecType<uint, P> & Carry)
 	{
-		vecType<uint64, P> Value64(vecType<uint64, P>(x) + vecType<uint64, P>(y));
-		vecType<uint64, P> Max32((static_cast<uint64>(1) << static_cast<uint64>(32)) - static_cast<uint64>(1));
-		Carry = mix(vecType<uint32, P>(0), vecType<uint32, P>(1), greaterThan(Value64, Max32));
-		return vecType<uint32,P>(Value64 % (Max32 + static_cast<uint64>(1)));
+		return detail::compute_uaddCarry<P, vecType, detail::is_aligned<P>::value>::call(x, y, Carry);
 	}
 
 	// usubBorrow
@@ -210,10 +369,7 @@ namespace detail
 	template <precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<uint, P> usubBorrow(vecType<uint, P> const & x, vecType<uint, P> const & y, vecType<uint, P> & Borrow)
 	{
-		Borrow = mix(vecType<uint, P>(1), vecType<uint, P>(0), greaterThanEqual(x, y));
-		vecType<uint, P> const YgeX(y - x);
-		vecType<uint, P> const XgeY(vecType<uint32, P>((static_cast<int64>(1) << static_cast<int64>(32)) + (vecType<int64, P>(y) - vecType<int64, P>(x))));
-		return mix(XgeY, YgeX, greaterThanEqual(y, x));
+		return detail::compute_usubBorrow<P, vecType, detail::is_aligned<P>::value>::call(x, y, Borrow);
 	}
 
 	// umulExtended
@@ -231,9 +387,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(sizeof(uint) == sizeof(uint32), "uint and uint32 size mismatch");
 
-		vecType<uint64, P> Value64(vecType<uint64, P>(x) * vecType<uint64, P>(y));
-		msb = vecType<uint32, P>(Value64 >> static_cast<uint64>(32));
-		lsb = vecType<uint32, P>(Value64);
+		detail::compute_umulExtended<P, vecType, detail::is_aligned<P>::value>::call(x, y, msb, lsb);
 	}
 
 	// imulExtended
@@ -251,9 +405,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(sizeof(int) == sizeof(int32), "int and int32 size mismatch");
 
-		vecType<int64, P> Value64(vecType<int64, P>(x) * vecType<int64, P>(y));
-		lsb = vecType<int32, P>(Value64 & static_cast<int64>(0xFFFFFFFF));
-		msb = vecType<int32, P>((Value64 >> static_cast<int64>(32)) & static_cast<int64>(0xFFFFFFFF));
+		detail::compute_imulExtended<P, vecType, detail::is_aligned<P>::value>::call(x, y, msb, lsb);
 	}
 
 	// bitfieldExtract
@@ -268,7 +420,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'bitfieldExtract' only accept integer inputs");
 
-		return (Value >> static_cast<T>(Offset)) & static_cast<T>(detail::mask(Bits));
+		return detail::compute_bitfieldExtract<T, P, vecType, detail::is_aligned<P>::value>::call(Value, Offset, Bits);
 	}
 
 	// bitfieldInsert
@@ -283,8 +435,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'bitfieldInsert' only accept integer values");
 
-		T const Mask = static_cast<T>(detail::mask(Bits) << Offset);
-		return (Base & ~Mask) | (Insert & Mask);
+		return detail::compute_bitfieldInsert<T, P, vecType, detail::is_aligned<P>::value>::call(Base, Insert, Offset, Bits);
 	}
 
 	// bitfieldReverse
@@ -317,21 +468,7 @@ namespace detail
 	template <typename T, glm::precision P, template <typename, glm::precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<int, P> bitCount(vecType<T, P> const & v)
 	{
-	#if GLM_COMPILER & GLM_COMPILER_VC
-	#pragma warning(push)
-	#pragma warning(disable : 4310) //cast truncates constant value
-	#endif
-		vecType<typename detail::make_unsigned<T>::type, P> x(*reinterpret_cast<vecType<typename detail::make_unsigned<T>::type, P> const *>(&v));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>=  2>::call(x, typename detail::make_unsigned<T>::type(0x5555555555555555ull), typename detail::make_unsigned<T>::type( 1));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>=  4>::call(x, typename detail::make_unsigned<T>::type(0x3333333333333333ull), typename detail::make_unsigned<T>::type( 2));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>=  8>::call(x, typename detail::make_unsigned<T>::type(0x0F0F0F0F0F0F0F0Full), typename detail::make_unsigned<T>::type( 4));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>= 16>::call(x, typename detail::make_unsigned<T>::type(0x00FF00FF00FF00FFull), typename detail::make_unsigned<T>::type( 8));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>= 32>::call(x, typename detail::make_unsigned<T>::type(0x0000FFFF0000FFFFull), typename detail::make_unsigned<T>::type(16));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>= 64>::call(x, typename detail::make_unsigned<T>::type(0x00000000FFFFFFFFull), typename detail::make_unsigned<T>::type(32));
-		return vecType<int, P>(x);
-	#if GLM_COMPILER & GLM_COMPILER_VC
-	#pragma warning(pop)
-	#endif
+		return detail::compute_bitCount<T, P, vecType, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// findLSB
@@ -348,7 +485,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'findLSB' only accept integer values");
 
-		return detail::functor1<int, T, P, vecType>::call(findLSB, x);
+		return detail::compute_findLSB_vec<T, P, vecType, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// findMSB
@@ -365,7 +502,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'findMSB' only accept integer values");
 
-		return detail::compute_findMSB_vec<T, P, vecType, sizeof(T) * 8>::call(x);
+		return detail::compute_findMSB_vec<T, P, vecType, sizeof(T) * 8, detail::is_aligned<P>::value>::call(x);
 	}
 }//namespace glm
 
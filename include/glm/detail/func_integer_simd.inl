@@ -15,17 +15,16 @@ namespace detail
 		{
 			__m128i const set0 = v.data;
 
-			__m128i const set1 = _mm_set1_epi32(Mask);
+			__m128i const set1 = _mm_set1_epi32(static_cast<int>(Mask));
 			__m128i const and1 = _mm_and_si128(set0, set1);
-			__m128i const sft1 = _mm_slli_epi32(and1, Shift);
+			__m128i const sft1 = _mm_slli_epi32(and1, static_cast<int>(Shift));
 
-			__m128i const set2 = _mm_andnot_si128(set0, _mm_set1_epi32(-1));
-			__m128i const and2 = _mm_and_si128(set0, set2);
-			__m128i const sft2 = _mm_srai_epi32(and2, Shift);
-		
-			__m128i const or0 = _mm_or_si128(sft1, sft2);
-		
-			return or0;
+			__m128i const and2 = _mm_andnot_si128(set1, set0);
+			__m128i const sft2 = _mm_srli_epi32(and2, static_cast<int>(Shift));
+
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = _mm_or_si128(sft1, sft2);
+			return Result;
 		}
 	};
 
@@ -36,13 +35,182 @@ namespace detail
 		{
 			__m128i const set0 = v.data;
 
-			__m128i const set1 = _mm_set1_epi32(Mask);
+			__m128i const set1 = _mm_set1_epi32(static_cast<int>(Mask));
 			__m128i const and0 = _mm_and_si128(set0, set1);
-			__m128i const sft0 = _mm_slli_epi32(set0, Shift);
+			__m128i const sft0 = _mm_srli_epi32(set0, static_cast<int>(Shift));
 			__m128i const and1 = _mm_and_si128(sft0, set1);
-			__m128i const add0 = _mm_add_epi32(and0, and1);
-		
-			return add0;
+
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = _mm_add_epi32(and0, and1);
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSSE3_BIT
+	template <glm::precision P>
+	struct compute_bitCount<int, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int, P> const & v)
+		{
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_bitCount(v.data);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_bitCount<uint, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<uint, P> const & v)
+		{
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_bitCount(v.data);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSSE3_BIT
+
+	template <glm::precision P>
+	struct compute_findLSB_vec<int, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int, P> const & x)
+		{
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_findLSB(x.data);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_findLSB_vec<uint, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<uint, P> const & x)
+		{
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_findLSB(x.data);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_findMSB_vec<int, P, tvec4, 32, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int, P> const & x)
+		{
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_findMSB(x.data);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_findMSB_vec<uint, P, tvec4, 32, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<uint, P> const & x)
+		{
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_findMSB(x.data);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_uaddCarry<P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<uint, P> call(tvec4<uint, P> const & x, tvec4<uint, P> const & y, tvec4<uint, P> & Carry)
+		{
+			tvec4<uint, P> Result(uninitialize);
+			Result.data = glm_uvec4_uaddCarry(x.data, y.data, Carry.data);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_usubBorrow<P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<uint, P> call(tvec4<uint, P> const & x, tvec4<uint, P> const & y, tvec4<uint, P> & Borrow)
+		{
+			tvec4<uint, P> Result(uninitialize);
+			Result.data = glm_uvec4_usubBorrow(x.data, y.data, Borrow.data);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_umulExtended<P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec4<uint, P> const & x, tvec4<uint, P> const & y, tvec4<uint, P> & msb, tvec4<uint, P> & lsb)
+		{
+			glm_uvec4_umulExtended(x.data, y.data, msb.data, lsb.data);
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_imulExtended<P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec4<int, P> const & x, tvec4<int, P> const & y, tvec4<int, P> & msb, tvec4<int, P> & lsb)
+		{
+			glm_ivec4_imulExtended(x.data, y.data, msb.data, lsb.data);
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_bitfieldExtract<int, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int, P> const & Value, int Offset, int Bits)
+		{
+			// An arithmetic shift by 32 would fill the result with the sign
+			if(Bits == 0)
+				return tvec4<int, P>(0);
+
+			__m128i const sft0 = _mm_slli_epi32(Value.data, 32 - Offset - Bits);
+
+			tvec4<int, P> Result(uninitialize);
+			Result.data = _mm_srai_epi32(sft0, 32 - Bits);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_bitfieldExtract<uint, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<uint, P> call(tvec4<uint, P> const & Value, int Offset, int Bits)
+		{
+			__m128i const sft0 = _mm_srli_epi32(Value.data, Offset);
+
+			tvec4<uint, P> Result(uninitialize);
+			Result.data = _mm_and_si128(sft0, _mm_set1_epi32(detail::mask(Bits)));
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_bitfieldInsert<int, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int, P> const & Base, tvec4<int, P> const & Insert, int Offset, int Bits)
+		{
+			// Bits [Offset, Offset + Bits), without shifting by 32 when Bits is 0
+			uint const Bitfield = detail::mask(static_cast<uint>(Offset + Bits)) ^ detail::mask(static_cast<uint>(Offset));
+			__m128i const Mask = _mm_set1_epi32(static_cast<int>(Bitfield));
+
+			tvec4<int, P> Result(uninitialize);
+			Result.data = _mm_or_si128(_mm_andnot_si128(Mask, Base.data), _mm_and_si128(_mm_slli_epi32(Insert.data, Offset), Mask));
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_bitfieldInsert<uint, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<uint, P> call(tvec4<uint, P> const & Base, tvec4<uint, P> const & Insert, int Offset, int Bits)
+		{
+			// Bits [Offset, Offset + Bits), without shifting by 32 when Bits is 0
+			uint const Bitfield = detail::mask(static_cast<uint>(Offset + Bits)) ^ detail::mask(static_cast<uint>(Offset));
+			__m128i const Mask = _mm_set1_epi32(static_cast<int>(Bitfield));
+
+			tvec4<uint, P> Result(uninitialize);
+			Result.data = _mm_or_si128(_mm_andnot_si128(Mask, Base.data), _mm_and_si128(_mm_slli_epi32(Insert.data, Offset), Mask));
+			return Result;
 		}
 	};
 }//namespace detail
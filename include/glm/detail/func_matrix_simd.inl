@@ -3,6 +3,8 @@
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+#include "type_mat2x2.hpp"
+#include "type_mat3x3.hpp"
 #include "type_mat4x4.hpp"
 #include "func_geometric.hpp"
 #include "../simd/matrix.h"
@@ -58,6 +60,70 @@ namespace detail
 			return Result;
 		}
 	};
+
+	template <precision P>
+	struct compute_transpose<tmat3x3, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat3x3<float, P> call(tmat3x3<float, P> const & m)
+		{
+			tmat3x3<float, P> result(uninitialize);
+			glm_mat3_transpose(
+				*reinterpret_cast<glm_vec4 const(*)[3]>(&m[0].data),
+				*reinterpret_cast<glm_vec4(*)[3]>(&result[0].data));
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_determinant<tmat3x3, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tmat3x3<float, P> const& m)
+		{
+			return _mm_cvtss_f32(glm_mat3_determinant(*reinterpret_cast<glm_vec4 const(*)[3]>(&m[0].data)));
+		}
+	};
+
+	template <precision P>
+	struct compute_inverse<tmat3x3, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat3x3<float, P> call(tmat3x3<float, P> const& m)
+		{
+			tmat3x3<float, P> Result(uninitialize);
+			glm_mat3_inverse(*reinterpret_cast<glm_vec4 const(*)[3]>(&m[0].data), *reinterpret_cast<glm_vec4(*)[3]>(&Result[0].data));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_transpose<tmat2x2, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat2x2<float, P> call(tmat2x2<float, P> const & m)
+		{
+			tmat2x2<float, P> result(uninitialize);
+			_mm_storeu_ps(&result[0][0], glm_mat2_transpose(_mm_loadu_ps(&m[0][0])));
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_determinant<tmat2x2, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tmat2x2<float, P> const& m)
+		{
+			return _mm_cvtss_f32(glm_mat2_determinant(_mm_loadu_ps(&m[0][0])));
+		}
+	};
+
+	template <precision P>
+	struct compute_inverse<tmat2x2, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat2x2<float, P> call(tmat2x2<float, P> const& m)
+		{
+			tmat2x2<float, P> Result(uninitialize);
+			_mm_storeu_ps(&Result[0][0], glm_mat2_inverse(_mm_loadu_ps(&m[0][0])));
+			return Result;
+		}
+	};
 }//namespace detail
 
 	template<>
@@ -83,6 +83,8 @@
 #	define GLM_MESSAGE_ARCH_DISPLAYED
 #	if(GLM_ARCH == GLM_ARCH_PURE)
 #		pragma message("GLM: Platform independent code")
+#	elif(GLM_ARCH == GLM_ARCH_AVX512)
+#		pragma message("GLM: AVX512 instruction set")
 #	elif(GLM_ARCH == GLM_ARCH_AVX2)
 #		pragma message("GLM: AVX2 instruction set")
 #	elif(GLM_ARCH == GLM_ARCH_AVX)
@@ -108,6 +110,10 @@
 #	elif(GLM_ARCH == GLM_ARCH_PPC)
 #		pragma message("GLM: PowerPC architechture")
 #	endif//GLM_ARCH
+
+#	if GLM_HAS_FMA
+#		pragma message("GLM: FMA3 instruction set")
+#	endif//GLM_HAS_FMA
 #endif//GLM_MESSAGES
 
 ///////////////////////////////////////////////////////////////////////////////////
@@ -342,6 +348,27 @@
 #	define GLM_HAS_CONSTEXPR_PARTIAL (GLM_HAS_CONSTEXPR || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC14)))
 #endif
 
+// N3652
+#if GLM_COMPILER & GLM_COMPILER_CLANG
+#	define GLM_HAS_CONSTEXPR_CXX14 __has_feature(cxx_relaxed_constexpr)
+#elif GLM_LANG & GLM_LANG_CXX14_FLAG
+#	define GLM_HAS_CONSTEXPR_CXX14 (GLM_HAS_CONSTEXPR && (!(GLM_COMPILER & GLM_COMPILER_VC) || (GLM_COMPILER >= GLM_COMPILER_VC15)))
+#else
+#	define GLM_HAS_CONSTEXPR_CXX14 0
+#endif
+
+// P0595, the builtin is also available in C++14 mode
+#if defined(__has_builtin)
+#	if __has_builtin(__builtin_is_constant_evaluated)
+#		define GLM_HAS_IS_CONSTANT_EVALUATED GLM_HAS_CONSTEXPR_CXX14
+#	endif
+#endif
+#ifndef GLM_HAS_IS_CONSTANT_EVALUATED
+#	define GLM_HAS_IS_CONSTANT_EVALUATED (GLM_HAS_CONSTEXPR_CXX14 && (\
+		((GLM_COMPILER & GLM_COMPILER_GCC) && (__GNUC__ >= 9)) || \
+		((GLM_COMPILER & GLM_COMPILER_VC) && (_MSC_VER >= 1925))))
+#endif
+
 // N2672
 #if GLM_COMPILER & GLM_COMPILER_CLANG
 #	define GLM_HAS_INITIALIZER_LISTS __has_feature(cxx_generalized_initializers)
@@ -381,6 +408,18 @@
 		(GLM_COMPILER & GLM_COMPILER_CUDA)))
 #endif
 
+// N1987 http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2006/n1987.htm
+#if GLM_COMPILER & GLM_COMPILER_CLANG
+#	define GLM_HAS_EXTERN_TEMPLATE (GLM_LANG & GLM_LANG_CXX0X_FLAG)
+#elif GLM_LANG & GLM_LANG_CXX11_FLAG
+#	define GLM_HAS_EXTERN_TEMPLATE 1
+#else
+#	define GLM_HAS_EXTERN_TEMPLATE (\
+		((GLM_LANG & GLM_LANG_CXX0X_FLAG) && (GLM_COMPILER & GLM_COMPILER_GCC)) || \
+		((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC10)) || \
+		((GLM_LANG & GLM_LANG_CXX0X_FLAG) && (GLM_COMPILER & GLM_COMPILER_INTEL)))
+#endif
+
 // N2118
 #if GLM_COMPILER & GLM_COMPILER_CLANG
 #	define GLM_HAS_RVALUE_REFERENCES __has_feature(cxx_rvalue_references)
@@ -474,6 +513,15 @@
 		((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC14) && (GLM_ARCH & GLM_ARCH_X86_BIT))))
 #endif
 
+// __builtin_clz and __builtin_ctz compile to lzcnt and tzcnt when the target has them, bsr and bsf otherwise
+#if GLM_ARCH == GLM_ARCH_PURE
+#	define GLM_HAS_BITSCAN_BUILTIN 0
+#else
+#	define GLM_HAS_BITSCAN_BUILTIN (!GLM_HAS_BITSCAN_WINDOWS && (GLM_ARCH & GLM_ARCH_X86_BIT) && (\
+		((GLM_COMPILER & GLM_COMPILER_GCC)) || \
+		((GLM_COMPILER & GLM_COMPILER_CLANG))))
+#endif
+
 // OpenMP
 #ifdef _OPENMP
 #	if GLM_COMPILER & GLM_COMPILER_GCC
@@ -727,6 +775,12 @@
 #	define GLM_RELAXED_CONSTEXPR const
 #endif
 
+#if GLM_HAS_CONSTEXPR_CXX14
+#	define GLM_CONSTEXPR_CXX14 constexpr
+#else
+#	define GLM_CONSTEXPR_CXX14
+#endif
+
 #if GLM_ARCH == GLM_ARCH_PURE
 #	define GLM_CONSTEXPR_SIMD GLM_CONSTEXPR_CTOR
 #else
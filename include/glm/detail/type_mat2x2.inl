@@ -3,6 +3,24 @@
 
 #include "func_matrix.hpp"
 
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P, bool Aligned>
+	struct compute_mat2_mul
+	{
+		GLM_FUNC_QUALIFIER static tmat2x2<T, P> call(tmat2x2<T, P> const & m1, tmat2x2<T, P> const & m2)
+		{
+			return tmat2x2<T, P>(
+				m1[0][0] * m2[0][0] + m1[1][0] * m2[0][1],
+				m1[0][1] * m2[0][0] + m1[1][1] * m2[0][1],
+				m1[0][0] * m2[1][0] + m1[1][0] * m2[1][1],
+				m1[0][1] * m2[1][0] + m1[1][1] * m2[1][1]);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
 namespace glm
 {
 	// -- Constructors --
@@ -31,8 +49,8 @@ namespace glm
 	template <precision Q>
 	GLM_FUNC_QUALIFIER tmat2x2<T, P>::tmat2x2(tmat2x2<T, Q> const & m)
 	{
-		this->value[0] = m.value[0];
-		this->value[1] = m.value[1];
+		this->value[0] = col_type(m[0]);
+		this->value[1] = col_type(m[1]);
 	}
 
 	template <typename T, precision P>
@@ -400,11 +418,7 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat2x2<T, P> operator*(tmat2x2<T, P> const & m1, tmat2x2<T, P> const & m2)
 	{
-		return tmat2x2<T, P>(
-			m1[0][0] * m2[0][0] + m1[1][0] * m2[0][1],
-			m1[0][1] * m2[0][0] + m1[1][1] * m2[0][1],
-			m1[0][0] * m2[1][0] + m1[1][0] * m2[1][1],
-			m1[0][1] * m2[1][0] + m1[1][1] * m2[1][1]);
+		return detail::compute_mat2_mul<T, P, detail::is_aligned<P>::value>::call(m1, m2);
 	}
 
 	template <typename T, precision P>
@@ -482,3 +496,7 @@ namespace glm
 		return (m1[0] != m2[0]) || (m1[1] != m2[1]);
 	}
 } //namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_ALIGNED_TYPE
+#	include "type_mat2x2_simd.inl"
+#endif
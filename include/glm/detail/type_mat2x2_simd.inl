@@ -0,0 +1,25 @@
+/// @ref core
+/// @file glm/detail/type_mat2x2_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	// tvec2 isn't padded, the four components of a tmat2x2 are loaded with a single unaligned load
+	template <precision P>
+	struct compute_mat2_mul<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat2x2<float, P> call(tmat2x2<float, P> const & m1, tmat2x2<float, P> const & m2)
+		{
+			tmat2x2<float, P> Result(uninitialize);
+			_mm_storeu_ps(&Result[0][0], glm_mat2_mul(_mm_loadu_ps(&m1[0][0]), _mm_loadu_ps(&m2[0][0])));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
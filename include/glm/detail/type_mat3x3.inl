@@ -3,6 +3,62 @@
 
 #include "func_matrix.hpp"
 
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P, bool Aligned>
+	struct compute_mat3_mul_vec3
+	{
+		GLM_FUNC_QUALIFIER static typename tmat3x3<T, P>::col_type call(tmat3x3<T, P> const & m, typename tmat3x3<T, P>::row_type const & v)
+		{
+			return typename tmat3x3<T, P>::col_type(
+				m[0][0] * v.x + m[1][0] * v.y + m[2][0] * v.z,
+				m[0][1] * v.x + m[1][1] * v.y + m[2][1] * v.z,
+				m[0][2] * v.x + m[1][2] * v.y + m[2][2] * v.z);
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_mat3_mul
+	{
+		GLM_FUNC_QUALIFIER static tmat3x3<T, P> call(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2)
+		{
+			T const SrcA00 = m1[0][0];
+			T const SrcA01 = m1[0][1];
+			T const SrcA02 = m1[0][2];
+			T const SrcA10 = m1[1][0];
+			T const SrcA11 = m1[1][1];
+			T const SrcA12 = m1[1][2];
+			T const SrcA20 = m1[2][0];
+			T const SrcA21 = m1[2][1];
+			T const SrcA22 = m1[2][2];
+
+			T const SrcB00 = m2[0][0];
+			T const SrcB01 = m2[0][1];
+			T const SrcB02 = m2[0][2];
+			T const SrcB10 = m2[1][0];
+			T const SrcB11 = m2[1][1];
+			T const SrcB12 = m2[1][2];
+			T const SrcB20 = m2[2][0];
+			T const SrcB21 = m2[2][1];
+			T const SrcB22 = m2[2][2];
+
+			tmat3x3<T, P> Result(uninitialize);
+			Result[0][0] = SrcA00 * SrcB00 + SrcA10 * SrcB01 + SrcA20 * SrcB02;
+			Result[0][1] = SrcA01 * SrcB00 + SrcA11 * SrcB01 + SrcA21 * SrcB02;
+			Result[0][2] = SrcA02 * SrcB00 + SrcA12 * SrcB01 + SrcA22 * SrcB02;
+			Result[1][0] = SrcA00 * SrcB10 + SrcA10 * SrcB11 + SrcA20 * SrcB12;
+			Result[1][1] = SrcA01 * SrcB10 + SrcA11 * SrcB11 + SrcA21 * SrcB12;
+			Result[1][2] = SrcA02 * SrcB10 + SrcA12 * SrcB11 + SrcA22 * SrcB12;
+			Result[2][0] = SrcA00 * SrcB20 + SrcA10 * SrcB21 + SrcA20 * SrcB22;
+			Result[2][1] = SrcA01 * SrcB20 + SrcA11 * SrcB21 + SrcA21 * SrcB22;
+			Result[2][2] = SrcA02 * SrcB20 + SrcA12 * SrcB21 + SrcA22 * SrcB22;
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
 namespace glm
 {
 	// -- Constructors --
@@ -33,9 +89,9 @@ namespace glm
 	template <precision Q>
 	GLM_FUNC_QUALIFIER tmat3x3<T, P>::tmat3x3(tmat3x3<T, Q> const & m)
 	{
-		this->value[0] = m.value[0];
-		this->value[1] = m.value[1];
-		this->value[2] = m.value[2];
+		this->value[0] = col_type(m[0]);
+		this->value[1] = col_type(m[1]);
+		this->value[2] = col_type(m[2]);
 	}
 
 	template <typename T, precision P>
@@ -427,10 +483,7 @@ namespace glm
 	template <typename T, precision P> 
 	GLM_FUNC_QUALIFIER typename tmat3x3<T, P>::col_type operator*(tmat3x3<T, P> const & m, typename tmat3x3<T, P>::row_type const & v)
 	{
-		return typename tmat3x3<T, P>::col_type(
-			m[0][0] * v.x + m[1][0] * v.y + m[2][0] * v.z,
-			m[0][1] * v.x + m[1][1] * v.y + m[2][1] * v.z,
-			m[0][2] * v.x + m[1][2] * v.y + m[2][2] * v.z);
+		return detail::compute_mat3_mul_vec3<T, P, detail::is_aligned<P>::value>::call(m, v);
 	}
 
 	template <typename T, precision P> 
@@ -445,37 +498,7 @@ namespace glm
 	template <typename T, precision P> 
 	GLM_FUNC_QUALIFIER tmat3x3<T, P> operator*(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2)
 	{
-		T const SrcA00 = m1[0][0];
-		T const SrcA01 = m1[0][1];
-		T const SrcA02 = m1[0][2];
-		T const SrcA10 = m1[1][0];
-		T const SrcA11 = m1[1][1];
-		T const SrcA12 = m1[1][2];
-		T const SrcA20 = m1[2][0];
-		T const SrcA21 = m1[2][1];
-		T const SrcA22 = m1[2][2];
-
-		T const SrcB00 = m2[0][0];
-		T const SrcB01 = m2[0][1];
-		T const SrcB02 = m2[0][2];
-		T const SrcB10 = m2[1][0];
-		T const SrcB11 = m2[1][1];
-		T const SrcB12 = m2[1][2];
-		T const SrcB20 = m2[2][0];
-		T const SrcB21 = m2[2][1];
-		T const SrcB22 = m2[2][2];
-
-		tmat3x3<T, P> Result(uninitialize);
-		Result[0][0] = SrcA00 * SrcB00 + SrcA10 * SrcB01 + SrcA20 * SrcB02;
-		Result[0][1] = SrcA01 * SrcB00 + SrcA11 * SrcB01 + SrcA21 * SrcB02;
-		Result[0][2] = SrcA02 * SrcB00 + SrcA12 * SrcB01 + SrcA22 * SrcB02;
-		Result[1][0] = SrcA00 * SrcB10 + SrcA10 * SrcB11 + SrcA20 * SrcB12;
-		Result[1][1] = SrcA01 * SrcB10 + SrcA11 * SrcB11 + SrcA21 * SrcB12;
-		Result[1][2] = SrcA02 * SrcB10 + SrcA12 * SrcB11 + SrcA22 * SrcB12;
-		Result[2][0] = SrcA00 * SrcB20 + SrcA10 * SrcB21 + SrcA20 * SrcB22;
-		Result[2][1] = SrcA01 * SrcB20 + SrcA11 * SrcB21 + SrcA21 * SrcB22;
-		Result[2][2] = SrcA02 * SrcB20 + SrcA12 * SrcB21 + SrcA22 * SrcB22;
-		return Result;
+		return detail::compute_mat3_mul<T, P, detail::is_aligned<P>::value>::call(m1, m2);
 	}
 
 	template <typename T, precision P>
@@ -559,3 +582,7 @@ namespace glm
 		return (m1[0] != m2[0]) || (m1[1] != m2[1]) || (m1[2] != m2[2]);
 	}
 } //namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_ALIGNED_TYPE
+#	include "type_mat3x3_simd.inl"
+#endif
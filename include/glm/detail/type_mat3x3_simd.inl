@@ -0,0 +1,38 @@
+/// @ref core
+/// @file glm/detail/type_mat3x3_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	template <precision P>
+	struct compute_mat3_mul_vec3<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tmat3x3<float, P> const & m, tvec3<float, P> const & v)
+		{
+			tvec3<float, P> Result(uninitialize);
+			Result.data = glm_mat3_mul_vec3(*reinterpret_cast<glm_vec4 const(*)[3]>(&m[0].data), v.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat3_mul<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat3x3<float, P> call(tmat3x3<float, P> const & m1, tmat3x3<float, P> const & m2)
+		{
+			tmat3x3<float, P> Result(uninitialize);
+			glm_mat3_mul(
+				*reinterpret_cast<glm_vec4 const(*)[3]>(&m1[0].data),
+				*reinterpret_cast<glm_vec4 const(*)[3]>(&m2[0].data),
+				*reinterpret_cast<glm_vec4(*)[3]>(&Result[0].data));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
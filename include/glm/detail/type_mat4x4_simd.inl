@@ -1,7 +1,38 @@
 /// @ref core
 /// @file glm/detail/type_mat4x4_sse2.inl
 
-namespace glm
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
 {
+	template <precision P>
+	struct compute_mat4_mul_vec4<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tmat4x4<float, P> const & m, tvec4<float, P> const & v)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_mat4_mul_vec4(*reinterpret_cast<glm_vec4 const(*)[4]>(&m[0].data), v.data);
+			return Result;
+		}
+	};
 
+	template <precision P>
+	struct compute_mat4_mul<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m1, tmat4x4<float, P> const & m2)
+		{
+			tmat4x4<float, P> Result(uninitialize);
+			glm_mat4_mul(
+				*reinterpret_cast<glm_vec4 const(*)[4]>(&m1[0].data),
+				*reinterpret_cast<glm_vec4 const(*)[4]>(&m2[0].data),
+				*reinterpret_cast<glm_vec4(*)[4]>(&Result[0].data));
+			return Result;
+		}
+	};
+}//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -1,8 +1,45 @@
 /// @ref core
 /// @file glm/detail/type_tvec3.inl
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template <typename T, precision P, bool Aligned>
+	struct compute_vec3_add
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tvec3<T, P> call(tvec3<T, P> const & a, tvec3<T, P> const & b)
+		{
+			return tvec3<T, P>(a.x + b.x, a.y + b.y, a.z + b.z);
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_vec3_sub
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tvec3<T, P> call(tvec3<T, P> const & a, tvec3<T, P> const & b)
+		{
+			return tvec3<T, P>(a.x - b.x, a.y - b.y, a.z - b.z);
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_vec3_mul
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tvec3<T, P> call(tvec3<T, P> const & a, tvec3<T, P> const & b)
+		{
+			return tvec3<T, P>(a.x * b.x, a.y * b.y, a.z * b.z);
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_vec3_div
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tvec3<T, P> call(tvec3<T, P> const & a, tvec3<T, P> const & b)
+		{
+			return tvec3<T, P>(a.x / b.x, a.y / b.y, a.z / b.z);
+		}
+	};
+}//namespace detail
 
 #	ifdef GLM_STATIC_CONST_MEMBERS
 	template <typename T, precision P>
@@ -140,17 +177,35 @@ namespace glm
 	// -- Component accesses --
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER T & tvec3<T, P>::operator[](typename tvec3<T, P>::length_type i)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 T & tvec3<T, P>::operator[](typename tvec3<T, P>::length_type i)
 	{
 		assert(i >= 0 && i < this->length());
-		return (&x)[i];
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		case 2:
+			return z;
+		}
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER T const & tvec3<T, P>::operator[](typename tvec3<T, P>::length_type i) const
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 T const & tvec3<T, P>::operator[](typename tvec3<T, P>::length_type i) const
 	{
 		assert(i >= 0 && i < this->length());
-		return (&x)[i];
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		case 2:
+			return z;
+		}
 	}
 
 	// -- Unary arithmetic operators --
@@ -178,122 +233,86 @@ namespace glm
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator+=(U scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator+=(U scalar)
 	{
-		this->x += static_cast<T>(scalar);
-		this->y += static_cast<T>(scalar);
-		this->z += static_cast<T>(scalar);
-		return *this;
+		return (*this = detail::compute_vec3_add<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(static_cast<T>(scalar))));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator+=(tvec1<U, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator+=(tvec1<U, P> const & v)
 	{
-		this->x += static_cast<T>(v.x);
-		this->y += static_cast<T>(v.x);
-		this->z += static_cast<T>(v.x);
-		return *this;
+		return (*this = detail::compute_vec3_add<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(static_cast<T>(v.x))));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator+=(tvec3<U, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator+=(tvec3<U, P> const & v)
 	{
-		this->x += static_cast<T>(v.x);
-		this->y += static_cast<T>(v.y);
-		this->z += static_cast<T>(v.z);
-		return *this;
+		return (*this = detail::compute_vec3_add<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(v)));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator-=(U scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator-=(U scalar)
 	{
-		this->x -= static_cast<T>(scalar);
-		this->y -= static_cast<T>(scalar);
-		this->z -= static_cast<T>(scalar);
-		return *this;
+		return (*this = detail::compute_vec3_sub<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(static_cast<T>(scalar))));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator-=(tvec1<U, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator-=(tvec1<U, P> const & v)
 	{
-		this->x -= static_cast<T>(v.x);
-		this->y -= static_cast<T>(v.x);
-		this->z -= static_cast<T>(v.x);
-		return *this;
+		return (*this = detail::compute_vec3_sub<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(static_cast<T>(v.x))));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator-=(tvec3<U, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator-=(tvec3<U, P> const & v)
 	{
-		this->x -= static_cast<T>(v.x);
-		this->y -= static_cast<T>(v.y);
-		this->z -= static_cast<T>(v.z);
-		return *this;
+		return (*this = detail::compute_vec3_sub<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(v)));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator*=(U scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator*=(U scalar)
 	{
-		this->x *= static_cast<T>(scalar);
-		this->y *= static_cast<T>(scalar);
-		this->z *= static_cast<T>(scalar);
-		return *this;
+		return (*this = detail::compute_vec3_mul<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(static_cast<T>(scalar))));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator*=(tvec1<U, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator*=(tvec1<U, P> const & v)
 	{
-		this->x *= static_cast<T>(v.x);
-		this->y *= static_cast<T>(v.x);
-		this->z *= static_cast<T>(v.x);
-		return *this;
+		return (*this = detail::compute_vec3_mul<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(static_cast<T>(v.x))));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator*=(tvec3<U, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator*=(tvec3<U, P> const & v)
 	{
-		this->x *= static_cast<T>(v.x);
-		this->y *= static_cast<T>(v.y);
-		this->z *= static_cast<T>(v.z);
-		return *this;
+		return (*this = detail::compute_vec3_mul<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(v)));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator/=(U v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator/=(U v)
 	{
-		this->x /= static_cast<T>(v);
-		this->y /= static_cast<T>(v);
-		this->z /= static_cast<T>(v);
-		return *this;
+		return (*this = detail::compute_vec3_div<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(static_cast<T>(v))));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator/=(tvec1<U, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator/=(tvec1<U, P> const & v)
 	{
-		this->x /= static_cast<T>(v.x);
-		this->y /= static_cast<T>(v.x);
-		this->z /= static_cast<T>(v.x);
-		return *this;
+		return (*this = detail::compute_vec3_div<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(static_cast<T>(v.x))));
 	}
 
 	template <typename T, precision P>
 	template <typename U>
-	GLM_FUNC_QUALIFIER tvec3<T, P> & tvec3<T, P>::operator/=(tvec3<U, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> & tvec3<T, P>::operator/=(tvec3<U, P> const & v)
 	{
-		this->x /= static_cast<T>(v.x);
-		this->y /= static_cast<T>(v.y);
-		this->z /= static_cast<T>(v.z);
-		return *this;
+		return (*this = detail::compute_vec3_div<T, P, detail::is_aligned<P>::value>::call(*this, tvec3<T, P>(v)));
 	}
 
 	// -- Increment and decrement operators --
@@ -517,13 +536,13 @@ namespace glm
 	// -- Unary arithmetic operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator+(tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator+(tvec3<T, P> const & v)
 	{
 		return v;
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator-(tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator-(tvec3<T, P> const & v)
 	{
 		return tvec3<T, P>(
 			-v.x, 
@@ -534,16 +553,13 @@ namespace glm
 	// -- Binary arithmetic operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator+(tvec3<T, P> const & v, T scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator+(tvec3<T, P> const & v, T scalar)
 	{
-		return tvec3<T, P>(
-			v.x + scalar,
-			v.y + scalar,
-			v.z + scalar);
+		return detail::compute_vec3_add<T, P, detail::is_aligned<P>::value>::call(v, tvec3<T, P>(scalar));
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator+(tvec3<T, P> const & v, tvec1<T, P> const & scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator+(tvec3<T, P> const & v, tvec1<T, P> const & scalar)
 	{
 		return tvec3<T, P>(
 			v.x + scalar.x,
@@ -552,16 +568,13 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator+(T scalar, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator+(T scalar, tvec3<T, P> const & v)
 	{
-		return tvec3<T, P>(
-			scalar + v.x,
-			scalar + v.y,
-			scalar + v.z);
+		return detail::compute_vec3_add<T, P, detail::is_aligned<P>::value>::call(tvec3<T, P>(scalar), v);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator+(tvec1<T, P> const & scalar, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator+(tvec1<T, P> const & scalar, tvec3<T, P> const & v)
 	{
 		return tvec3<T, P>(
 			scalar.x + v.x,
@@ -570,25 +583,19 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator+(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator+(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
 	{
-		return tvec3<T, P>(
-			v1.x + v2.x,
-			v1.y + v2.y,
-			v1.z + v2.z);
+		return detail::compute_vec3_add<T, P, detail::is_aligned<P>::value>::call(v1, v2);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator-(tvec3<T, P> const & v, T scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator-(tvec3<T, P> const & v, T scalar)
 	{
-		return tvec3<T, P>(
-			v.x - scalar,
-			v.y - scalar,
-			v.z - scalar);
+		return detail::compute_vec3_sub<T, P, detail::is_aligned<P>::value>::call(v, tvec3<T, P>(scalar));
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator-(tvec3<T, P> const & v, tvec1<T, P> const & scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator-(tvec3<T, P> const & v, tvec1<T, P> const & scalar)
 	{
 		return tvec3<T, P>(
 			v.x - scalar.x,
@@ -597,16 +604,13 @@ namespace glm
 	}
 
 	template <typename T, precision P> 
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator-(T scalar, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator-(T scalar, tvec3<T, P> const & v)
 	{
-		return tvec3<T, P>(
-			scalar - v.x,
-			scalar - v.y,
-			scalar - v.z);
+		return detail::compute_vec3_sub<T, P, detail::is_aligned<P>::value>::call(tvec3<T, P>(scalar), v);
 	}
 
 	template <typename T, precision P> 
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator-(tvec1<T, P> const & scalar, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator-(tvec1<T, P> const & scalar, tvec3<T, P> const & v)
 	{
 		return tvec3<T, P>(
 			scalar.x - v.x,
@@ -615,25 +619,19 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator-(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator-(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
 	{
-		return tvec3<T, P>(
-			v1.x - v2.x,
-			v1.y - v2.y,
-			v1.z - v2.z);
+		return detail::compute_vec3_sub<T, P, detail::is_aligned<P>::value>::call(v1, v2);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator*(tvec3<T, P> const & v, T scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tvec3<T, P> const & v, T scalar)
 	{
-		return tvec3<T, P>(
-			v.x * scalar,
-			v.y * scalar,
-			v.z * scalar);
+		return detail::compute_vec3_mul<T, P, detail::is_aligned<P>::value>::call(v, tvec3<T, P>(scalar));
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator*(tvec3<T, P> const & v, tvec1<T, P> const & scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tvec3<T, P> const & v, tvec1<T, P> const & scalar)
 	{
 		return tvec3<T, P>(
 			v.x * scalar.x,
@@ -642,16 +640,13 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator*(T scalar, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(T scalar, tvec3<T, P> const & v)
 	{
-		return tvec3<T, P>(
-			scalar * v.x,
-			scalar * v.y,
-			scalar * v.z);
+		return detail::compute_vec3_mul<T, P, detail::is_aligned<P>::value>::call(tvec3<T, P>(scalar), v);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator*(tvec1<T, P> const & scalar, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tvec1<T, P> const & scalar, tvec3<T, P> const & v)
 	{
 		return tvec3<T, P>(
 			scalar.x * v.x,
@@ -660,25 +655,19 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator*(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
 	{
-		return tvec3<T, P>(
-			v1.x * v2.x,
-			v1.y * v2.y,
-			v1.z * v2.z);
+		return detail::compute_vec3_mul<T, P, detail::is_aligned<P>::value>::call(v1, v2);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator/(tvec3<T, P> const & v, T scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator/(tvec3<T, P> const & v, T scalar)
 	{
-		return tvec3<T, P>(
-			v.x / scalar,
-			v.y / scalar,
-			v.z / scalar);
+		return detail::compute_vec3_div<T, P, detail::is_aligned<P>::value>::call(v, tvec3<T, P>(scalar));
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator/(tvec3<T, P> const & v, tvec1<T, P> const & scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator/(tvec3<T, P> const & v, tvec1<T, P> const & scalar)
 	{
 		return tvec3<T, P>(
 			v.x / scalar.x,
@@ -687,16 +676,13 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator/(T scalar, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator/(T scalar, tvec3<T, P> const & v)
 	{
-		return tvec3<T, P>(
-			scalar / v.x,
-			scalar / v.y,
-			scalar / v.z);
+		return detail::compute_vec3_div<T, P, detail::is_aligned<P>::value>::call(tvec3<T, P>(scalar), v);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator/(tvec1<T, P> const & scalar, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator/(tvec1<T, P> const & scalar, tvec3<T, P> const & v)
 	{
 		return tvec3<T, P>(
 			scalar.x / v.x,
@@ -705,12 +691,9 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> operator/(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> operator/(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
 	{
-		return tvec3<T, P>(
-			v1.x / v2.x,
-			v1.y / v2.y,
-			v1.z / v2.z);
+		return detail::compute_vec3_div<T, P, detail::is_aligned<P>::value>::call(v1, v2);
 	}
 
 	// -- Binary bit operators --
@@ -997,13 +980,13 @@ namespace glm
 	// -- Boolean operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER bool operator==(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 bool operator==(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
 	{
 		return (v1.x == v2.x) && (v1.y == v2.y) && (v1.z == v2.z);
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER bool operator!=(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 bool operator!=(tvec3<T, P> const & v1, tvec3<T, P> const & v2)
 	{
 		return (v1.x != v2.x) || (v1.y != v2.y) || (v1.z != v2.z);
 	}
@@ -1020,3 +1003,7 @@ namespace glm
 		return tvec3<bool, P>(v1.x || v2.x, v1.y || v2.y, v1.z || v2.z);
 	}
 }//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_ALIGNED_TYPE
+#	include "type_vec3_simd.inl"
+#endif
@@ -0,0 +1,95 @@
+/// @ref core
+/// @file glm/detail/type_tvec3_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_SWIZZLE == GLM_SWIZZLE_ENABLED
+	// The constructor specializations below instantiate tvec3<float, aligned_*>, which requires the
+	// SIMD specializations of the tvec4 swizzles to be declared first.
+#	include "type_vec4.hpp"
+#endif
+
+namespace glm{
+namespace detail
+{
+	// The padding lane of aligned tvec3 is computed along with x, y and z but never flows into them.
+
+	template <precision P>
+	struct compute_vec3_add<float, P, true>
+	{
+		static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b)
+		{
+			tvec3<float, P> Result(uninitialize);
+			Result.data = _mm_add_ps(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec3_sub<float, P, true>
+	{
+		static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b)
+		{
+			tvec3<float, P> Result(uninitialize);
+			Result.data = _mm_sub_ps(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec3_mul<float, P, true>
+	{
+		static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b)
+		{
+			tvec3<float, P> Result(uninitialize);
+			Result.data = _mm_mul_ps(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec3_div<float, P, true>
+	{
+		static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b)
+		{
+			tvec3<float, P> Result(uninitialize);
+			Result.data = _mm_div_ps(a.data, b.data);
+			return Result;
+		}
+	};
+}//namespace detail
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec3<float, aligned_lowp>::tvec3(float s) :
+		data(_mm_set1_ps(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec3<float, aligned_mediump>::tvec3(float s) :
+		data(_mm_set1_ps(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec3<float, aligned_highp>::tvec3(float s) :
+		data(_mm_set1_ps(s))
+	{}
+
+	// Construction from components sets the padding lane to z so that dividing by such a vector
+	// doesn't divide by zero in the padding lane.
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec3<float, aligned_lowp>::tvec3(float a, float b, float c) :
+		data(_mm_set_ps(c, c, b, a))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec3<float, aligned_mediump>::tvec3(float a, float b, float c) :
+		data(_mm_set_ps(c, c, b, a))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec3<float, aligned_highp>::tvec3(float a, float b, float c) :
+		data(_mm_set_ps(c, c, b, a))
+	{}
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
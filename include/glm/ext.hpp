@@ -60,6 +60,7 @@
 #endif
 
 #ifdef GLM_ENABLE_EXPERIMENTAL
+#include "./gtx/animation_clip.hpp"
 #include "./gtx/associated_min_max.hpp"
 #include "./gtx/bit.hpp"
 #include "./gtx/closest_point.hpp"
@@ -70,21 +71,26 @@
 #include "./gtx/component_wise.hpp"
 #include "./gtx/dual_quaternion.hpp"
 #include "./gtx/euler_angles.hpp"
+#include "./gtx/exponential_batch.hpp"
 #include "./gtx/extend.hpp"
 #include "./gtx/extended_min_max.hpp"
 #include "./gtx/fast_exponential.hpp"
 #include "./gtx/fast_square_root.hpp"
 #include "./gtx/fast_trigonometry.hpp"
+#include "./gtx/fused.hpp"
 #include "./gtx/gradient_paint.hpp"
 #include "./gtx/handed_coordinate_space.hpp"
 #include "./gtx/integer.hpp"
 #include "./gtx/intersect.hpp"
 #include "./gtx/log_base.hpp"
+#include "./gtx/matrix_batch.hpp"
 #include "./gtx/matrix_cross_product.hpp"
 #include "./gtx/matrix_interpolation.hpp"
 #include "./gtx/matrix_major_storage.hpp"
 #include "./gtx/matrix_operation.hpp"
 #include "./gtx/matrix_query.hpp"
+#include "./gtx/mesh_indexing.hpp"
+#include "./gtx/mesh_optimize.hpp"
 #include "./gtx/mixed_product.hpp"
 #include "./gtx/norm.hpp"
 #include "./gtx/normal.hpp"
@@ -99,6 +105,7 @@
 #include "./gtx/raw_data.hpp"
 #include "./gtx/rotate_vector.hpp"
 #include "./gtx/spline.hpp"
+#include "./gtx/spline_curve.hpp"
 #include "./gtx/std_based_type.hpp"
 #if !(GLM_COMPILER & GLM_COMPILER_CUDA)
 #	include "./gtx/string_cast.hpp"
@@ -108,6 +115,7 @@
 #include "./gtx/vec_swizzle.hpp"
 #include "./gtx/vector_angle.hpp"
 #include "./gtx/vector_query.hpp"
+#include "./gtx/vertex_batch.hpp"
 #include "./gtx/wrap.hpp"
 
 #if GLM_HAS_TEMPLATE_ALIASES
@@ -117,4 +125,14 @@
 #if GLM_HAS_RANGE_FOR
 #	include "./gtx/range.hpp"
 #endif
+
+#if GLM_HAS_CXX11_STL
+#	include "./gtx/bvh.hpp"
+#	include "./gtx/image_color_space.hpp"
+#	include "./gtx/image_mipmap.hpp"
+#	include "./gtx/morton.hpp"
+#	include "./gtx/parallel.hpp"
+#	include "./gtx/skinning.hpp"
+#	include "./gtx/transform_hierarchy.hpp"
+#endif
 #endif//GLM_ENABLE_EXPERIMENTAL
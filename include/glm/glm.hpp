@@ -86,3 +86,5 @@
 #include "matrix.hpp"
 #include "vector_relational.hpp"
 #include "integer.hpp"
+
+#include "./detail/_extern.hpp"
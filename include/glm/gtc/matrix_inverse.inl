@@ -1,8 +1,56 @@
 /// @ref gtc_matrix_inverse
 /// @file glm/gtc/matrix_inverse.inl
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template <template <typename, precision> class matType, typename T, precision P, bool Aligned>
+	struct compute_inverseTranspose{};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_inverseTranspose<tmat2x2, T, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tmat2x2<T, P> call(tmat2x2<T, P> const & m)
+		{
+			T Determinant = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+
+			tmat2x2<T, P> Inverse(
+				+ m[1][1] / Determinant,
+				- m[1][0] / Determinant,
+				- m[0][1] / Determinant,
+				+ m[0][0] / Determinant);
+
+			return Inverse;
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_inverseTranspose<tmat3x3, T, P, Aligned>
+	{
+		GLM_FUNC_QUALIFIER static tmat3x3<T, P> call(tmat3x3<T, P> const & m)
+		{
+			T Determinant =
+				+ m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+				- m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+				+ m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+
+			tmat3x3<T, P> Inverse(uninitialize);
+			Inverse[0][0] = + (m[1][1] * m[2][2] - m[2][1] * m[1][2]);
+			Inverse[0][1] = - (m[1][0] * m[2][2] - m[2][0] * m[1][2]);
+			Inverse[0][2] = + (m[1][0] * m[2][1] - m[2][0] * m[1][1]);
+			Inverse[1][0] = - (m[0][1] * m[2][2] - m[2][1] * m[0][2]);
+			Inverse[1][1] = + (m[0][0] * m[2][2] - m[2][0] * m[0][2]);
+			Inverse[1][2] = - (m[0][0] * m[2][1] - m[2][0] * m[0][1]);
+			Inverse[2][0] = + (m[0][1] * m[1][2] - m[1][1] * m[0][2]);
+			Inverse[2][1] = - (m[0][0] * m[1][2] - m[1][0] * m[0][2]);
+			Inverse[2][2] = + (m[0][0] * m[1][1] - m[1][0] * m[0][1]);
+			Inverse /= Determinant;
+
+			return Inverse;
+		}
+	};
+}//namespace detail
+
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat3x3<T, P> affineInverse(tmat3x3<T, P> const & m)
 	{
@@ -29,38 +77,13 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat2x2<T, P> inverseTranspose(tmat2x2<T, P> const & m)
 	{
-		T Determinant = m[0][0] * m[1][1] - m[1][0] * m[0][1];
-
-		tmat2x2<T, P> Inverse(
-			+ m[1][1] / Determinant,
-			- m[0][1] / Determinant,
-			- m[1][0] / Determinant,
-			+ m[0][0] / Determinant);
-
-		return Inverse;
+		return detail::compute_inverseTranspose<tmat2x2, T, P, detail::is_aligned<P>::value>::call(m);
 	}
 
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat3x3<T, P> inverseTranspose(tmat3x3<T, P> const & m)
 	{
-		T Determinant =
-			+ m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
-			- m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
-			+ m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
-
-		tmat3x3<T, P> Inverse(uninitialize);
-		Inverse[0][0] = + (m[1][1] * m[2][2] - m[2][1] * m[1][2]);
-		Inverse[0][1] = - (m[1][0] * m[2][2] - m[2][0] * m[1][2]);
-		Inverse[0][2] = + (m[1][0] * m[2][1] - m[2][0] * m[1][1]);
-		Inverse[1][0] = - (m[0][1] * m[2][2] - m[2][1] * m[0][2]);
-		Inverse[1][1] = + (m[0][0] * m[2][2] - m[2][0] * m[0][2]);
-		Inverse[1][2] = - (m[0][0] * m[2][1] - m[2][0] * m[0][1]);
-		Inverse[2][0] = + (m[0][1] * m[1][2] - m[1][1] * m[0][2]);
-		Inverse[2][1] = - (m[0][0] * m[1][2] - m[1][0] * m[0][2]);
-		Inverse[2][2] = + (m[0][0] * m[1][1] - m[1][0] * m[0][1]);
-		Inverse /= Determinant;
-
-		return Inverse;
+		return detail::compute_inverseTranspose<tmat3x3, T, P, detail::is_aligned<P>::value>::call(m);
 	}
 
 	template <typename T, precision P>
@@ -118,3 +141,7 @@ namespace glm
 		return Inverse;
 	}
 }//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_ALIGNED_TYPE
+#	include "matrix_inverse_simd.inl"
+#endif
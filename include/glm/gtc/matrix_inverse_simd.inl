@@ -0,0 +1,35 @@
+/// @ref gtc_matrix_inverse
+/// @file glm/gtc/matrix_inverse_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	template <precision P>
+	struct compute_inverseTranspose<tmat3x3, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat3x3<float, P> call(tmat3x3<float, P> const & m)
+		{
+			tmat3x3<float, P> Result(uninitialize);
+			glm_mat3_inverseTranspose(*reinterpret_cast<glm_vec4 const(*)[3]>(&m[0].data), *reinterpret_cast<glm_vec4(*)[3]>(&Result[0].data));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_inverseTranspose<tmat2x2, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat2x2<float, P> call(tmat2x2<float, P> const & m)
+		{
+			tmat2x2<float, P> Result(uninitialize);
+			_mm_storeu_ps(&Result[0][0], glm_mat2_inverseTranspose(_mm_loadu_ps(&m[0][0])));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
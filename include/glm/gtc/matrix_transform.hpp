@@ -16,6 +16,10 @@
 /// (perspective, ortho, etc) are designed to expect. The OpenGL compatibility
 /// specifications defines the particular layout of this eye space.
 ///
+/// With C++14, translate, scale, ortho, frustum and lookAt are constexpr for the packed
+/// precisions so that tables of projection and basis matrices can be built at compile time.
+/// Aligned types keep their SIMD implementation and are only evaluated at run time.
+///
 /// <glm/gtc/matrix_transform.hpp> need to be included to use these functionalities.
 
 #pragma once
@@ -55,7 +59,7 @@ namespace glm
 	/// @see - translate(tmat4x4<T, P> const & m, T x, T y, T z)
 	/// @see - translate(tvec3<T, P> const & v)
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat4x4<T, P> translate(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, P> translate(
 		tmat4x4<T, P> const & m,
 		tvec3<T, P> const & v);
 		
@@ -83,7 +87,7 @@ namespace glm
 	/// @see - scale(tmat4x4<T, P> const & m, T x, T y, T z)
 	/// @see - scale(tvec3<T, P> const & v)
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat4x4<T, P> scale(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, P> scale(
 		tmat4x4<T, P> const & m,
 		tvec3<T, P> const & v);
 
@@ -99,7 +103,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - glm::ortho(T const & left, T const & right, T const & bottom, T const & top)
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> ortho(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho(
 		T left,
 		T right,
 		T bottom,
@@ -119,7 +123,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - glm::ortho(T const & left, T const & right, T const & bottom, T const & top)
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> orthoLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> orthoLH(
 		T left,
 		T right,
 		T bottom,
@@ -139,7 +143,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - glm::ortho(T const & left, T const & right, T const & bottom, T const & top)
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> orthoRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> orthoRH(
 		T left,
 		T right,
 		T bottom,
@@ -157,7 +161,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - glm::ortho(T const & left, T const & right, T const & bottom, T const & top, T const & zNear, T const & zFar)
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> ortho(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho(
 		T left,
 		T right,
 		T bottom,
@@ -174,7 +178,7 @@ namespace glm
 	/// @tparam T Value type used to build the matrix. Currently supported: half (not recommanded), float or double.
 	/// @see gtc_matrix_transform
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> frustum(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustum(
 		T left,
 		T right,
 		T bottom,
@@ -193,7 +197,7 @@ namespace glm
 	/// @tparam T Value type used to build the matrix. Currently supported: half (not recommanded), float or double.
 	/// @see gtc_matrix_transform
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> frustumLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustumLH(
 		T left,
 		T right,
 		T bottom,
@@ -212,7 +216,7 @@ namespace glm
 	/// @tparam T Value type used to build the matrix. Currently supported: half (not recommanded), float or double.
 	/// @see gtc_matrix_transform
 	template <typename T>
-	GLM_FUNC_DECL tmat4x4<T, defaultp> frustumRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustumRH(
 		T left,
 		T right,
 		T bottom,
@@ -428,7 +432,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - frustum(T const & left, T const & right, T const & bottom, T const & top, T const & nearVal, T const & farVal) frustum(T const & left, T const & right, T const & bottom, T const & top, T const & nearVal, T const & farVal)
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat4x4<T, P> lookAt(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, P> lookAt(
 		tvec3<T, P> const & eye,
 		tvec3<T, P> const & center,
 		tvec3<T, P> const & up);
@@ -441,7 +445,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - frustum(T const & left, T const & right, T const & bottom, T const & top, T const & nearVal, T const & farVal) frustum(T const & left, T const & right, T const & bottom, T const & top, T const & nearVal, T const & farVal)
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat4x4<T, P> lookAtRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, P> lookAtRH(
 		tvec3<T, P> const & eye,
 		tvec3<T, P> const & center,
 		tvec3<T, P> const & up);
@@ -454,7 +458,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - frustum(T const & left, T const & right, T const & bottom, T const & top, T const & nearVal, T const & farVal) frustum(T const & left, T const & right, T const & bottom, T const & top, T const & nearVal, T const & farVal)
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat4x4<T, P> lookAtLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, P> lookAtLH(
 		tvec3<T, P> const & eye,
 		tvec3<T, P> const & center,
 		tvec3<T, P> const & up);
@@ -5,10 +5,30 @@
 #include "../trigonometric.hpp"
 #include "../matrix.hpp"
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	// std::sqrt can't be evaluated at compile time, so constant evaluation of lookAt
+	// uses Newton iterations while run time calls keep normalize and its SIMD path.
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> translate(tmat4x4<T, P> const & m, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> compute_look_at_normalize(tvec3<T, P> const & v)
+	{
+#		if GLM_HAS_IS_CONSTANT_EVALUATED
+			if(__builtin_is_constant_evaluated())
+			{
+				T const Square = dot(v, v);
+				T Root = Square > static_cast<T>(1) ? Square : static_cast<T>(1);
+				for(T Next = (Root + Square / Root) / static_cast<T>(2); Next < Root; Next = (Root + Square / Root) / static_cast<T>(2))
+					Root = Next;
+				return v / Root;
+			}
+#		endif
+		return normalize(v);
+	}
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> translate(tmat4x4<T, P> const & m, tvec3<T, P> const & v)
 	{
 		tmat4x4<T, P> Result(m);
 		Result[3] = m[0] * v[0] + m[1] * v[1] + m[2] * v[2] + m[3];
@@ -76,14 +96,13 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> scale(tmat4x4<T, P> const & m, tvec3<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> scale(tmat4x4<T, P> const & m, tvec3<T, P> const & v)
 	{
-		tmat4x4<T, P> Result(uninitialize);
-		Result[0] = m[0] * v[0];
-		Result[1] = m[1] * v[1];
-		Result[2] = m[2] * v[2];
-		Result[3] = m[3];
-		return Result;
+		return tmat4x4<T, P>(
+			m[0] * v[0],
+			m[1] * v[1],
+			m[2] * v[2],
+			m[3]);
 	}
 
 	template <typename T, precision P>
@@ -97,7 +116,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> ortho
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho
 	(
 		T left, T right,
 		T bottom, T top,
@@ -112,7 +131,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> orthoLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> orthoLH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -137,7 +156,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> orthoRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> orthoRH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -162,7 +181,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> ortho
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho
 	(
 		T left, T right,
 		T bottom, T top
@@ -178,7 +197,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> frustum
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustum
 	(
 		T left, T right,
 		T bottom, T top,
@@ -193,7 +212,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> frustumLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustumLH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -219,7 +238,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> frustumRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustumRH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -508,7 +527,7 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> lookAt(tvec3<T, P> const & eye, tvec3<T, P> const & center, tvec3<T, P> const & up)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> lookAt(tvec3<T, P> const & eye, tvec3<T, P> const & center, tvec3<T, P> const & up)
 	{
 #		if GLM_COORDINATE_SYSTEM == GLM_LEFT_HANDED
 			return lookAtLH(eye, center, up);
@@ -518,15 +537,15 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> lookAtRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> lookAtRH
 	(
 		tvec3<T, P> const & eye,
 		tvec3<T, P> const & center,
 		tvec3<T, P> const & up
 	)
 	{
-		tvec3<T, P> const f(normalize(center - eye));
-		tvec3<T, P> const s(normalize(cross(f, up)));
+		tvec3<T, P> const f(detail::compute_look_at_normalize(center - eye));
+		tvec3<T, P> const s(detail::compute_look_at_normalize(cross(f, up)));
 		tvec3<T, P> const u(cross(s, f));
 
 		tmat4x4<T, P> Result(1);
@@ -546,15 +565,15 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> lookAtLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> lookAtLH
 	(
 		tvec3<T, P> const & eye,
 		tvec3<T, P> const & center,
 		tvec3<T, P> const & up
 	)
 	{
-		tvec3<T, P> const f(normalize(center - eye));
-		tvec3<T, P> const s(normalize(cross(up, f)));
+		tvec3<T, P> const f(detail::compute_look_at_normalize(center - eye));
+		tvec3<T, P> const s(detail::compute_look_at_normalize(cross(up, f)));
 		tvec3<T, P> const u(cross(f, s));
 
 		tmat4x4<T, P> Result(1);
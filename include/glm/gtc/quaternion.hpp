@@ -191,7 +191,7 @@ namespace glm
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P, template <typename, precision> class quatType>
-	GLM_FUNC_DECL T dot(quatType<T, P> const & x, quatType<T, P> const & y);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T dot(quatType<T, P> const & x, quatType<T, P> const & y);
 
 	/// Spherical linear interpolation of two quaternions.
 	/// The interpolation is oriented and the rotation is performed at constant speed.
@@ -394,3 +394,11 @@ namespace glm
 } //namespace glm
 
 #include "quaternion.inl"
+
+#if defined(GLM_EXTERN_TEMPLATES) && GLM_HAS_EXTERN_TEMPLATE
+namespace glm
+{
+	extern template struct tquat<float32, highp>;
+	extern template struct tquat<float64, highp>;
+}//namespace glm
+#endif//GLM_EXTERN_TEMPLATES
@@ -0,0 +1,149 @@
+/// @ref gtx_animation_clip
+/// @file glm/gtx/animation_clip.hpp
+///
+/// @see core (dependence)
+/// @see gtc_packing (dependence)
+/// @see gtc_quaternion (dependence)
+///
+/// @defgroup gtx_animation_clip GLM_GTX_animation_clip
+/// @ingroup gtx
+///
+/// @brief Compressed keyframe storage and sampling of whole poses.
+///
+/// A clip holds one track per bone, each track has rotation, translation and scale keys at the same times.
+/// Rotations are stored in 48 bits with the smallest three encoding: the largest component is dropped and
+/// rebuilt from the unit length, the other three are stored as 16 bit snorm values and the index of the
+/// dropped one takes the lowest bit of the first two. Translations and scales are packed with
+/// packUnorm1x16 relative to the bounds of their track. Channels whose keys are all equal keep a single key.
+///
+/// The rotation error is below 1.2e-4 radian, the translation and scale error below 1 / 131070 of the
+/// extent of the track. Poses are decompressed and interpolated 4 tracks at a time with SSE2.
+///
+/// An animation_cursor remembers the current key of each track: sampling at increasing times, as
+/// during playback, steps the cursor instead of searching the keys.
+///
+/// <glm/gtx/animation_clip.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/packing.hpp"
+#include "../gtc/quaternion.hpp"
+#include <cstddef>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_animation_clip is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_animation_clip extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_animation_clip
+	/// @{
+
+	enum animation_interpolation
+	{
+		/// Normalized linear interpolation of the rotations, the usual choice for dense keys.
+		ANIMATION_NLERP,
+		/// Spherical linear interpolation of the rotations, constant angular velocity between keys.
+		ANIMATION_SLERP
+	};
+
+	/// Playback position in a clip and sampling counters.
+	struct animation_cursor
+	{
+		GLM_FUNC_DECL animation_cursor();
+
+		/// Current key of each track.
+		std::vector<uint32> keys;
+		/// Time of the last sample.
+		float time;
+		/// Number of tracks sampled.
+		uint64 samples;
+		/// Number of keys stepped over while sampling forward.
+		uint64 steps;
+		/// Number of binary searches, after seeking backward or far forward.
+		uint64 searches;
+	};
+
+	/// Memory used by a clip.
+	struct animation_clip_stats
+	{
+		std::size_t trackCount;
+		std::size_t keyCount;
+		/// Number of rotation, translation and scale channels stored as a single key.
+		std::size_t constantChannels;
+		/// Bytes used by the keys, the key times and the per track data.
+		std::size_t compressedBytes;
+		/// Bytes used by the same keys as float time, quat, vec3 and vec3.
+		std::size_t uncompressedBytes;
+	};
+
+	/// Compressed tracks of keys.
+	class animation_clip
+	{
+	public:
+		GLM_FUNC_DECL animation_clip();
+
+		/// Add a track of KeyCount keys at increasing Times and return its index.
+		/// Rotations, Translations and Scales may be null for identity channels. Rotations are normalized.
+		GLM_FUNC_DECL std::size_t addTrack(
+			std::size_t KeyCount, float const * Times,
+			quat const * Rotations, vec3 const * Translations, vec3 const * Scales);
+
+		/// Sample every track at Time, clamped to the keys of each track. Any output may be null.
+		/// Cursor is reset when it was used with a clip of a different track count.
+		GLM_FUNC_DECL void sample(
+			float Time, animation_cursor & Cursor,
+			quat * Rotations, vec3 * Translations, vec3 * Scales,
+			animation_interpolation Interpolation = ANIMATION_NLERP) const;
+
+		/// Decompressed key of a track.
+		GLM_FUNC_DECL void key(std::size_t Track, std::size_t Key, quat & Rotation, vec3 & Translation, vec3 & Scale) const;
+
+		GLM_FUNC_DECL std::size_t trackCount() const;
+		GLM_FUNC_DECL std::size_t keyCount(std::size_t Track) const;
+
+		/// Time of the last key of the longest track.
+		GLM_FUNC_DECL float duration() const;
+
+		GLM_FUNC_DECL animation_clip_stats stats() const;
+
+	private:
+		enum channel
+		{
+			ROTATION,
+			TRANSLATION,
+			SCALE,
+			CHANNEL_COUNT
+		};
+
+		GLM_FUNC_DECL void encodeRotations(std::size_t KeyCount, quat const * Rotations);
+		GLM_FUNC_DECL void encodeVectors(channel Channel, std::size_t KeyCount, vec3 const * Values, vec3 const & Default);
+
+		// Key times of all the tracks, TrackKeys[Track] is the first key of a track
+		std::vector<float> Times;
+		std::vector<uint32> TrackKeys;
+
+		// 3 values per stored key, ChannelKeys[Channel][Track] is the first stored key of a track,
+		// Constant[Channel][Track] is 1 when the track stores a single key
+		std::vector<uint16> Data[CHANNEL_COUNT];
+		std::vector<uint32> ChannelKeys[CHANNEL_COUNT];
+		std::vector<uint8> Constant[CHANNEL_COUNT];
+
+		// Translation and scale of track t are Min[t] + unpacked * Step[t]
+		std::vector<vec3> Min[CHANNEL_COUNT];
+		std::vector<vec3> Step[CHANNEL_COUNT];
+
+		float Duration;
+	};
+
+	/// @}
+}//namespace glm
+
+#include "animation_clip.inl"
@@ -0,0 +1,455 @@
+/// @ref gtx_animation_clip
+/// @file glm/gtx/animation_clip.inl
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Keys of 4 tracks around the sampled time, indexed by channel, key, component and track
+	struct animation_lanes
+	{
+		uint16 Keys[3][2][3][4];
+		// Translation then scale
+		float Min[2][3][4];
+		float Step[2][3][4];
+		float Alpha[4];
+	};
+
+	GLM_FUNC_QUALIFIER quat animation_decode_rotation(uint16 const (&Key)[2][3][4], length_t k, length_t l)
+	{
+		uint16 const A = Key[k][0][l], B = Key[k][1][l], C = Key[k][2][l];
+		uint const Largest = (A & 1u) | ((B & 1u) << 1);
+
+		float const Scale = 0.70710678118654752440f;
+		float const Small[3] = {
+			unpackSnorm1x16(A) * Scale,
+			unpackSnorm1x16(B) * Scale,
+			unpackSnorm1x16(C) * Scale};
+		float const Big = sqrt(max(0.0f, 1.0f - Small[0] * Small[0] - Small[1] * Small[1] - Small[2] * Small[2]));
+
+		float Components[4];
+		for(uint i = 0, j = 0; i < 4; ++i)
+			Components[i] = i == Largest ? Big : Small[j++];
+		return quat(Components[3], Components[0], Components[1], Components[2]);
+	}
+
+	GLM_FUNC_QUALIFIER void animation_sample_scalar(animation_lanes const & Lanes, animation_interpolation Interpolation, quat * Rotations, vec3 * Translations, vec3 * Scales, std::size_t LaneCount)
+	{
+		for(length_t l = 0; l < static_cast<length_t>(LaneCount); ++l)
+		{
+			float const Alpha = Lanes.Alpha[l];
+
+			if(Rotations)
+			{
+				quat const Q0 = animation_decode_rotation(Lanes.Keys[0], 0, l);
+				quat Q1 = animation_decode_rotation(Lanes.Keys[0], 1, l);
+				if(Interpolation == ANIMATION_SLERP)
+					Rotations[l] = normalize(slerp(Q0, Q1, Alpha));
+				else
+				{
+					if(dot(Q0, Q1) < 0.0f)
+						Q1 = -Q1;
+					Rotations[l] = normalize(Q0 * (1.0f - Alpha) + Q1 * Alpha);
+				}
+			}
+
+			vec3 * const Outputs[2] = {Translations, Scales};
+			for(length_t c = 0; c < 2; ++c)
+			{
+				if(!Outputs[c])
+					continue;
+				vec3 Value[2];
+				for(length_t k = 0; k < 2; ++k)
+					for(length_t j = 0; j < 3; ++j)
+						Value[k][j] = Lanes.Min[c][j][l] + static_cast<float>(Lanes.Keys[c + 1][k][j][l]) * Lanes.Step[c][j][l];
+				Outputs[c][l] = mix(Value[0], Value[1], Alpha);
+			}
+		}
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	GLM_FUNC_QUALIFIER __m128i animation_load_snorm(uint16 const * p)
+	{
+		__m128i const v = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(p));
+		return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+	}
+
+	GLM_FUNC_QUALIFIER __m128 animation_load_unorm(uint16 const * p)
+	{
+		__m128i const v = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(p));
+		return _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, _mm_setzero_si128()));
+	}
+
+	GLM_FUNC_QUALIFIER __m128 animation_select(__m128 Mask, __m128 a, __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(Mask, a), _mm_andnot_ps(Mask, b));
+	}
+
+	// x, y, z and w of 4 rotations
+	GLM_FUNC_QUALIFIER void animation_decode_rotation_sse2(uint16 const (&Key)[3][4], __m128 Q[4])
+	{
+		__m128i const One = _mm_set1_epi32(1);
+		__m128i const A = animation_load_snorm(Key[0]);
+		__m128i const B = animation_load_snorm(Key[1]);
+		__m128i const C = animation_load_snorm(Key[2]);
+		__m128i const Largest = _mm_or_si128(_mm_and_si128(A, One), _mm_slli_epi32(_mm_and_si128(B, One), 1));
+
+		// 1 / (32767 * sqrt(2))
+		__m128 const Scale = _mm_set1_ps(2.1579891553e-5f);
+		__m128 const S0 = _mm_mul_ps(_mm_cvtepi32_ps(A), Scale);
+		__m128 const S1 = _mm_mul_ps(_mm_cvtepi32_ps(B), Scale);
+		__m128 const S2 = _mm_mul_ps(_mm_cvtepi32_ps(C), Scale);
+		__m128 const Dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(S0, S0), _mm_mul_ps(S1, S1)), _mm_mul_ps(S2, S2));
+		__m128 const Big = _mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_set1_ps(1.0f), Dot)));
+
+		__m128 const Is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(Largest, _mm_setzero_si128()));
+		__m128 const Is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(Largest, One));
+		__m128 const Is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(Largest, _mm_set1_epi32(2)));
+		__m128 const Is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(Largest, _mm_set1_epi32(3)));
+
+		// The stored components are the other three in order
+		Q[0] = animation_select(Is0, Big, S0);
+		Q[1] = animation_select(Is1, Big, animation_select(Is0, S0, S1));
+		Q[2] = animation_select(Is2, Big, animation_select(Is3, S2, S1));
+		Q[3] = animation_select(Is3, Big, S2);
+	}
+
+	// sin(x) for x in [0, pi / 2], Taylor series to x^11, error below 1e-7
+	GLM_FUNC_QUALIFIER __m128 animation_sin_sse2(__m128 x)
+	{
+		__m128 const x2 = _mm_mul_ps(x, x);
+		__m128 p = _mm_set1_ps(-2.5052108e-8f);
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(2.7557319e-6f));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.9841270e-4f));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(8.3333333e-3f));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.6666667e-1f));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f));
+		return _mm_mul_ps(p, x);
+	}
+
+	// acos(x) for x in [0, 1], Abramowitz and Stegun 4.4.46, error below 2e-8
+	GLM_FUNC_QUALIFIER __m128 animation_acos_sse2(__m128 x)
+	{
+		__m128 p = _mm_set1_ps(-0.0012624911f);
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0066700901f));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.0170881256f));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0308918810f));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.0501743046f));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0889789874f));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.2145988016f));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(1.5707963050f));
+		return _mm_mul_ps(p, _mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_set1_ps(1.0f), x))));
+	}
+
+	GLM_FUNC_QUALIFIER void animation_sample_sse2(animation_lanes const & Lanes, animation_interpolation Interpolation, quat * Rotations, vec3 * Translations, vec3 * Scales, std::size_t LaneCount)
+	{
+		__m128 const Alpha = _mm_loadu_ps(Lanes.Alpha);
+		__m128 const One = _mm_set1_ps(1.0f);
+
+		if(Rotations)
+		{
+			__m128 Q0[4], Q1[4];
+			animation_decode_rotation_sse2(Lanes.Keys[0][0], Q0);
+			animation_decode_rotation_sse2(Lanes.Keys[0][1], Q1);
+
+			// Shortest path
+			__m128 Dot = _mm_mul_ps(Q0[0], Q1[0]);
+			for(length_t i = 1; i < 4; ++i)
+				Dot = _mm_add_ps(Dot, _mm_mul_ps(Q0[i], Q1[i]));
+			__m128 const Sign = _mm_and_ps(Dot, _mm_set1_ps(-0.0f));
+			for(length_t i = 0; i < 4; ++i)
+				Q1[i] = _mm_xor_ps(Q1[i], Sign);
+			Dot = _mm_min_ps(_mm_xor_ps(Dot, Sign), One);
+
+			__m128 W0 = _mm_sub_ps(One, Alpha);
+			__m128 W1 = Alpha;
+			if(Interpolation == ANIMATION_SLERP)
+			{
+				// Weights of the linear interpolation when the keys are too close for sin(Angle) to be accurate
+				__m128 const Angle = animation_acos_sse2(Dot);
+				__m128 const InvSin = _mm_div_ps(One, _mm_sqrt_ps(_mm_sub_ps(One, _mm_mul_ps(Dot, Dot))));
+				__m128 const Close = _mm_cmpgt_ps(Dot, _mm_set1_ps(0.9999f));
+				W0 = animation_select(Close, W0, _mm_mul_ps(animation_sin_sse2(_mm_mul_ps(W0, Angle)), InvSin));
+				W1 = animation_select(Close, W1, _mm_mul_ps(animation_sin_sse2(_mm_mul_ps(W1, Angle)), InvSin));
+			}
+
+			__m128 Q[4];
+			for(length_t i = 0; i < 4; ++i)
+				Q[i] = _mm_add_ps(_mm_mul_ps(Q0[i], W0), _mm_mul_ps(Q1[i], W1));
+			__m128 const Length2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Q[0], Q[0]), _mm_mul_ps(Q[1], Q[1])), _mm_add_ps(_mm_mul_ps(Q[2], Q[2]), _mm_mul_ps(Q[3], Q[3])));
+			__m128 const InvLength = _mm_div_ps(One, _mm_sqrt_ps(Length2));
+			for(length_t i = 0; i < 4; ++i)
+				Q[i] = _mm_mul_ps(Q[i], InvLength);
+
+			_MM_TRANSPOSE4_PS(Q[0], Q[1], Q[2], Q[3]);
+			for(std::size_t l = 0; l < LaneCount; ++l)
+				_mm_storeu_ps(&Rotations[l].x, Q[l]);
+		}
+
+		vec3 * const Outputs[2] = {Translations, Scales};
+		for(length_t c = 0; c < 2; ++c)
+		{
+			if(!Outputs[c])
+				continue;
+
+			GLM_ALIGN(16) float Result[3][4];
+			for(length_t j = 0; j < 3; ++j)
+			{
+				__m128 const Min = _mm_loadu_ps(Lanes.Min[c][j]);
+				__m128 const Step = _mm_loadu_ps(Lanes.Step[c][j]);
+				__m128 const V0 = _mm_add_ps(Min, _mm_mul_ps(animation_load_unorm(Lanes.Keys[c + 1][0][j]), Step));
+				__m128 const V1 = _mm_add_ps(Min, _mm_mul_ps(animation_load_unorm(Lanes.Keys[c + 1][1][j]), Step));
+				_mm_store_ps(Result[j], _mm_add_ps(V0, _mm_mul_ps(_mm_sub_ps(V1, V0), Alpha)));
+			}
+			for(std::size_t l = 0; l < LaneCount; ++l)
+				Outputs[c][l] = vec3(Result[0][l], Result[1][l], Result[2][l]);
+		}
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER animation_cursor::animation_cursor() :
+		time(0.0f),
+		samples(0),
+		steps(0),
+		searches(0)
+	{}
+
+	GLM_FUNC_QUALIFIER animation_clip::animation_clip() :
+		TrackKeys(1, 0),
+		Duration(0.0f)
+	{}
+
+	GLM_FUNC_QUALIFIER void animation_clip::encodeRotations(std::size_t KeyCount, quat const * Rotations)
+	{
+		std::vector<uint16> & Stored = Data[ROTATION];
+		std::size_t const First = Stored.size() / 3;
+		ChannelKeys[ROTATION].push_back(static_cast<uint32>(First));
+
+		for(std::size_t i = 0; i < (Rotations ? KeyCount : 1); ++i)
+		{
+			quat const Rotation = Rotations ? normalize(Rotations[i]) : quat(1.0f, 0.0f, 0.0f, 0.0f);
+			float const Components[4] = {Rotation.x, Rotation.y, Rotation.z, Rotation.w};
+
+			uint Largest = 0;
+			for(uint j = 1; j < 4; ++j)
+				if(abs(Components[j]) > abs(Components[Largest]))
+					Largest = j;
+
+			// q and -q are the same rotation, the dropped component is positive
+			float const Scale = Components[Largest] < 0.0f ? -1.41421356237309504880f : 1.41421356237309504880f;
+			float Small[3];
+			for(uint j = 0, k = 0; j < 4; ++j)
+				if(j != Largest)
+					Small[k++] = Components[j] * Scale;
+
+			// The lowest bits of the first two values hold the index, they are rounded to the nearest value of that parity
+			uint16 Packed[3];
+			for(uint j = 0; j < 2; ++j)
+			{
+				int const Bit = static_cast<int>(Largest >> j) & 1;
+				float const Snorm = clamp(Small[j], -1.0f, 1.0f) * 32767.0f;
+				int Value = static_cast<int>(round(Snorm));
+				if((Value & 1) != Bit)
+					Value += Snorm > static_cast<float>(Value) ? 1 : -1;
+				Value = Value > 32767 ? Value - 2 : (Value < -32767 ? Value + 2 : Value);
+				Packed[j] = static_cast<uint16>(Value);
+			}
+			Packed[2] = packSnorm1x16(Small[2]);
+			Stored.insert(Stored.end(), Packed, Packed + 3);
+		}
+
+		bool IsConstant = true;
+		for(std::size_t i = First + 1; i < Stored.size() / 3 && IsConstant; ++i)
+			IsConstant = std::equal(&Stored[i * 3], &Stored[i * 3] + 3, &Stored[First * 3]);
+		if(IsConstant)
+			Stored.resize(First * 3 + 3);
+		Constant[ROTATION].push_back(IsConstant ? 1 : 0);
+	}
+
+	GLM_FUNC_QUALIFIER void animation_clip::encodeVectors(channel Channel, std::size_t KeyCount, vec3 const * Values, vec3 const & Default)
+	{
+		std::vector<uint16> & Stored = Data[Channel];
+		ChannelKeys[Channel].push_back(static_cast<uint32>(Stored.size() / 3));
+
+		vec3 Lower(Values ? Values[0] : Default);
+		vec3 Upper(Lower);
+		for(std::size_t i = 1; Values && i < KeyCount; ++i)
+		{
+			Lower = min(Lower, Values[i]);
+			Upper = max(Upper, Values[i]);
+		}
+		vec3 const Extent(Upper - Lower);
+		bool const IsConstant = all(equal(Extent, vec3(0.0f)));
+
+		Min[Channel].push_back(Lower);
+		Step[Channel].push_back(Extent / 65535.0f);
+		Constant[Channel].push_back(IsConstant ? 1 : 0);
+
+		for(std::size_t i = 0; i < (IsConstant ? 1 : KeyCount); ++i)
+		{
+			for(length_t j = 0; j < 3; ++j)
+				Stored.push_back(Extent[j] > 0.0f ? packUnorm1x16((Values[i][j] - Lower[j]) / Extent[j]) : static_cast<uint16>(0));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t animation_clip::addTrack
+	(
+		std::size_t KeyCount, float const * KeyTimes,
+		quat const * Rotations, vec3 const * Translations, vec3 const * Scales
+	)
+	{
+		assert(KeyCount > 0);
+
+		Times.insert(Times.end(), KeyTimes, KeyTimes + KeyCount);
+		TrackKeys.push_back(static_cast<uint32>(Times.size()));
+		Duration = max(Duration, KeyTimes[KeyCount - 1]);
+
+		this->encodeRotations(KeyCount, Rotations);
+		this->encodeVectors(TRANSLATION, KeyCount, Translations, vec3(0.0f));
+		this->encodeVectors(SCALE, KeyCount, Scales, vec3(1.0f));
+
+		return TrackKeys.size() - 2;
+	}
+
+	GLM_FUNC_QUALIFIER void animation_clip::sample
+	(
+		float Time, animation_cursor & Cursor,
+		quat * Rotations, vec3 * Translations, vec3 * Scales,
+		animation_interpolation Interpolation
+	) const
+	{
+		std::size_t const TrackCount = this->trackCount();
+		bool Seek = Time < Cursor.time;
+		if(Cursor.keys.size() != TrackCount)
+		{
+			Cursor.keys.assign(TrackCount, 0);
+			Seek = true;
+		}
+		Cursor.time = Time;
+		Cursor.samples += TrackCount;
+
+		for(std::size_t Base = 0; Base < TrackCount; Base += 4)
+		{
+			std::size_t const LaneCount = min<std::size_t>(4, TrackCount - Base);
+
+			detail::animation_lanes Lanes;
+			for(length_t l = 0; l < 4; ++l)
+			{
+				// The lanes past the last track repeat it
+				std::size_t const Track = Base + min<std::size_t>(l, LaneCount - 1);
+				uint32 const Count = TrackKeys[Track + 1] - TrackKeys[Track];
+				float const * KeyTimes = &Times[TrackKeys[Track]];
+
+				uint32 Key = Cursor.keys[Track];
+				if(static_cast<std::size_t>(l) < LaneCount)
+				{
+					if(Seek || (Key + 4 < Count && KeyTimes[Key + 4] <= Time))
+					{
+						Key = static_cast<uint32>(std::upper_bound(KeyTimes, KeyTimes + Count, Time) - KeyTimes);
+						Key = Key > 0 ? Key - 1 : 0;
+						++Cursor.searches;
+					}
+					else
+					{
+						for(; Key + 1 < Count && KeyTimes[Key + 1] <= Time; ++Key)
+							++Cursor.steps;
+					}
+					Cursor.keys[Track] = Key;
+				}
+
+				uint32 const Next = Key + 1 < Count ? Key + 1 : Key;
+				float const Delta = KeyTimes[Next] - KeyTimes[Key];
+				Lanes.Alpha[l] = Delta > 0.0f ? clamp((Time - KeyTimes[Key]) / Delta, 0.0f, 1.0f) : 0.0f;
+
+				for(length_t c = 0; c < CHANNEL_COUNT; ++c)
+				{
+					bool const IsConstant = Constant[c][Track] != 0;
+					uint16 const * Key0 = &Data[c][(ChannelKeys[c][Track] + (IsConstant ? 0 : Key)) * 3];
+					uint16 const * Key1 = &Data[c][(ChannelKeys[c][Track] + (IsConstant ? 0 : Next)) * 3];
+					for(length_t j = 0; j < 3; ++j)
+					{
+						Lanes.Keys[c][0][j][l] = Key0[j];
+						Lanes.Keys[c][1][j][l] = Key1[j];
+					}
+				}
+				for(length_t c = 0; c < 2; ++c)
+				{
+					for(length_t j = 0; j < 3; ++j)
+					{
+						Lanes.Min[c][j][l] = Min[c + 1][Track][j];
+						Lanes.Step[c][j][l] = Step[c + 1][Track][j];
+					}
+				}
+			}
+
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				detail::animation_sample_sse2(Lanes, Interpolation,
+					Rotations ? Rotations + Base : NULL, Translations ? Translations + Base : NULL, Scales ? Scales + Base : NULL, LaneCount);
+#			else
+				detail::animation_sample_scalar(Lanes, Interpolation,
+					Rotations ? Rotations + Base : NULL, Translations ? Translations + Base : NULL, Scales ? Scales + Base : NULL, LaneCount);
+#			endif
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void animation_clip::key(std::size_t Track, std::size_t Key, quat & Rotation, vec3 & Translation, vec3 & Scale) const
+	{
+		assert(Track < this->trackCount() && Key < this->keyCount(Track));
+
+		detail::animation_lanes Lanes;
+		for(length_t c = 0; c < CHANNEL_COUNT; ++c)
+		{
+			uint16 const * Stored = &Data[c][(ChannelKeys[c][Track] + (Constant[c][Track] ? 0 : Key)) * 3];
+			for(length_t j = 0; j < 3; ++j)
+				Lanes.Keys[c][0][j][0] = Lanes.Keys[c][1][j][0] = Stored[j];
+		}
+		for(length_t c = 0; c < 2; ++c)
+		{
+			for(length_t j = 0; j < 3; ++j)
+			{
+				Lanes.Min[c][j][0] = Min[c + 1][Track][j];
+				Lanes.Step[c][j][0] = Step[c + 1][Track][j];
+			}
+		}
+		Lanes.Alpha[0] = 0.0f;
+
+		detail::animation_sample_scalar(Lanes, ANIMATION_NLERP, &Rotation, &Translation, &Scale, 1);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t animation_clip::trackCount() const
+	{
+		return TrackKeys.size() - 1;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t animation_clip::keyCount(std::size_t Track) const
+	{
+		return TrackKeys[Track + 1] - TrackKeys[Track];
+	}
+
+	GLM_FUNC_QUALIFIER float animation_clip::duration() const
+	{
+		return Duration;
+	}
+
+	GLM_FUNC_QUALIFIER animation_clip_stats animation_clip::stats() const
+	{
+		animation_clip_stats Stats;
+		Stats.trackCount = this->trackCount();
+		Stats.keyCount = Times.size();
+		Stats.constantChannels = 0;
+		Stats.compressedBytes = Times.size() * sizeof(float) + TrackKeys.size() * sizeof(uint32);
+		for(length_t c = 0; c < CHANNEL_COUNT; ++c)
+		{
+			Stats.constantChannels += static_cast<std::size_t>(std::count(Constant[c].begin(), Constant[c].end(), static_cast<uint8>(1)));
+			Stats.compressedBytes +=
+				Data[c].size() * sizeof(uint16) + ChannelKeys[c].size() * sizeof(uint32) + Constant[c].size() * sizeof(uint8) +
+				(Min[c].size() + Step[c].size()) * sizeof(vec3);
+		}
+		Stats.uncompressedBytes = Times.size() * (sizeof(float) + sizeof(quat) + sizeof(vec3) * 2);
+		return Stats;
+	}
+}//namespace glm
@@ -0,0 +1,159 @@
+/// @ref gtx_bvh
+/// @file glm/gtx/bvh.hpp
+///
+/// @see core (dependence)
+/// @see gtx_intersect (dependence)
+/// @see gtx_parallel (dependence)
+///
+/// @defgroup gtx_bvh GLM_GTX_bvh
+/// @ingroup gtx
+///
+/// @brief Bounding volume hierarchy over triangle meshes for ray queries.
+///
+/// The hierarchy is built with a binned surface area heuristic, in parallel for large meshes,
+/// and flattened in depth first order in 32 bytes nodes. Rays can be traced one at a time or
+/// in packets of 4 or 8 rays. Triangles are tested with a SIMD Moller-Trumbore test, the hits
+/// match intersectRayTriangle from GLM_GTX_intersect.
+///
+/// <glm/gtx/bvh.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/intersect.hpp"
+#include "../gtx/parallel.hpp"
+#include <cstddef>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_bvh is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_bvh extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_bvh
+	/// @{
+
+	/// Node of a flattened hierarchy, two nodes fit in a cache line.
+	/// The first child of an inner node immediately follows its parent.
+	struct bvh_node
+	{
+		vec3 min;
+		/// Leaf: first triangle in the reordered triangle list. Inner node: index of the second child.
+		uint32 offset;
+		vec3 max;
+		/// Leaf: number of triangles. Inner node: 0.
+		uint16 count;
+		/// Inner node: split axis, used to visit the nearest child first.
+		uint16 axis;
+	};
+
+	/// Hierarchy construction settings.
+	struct bvh_build_params
+	{
+		GLM_FUNC_DECL bvh_build_params();
+
+		/// Leaves above this size are always split.
+		uint32 maxLeafSize;
+		/// Number of bins evaluated per axis by the surface area heuristic.
+		uint32 binCount;
+		/// Relative cost of a node traversal against a triangle test.
+		float traversalCost;
+		/// Sub-trees with fewer triangles are built on the calling thread.
+		uint32 parallelThreshold;
+		/// Executor of the passes over the triangles, null means parallelDefaultExecutor().
+		parallel_executor * executor;
+		/// Maximum number of threads, 0 means the concurrency of the executor.
+		unsigned threadCount;
+	};
+
+	/// Closest hit of a single ray.
+	struct bvh_hit
+	{
+		float distance;
+		/// Barycentric coordinates of the hit relative to the second and third vertices.
+		vec2 barycentric;
+		/// Index of the triangle in the source mesh, bvh::invalid when nothing is hit.
+		uint32 triangle;
+	};
+
+	/// Packet of L rays in structure of arrays layout. A lane with tmax <= 0 is inactive.
+	template <length_t L>
+	struct bvh_ray_packet
+	{
+		float origX[L], origY[L], origZ[L];
+		float dirX[L], dirY[L], dirZ[L];
+		float tmax[L];
+	};
+
+	/// Closest hits of a packet of L rays.
+	template <length_t L>
+	struct bvh_hit_packet
+	{
+		float distance[L];
+		float u[L], v[L];
+		uint32 triangle[L];
+	};
+
+	/// Bounding volume hierarchy over an indexed triangle mesh.
+	class bvh
+	{
+	public:
+		static uint32 const invalid = 0xFFFFFFFFu;
+
+		GLM_FUNC_DECL bvh();
+
+		/// Build the hierarchy over TriangleCount triangles.
+		/// Indices holds 3 vertex indices per triangle, when null Positions is a triangle soup.
+		GLM_FUNC_DECL void build(
+			vec3 const * Positions,
+			uint32 const * Indices,
+			std::size_t TriangleCount,
+			bvh_build_params const & Params = bvh_build_params());
+
+		/// Closest hit along Orig + t * Dir for t in (0, TMax). Returns false when nothing is hit.
+		GLM_FUNC_DECL bool intersect(vec3 const & Orig, vec3 const & Dir, float TMax, bvh_hit & Hit) const;
+
+		/// Return true when any triangle is hit for t in (0, TMax). Cheaper than intersect, meant for shadow and occlusion rays.
+		GLM_FUNC_DECL bool occluded(vec3 const & Orig, vec3 const & Dir, float TMax) const;
+
+		/// Closest hits of a packet of 4 rays.
+		GLM_FUNC_DECL void intersect(bvh_ray_packet<4> const & Rays, bvh_hit_packet<4> & Hits) const;
+
+		/// Closest hits of a packet of 8 rays. Runs as two 4 wide packets without AVX.
+		GLM_FUNC_DECL void intersect(bvh_ray_packet<8> const & Rays, bvh_hit_packet<8> & Hits) const;
+
+		GLM_FUNC_DECL std::vector<bvh_node> const & nodes() const;
+		GLM_FUNC_DECL std::size_t triangleCount() const;
+		GLM_FUNC_DECL std::size_t depth() const;
+
+	private:
+		template <typename simdType>
+		GLM_FUNC_DECL void intersectPacket(
+			float const * OrigX, float const * OrigY, float const * OrigZ,
+			float const * DirX, float const * DirY, float const * DirZ, float const * TMax,
+			float * Distance, float * U, float * V, uint32 * Triangle) const;
+
+		template <bool AnyHit>
+		GLM_FUNC_DECL bool traverse(vec3 const & Orig, vec3 const & Dir, float TMax, bvh_hit & Hit) const;
+
+		GLM_FUNC_DECL float const * stream(std::size_t Index) const;
+
+		std::vector<bvh_node> Nodes;
+		// Source index of each reordered triangle
+		std::vector<uint32> Triangles;
+		// Vertex 0, edge 1 and edge 2 of the reordered triangles, 9 padded streams of Stride floats
+		std::vector<float> Data;
+		std::size_t Stride;
+		std::size_t Depth;
+	};
+
+	/// @}
+}//namespace glm
+
+#include "bvh.inl"
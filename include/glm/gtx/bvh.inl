@@ -0,0 +1,688 @@
+/// @ref gtx_bvh
+/// @file glm/gtx/bvh.inl
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <memory>
+
+namespace glm{
+namespace detail
+{
+	// Lane abstraction used by the triangle and box tests. Lanes are triangles when tracing
+	// a single ray and rays when tracing a packet.
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct bvh_simd4
+	{
+		typedef __m128 type;
+		enum {lanes = 4};
+
+		GLM_FUNC_QUALIFIER static type load(float const * p){return _mm_loadu_ps(p);}
+		GLM_FUNC_QUALIFIER static void store(float * p, type v){_mm_storeu_ps(p, v);}
+		GLM_FUNC_QUALIFIER static type set1(float v){return _mm_set1_ps(v);}
+		GLM_FUNC_QUALIFIER static type lane_index(){return _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);}
+		GLM_FUNC_QUALIFIER static type add(type a, type b){return _mm_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type sub(type a, type b){return _mm_sub_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type mul(type a, type b){return _mm_mul_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type div(type a, type b){return _mm_div_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type min(type a, type b){return _mm_min_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type max(type a, type b){return _mm_max_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type abs(type a){return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);}
+		GLM_FUNC_QUALIFIER static type lt(type a, type b){return _mm_cmplt_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type le(type a, type b){return _mm_cmple_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type gt(type a, type b){return _mm_cmpgt_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type ge(type a, type b){return _mm_cmpge_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type and_(type a, type b){return _mm_and_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type select(type m, type a, type b){return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));}
+		GLM_FUNC_QUALIFIER static int mask(type m){return _mm_movemask_ps(m);}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct bvh_simd8
+	{
+		typedef __m256 type;
+		enum {lanes = 8};
+
+		GLM_FUNC_QUALIFIER static type load(float const * p){return _mm256_loadu_ps(p);}
+		GLM_FUNC_QUALIFIER static void store(float * p, type v){_mm256_storeu_ps(p, v);}
+		GLM_FUNC_QUALIFIER static type set1(float v){return _mm256_set1_ps(v);}
+		GLM_FUNC_QUALIFIER static type lane_index(){return _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);}
+		GLM_FUNC_QUALIFIER static type add(type a, type b){return _mm256_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type sub(type a, type b){return _mm256_sub_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type mul(type a, type b){return _mm256_mul_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type div(type a, type b){return _mm256_div_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type min(type a, type b){return _mm256_min_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type max(type a, type b){return _mm256_max_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type abs(type a){return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);}
+		GLM_FUNC_QUALIFIER static type lt(type a, type b){return _mm256_cmp_ps(a, b, _CMP_LT_OQ);}
+		GLM_FUNC_QUALIFIER static type le(type a, type b){return _mm256_cmp_ps(a, b, _CMP_LE_OQ);}
+		GLM_FUNC_QUALIFIER static type gt(type a, type b){return _mm256_cmp_ps(a, b, _CMP_GT_OQ);}
+		GLM_FUNC_QUALIFIER static type ge(type a, type b){return _mm256_cmp_ps(a, b, _CMP_GE_OQ);}
+		GLM_FUNC_QUALIFIER static type and_(type a, type b){return _mm256_and_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type select(type m, type a, type b){return _mm256_blendv_ps(b, a, m);}
+		GLM_FUNC_QUALIFIER static int mask(type m){return _mm256_movemask_ps(m);}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	template <length_t L>
+	struct bvh_simd_scalar
+	{
+		struct type{float v[L];};
+		enum {lanes = L};
+
+#		define GLM_BVH_LANES(expr) type r; for(length_t i = 0; i < L; ++i) r.v[i] = (expr); return r
+		GLM_FUNC_QUALIFIER static type load(float const * p){GLM_BVH_LANES(p[i]);}
+		GLM_FUNC_QUALIFIER static void store(float * p, type const & a){for(length_t i = 0; i < L; ++i) p[i] = a.v[i];}
+		GLM_FUNC_QUALIFIER static type set1(float a){GLM_BVH_LANES(a);}
+		GLM_FUNC_QUALIFIER static type lane_index(){GLM_BVH_LANES(static_cast<float>(i));}
+		GLM_FUNC_QUALIFIER static type add(type const & a, type const & b){GLM_BVH_LANES(a.v[i] + b.v[i]);}
+		GLM_FUNC_QUALIFIER static type sub(type const & a, type const & b){GLM_BVH_LANES(a.v[i] - b.v[i]);}
+		GLM_FUNC_QUALIFIER static type mul(type const & a, type const & b){GLM_BVH_LANES(a.v[i] * b.v[i]);}
+		GLM_FUNC_QUALIFIER static type div(type const & a, type const & b){GLM_BVH_LANES(a.v[i] / b.v[i]);}
+		GLM_FUNC_QUALIFIER static type min(type const & a, type const & b){GLM_BVH_LANES(b.v[i] < a.v[i] ? b.v[i] : a.v[i]);}
+		GLM_FUNC_QUALIFIER static type max(type const & a, type const & b){GLM_BVH_LANES(a.v[i] < b.v[i] ? b.v[i] : a.v[i]);}
+		GLM_FUNC_QUALIFIER static type abs(type const & a){GLM_BVH_LANES(a.v[i] < 0.0f ? -a.v[i] : a.v[i]);}
+		GLM_FUNC_QUALIFIER static type lt(type const & a, type const & b){GLM_BVH_LANES(a.v[i] < b.v[i] ? 1.0f : 0.0f);}
+		GLM_FUNC_QUALIFIER static type le(type const & a, type const & b){GLM_BVH_LANES(a.v[i] <= b.v[i] ? 1.0f : 0.0f);}
+		GLM_FUNC_QUALIFIER static type gt(type const & a, type const & b){GLM_BVH_LANES(a.v[i] > b.v[i] ? 1.0f : 0.0f);}
+		GLM_FUNC_QUALIFIER static type ge(type const & a, type const & b){GLM_BVH_LANES(a.v[i] >= b.v[i] ? 1.0f : 0.0f);}
+		GLM_FUNC_QUALIFIER static type and_(type const & a, type const & b){GLM_BVH_LANES(a.v[i] != 0.0f && b.v[i] != 0.0f ? 1.0f : 0.0f);}
+		GLM_FUNC_QUALIFIER static type select(type const & m, type const & a, type const & b){GLM_BVH_LANES(m.v[i] != 0.0f ? a.v[i] : b.v[i]);}
+#		undef GLM_BVH_LANES
+
+		GLM_FUNC_QUALIFIER static int mask(type const & m)
+		{
+			int Result = 0;
+			for(length_t i = 0; i < L; ++i)
+				Result |= m.v[i] != 0.0f ? (1 << i) : 0;
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		typedef bvh_simd8 bvh_simd_wide;
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+		typedef bvh_simd4 bvh_simd_wide;
+#	else
+		typedef bvh_simd_scalar<4> bvh_simd_wide;
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		typedef bvh_simd4 bvh_simd_packet4;
+#	else
+		typedef bvh_simd_scalar<4> bvh_simd_packet4;
+#	endif
+
+	// Two sided Moller-Trumbore test of one lane of rays against one lane of triangles.
+	// Returns the mask of the lanes hit in (0, TMax).
+	template <typename S>
+	GLM_FUNC_QUALIFIER typename S::type bvh_intersect_triangle(
+		typename S::type const O[3], typename S::type const D[3],
+		typename S::type const V0[3], typename S::type const E1[3], typename S::type const E2[3],
+		typename S::type const & TMax,
+		typename S::type & Distance, typename S::type & U, typename S::type & V)
+	{
+		typedef typename S::type real;
+
+		real const Px = S::sub(S::mul(D[1], E2[2]), S::mul(D[2], E2[1]));
+		real const Py = S::sub(S::mul(D[2], E2[0]), S::mul(D[0], E2[2]));
+		real const Pz = S::sub(S::mul(D[0], E2[1]), S::mul(D[1], E2[0]));
+
+		real const Det = S::add(S::add(S::mul(E1[0], Px), S::mul(E1[1], Py)), S::mul(E1[2], Pz));
+		real const InvDet = S::div(S::set1(1.0f), Det);
+
+		real const Tx = S::sub(O[0], V0[0]);
+		real const Ty = S::sub(O[1], V0[1]);
+		real const Tz = S::sub(O[2], V0[2]);
+
+		U = S::mul(S::add(S::add(S::mul(Tx, Px), S::mul(Ty, Py)), S::mul(Tz, Pz)), InvDet);
+
+		real const Qx = S::sub(S::mul(Ty, E1[2]), S::mul(Tz, E1[1]));
+		real const Qy = S::sub(S::mul(Tz, E1[0]), S::mul(Tx, E1[2]));
+		real const Qz = S::sub(S::mul(Tx, E1[1]), S::mul(Ty, E1[0]));
+
+		V = S::mul(S::add(S::add(S::mul(D[0], Qx), S::mul(D[1], Qy)), S::mul(D[2], Qz)), InvDet);
+		Distance = S::mul(S::add(S::add(S::mul(E2[0], Qx), S::mul(E2[1], Qy)), S::mul(E2[2], Qz)), InvDet);
+
+		real const Zero = S::set1(0.0f);
+		real Mask = S::gt(S::abs(Det), S::set1(std::numeric_limits<float>::epsilon()));
+		Mask = S::and_(Mask, S::ge(U, Zero));
+		Mask = S::and_(Mask, S::ge(V, Zero));
+		Mask = S::and_(Mask, S::le(S::add(U, V), S::set1(1.0f)));
+		Mask = S::and_(Mask, S::gt(Distance, Zero));
+		Mask = S::and_(Mask, S::lt(Distance, TMax));
+		return Mask;
+	}
+
+	GLM_FUNC_QUALIFIER bool bvh_intersect_box(bvh_node const & Node, vec3 const & Orig, vec3 const & InvDir, float TMax)
+	{
+		vec3 const T0 = (Node.min - Orig) * InvDir;
+		vec3 const T1 = (Node.max - Orig) * InvDir;
+		vec3 const Near = glm::min(T0, T1);
+		vec3 const Far = glm::max(T0, T1);
+		float const TNear = glm::max(glm::max(Near.x, Near.y), glm::max(Near.z, 0.0f));
+		float const TFar = glm::min(glm::min(Far.x, Far.y), glm::min(Far.z, TMax));
+		return TNear <= TFar;
+	}
+
+	GLM_FUNC_QUALIFIER float bvh_half_area(vec3 const & Min, vec3 const & Max)
+	{
+		vec3 const Extent = Max - Min;
+		return Extent.x * Extent.y + Extent.y * Extent.z + Extent.z * Extent.x;
+	}
+
+	struct bvh_build_node
+	{
+		vec3 min, max;
+		uint32 begin, count;
+		uint16 axis;
+		std::unique_ptr<bvh_build_node> children[2];
+	};
+
+	struct bvh_builder
+	{
+		enum {max_bins = 64, max_depth = 48};
+
+		bvh_build_params Params;
+		std::vector<vec3> Min, Max, Centroid;
+		std::vector<uint32> Indices;
+		std::size_t SpawnDepth;
+
+		GLM_FUNC_QUALIFIER std::unique_ptr<bvh_build_node> build(uint32 Begin, uint32 End, std::size_t Depth)
+		{
+			std::unique_ptr<bvh_build_node> Node(new bvh_build_node);
+			Node->begin = Begin;
+			Node->count = End - Begin;
+			Node->axis = 0;
+
+			vec3 CentroidMin(std::numeric_limits<float>::max());
+			vec3 CentroidMax(-std::numeric_limits<float>::max());
+			Node->min = CentroidMin;
+			Node->max = CentroidMax;
+			for(uint32 i = Begin; i < End; ++i)
+			{
+				uint32 const Triangle = Indices[i];
+				Node->min = glm::min(Node->min, Min[Triangle]);
+				Node->max = glm::max(Node->max, Max[Triangle]);
+				CentroidMin = glm::min(CentroidMin, Centroid[Triangle]);
+				CentroidMax = glm::max(CentroidMax, Centroid[Triangle]);
+			}
+
+			uint32 const Count = End - Begin;
+			if(Count <= 1)
+				return Node;
+
+			uint32 Mid = Begin;
+			int Axis = -1;
+
+			if(Depth < max_depth)
+			{
+				int BestBin = 0;
+				float const LeafCost = static_cast<float>(Count);
+				float BestCost = std::numeric_limits<float>::max();
+				float const InvArea = 1.0f / glm::max(bvh_half_area(Node->min, Node->max), std::numeric_limits<float>::min());
+				int const BinCount = glm::clamp(static_cast<int>(Params.binCount), 2, static_cast<int>(max_bins));
+
+				for(int a = 0; a < 3; ++a)
+				{
+					float const Extent = CentroidMax[a] - CentroidMin[a];
+					if(Extent <= 0.0f)
+						continue;
+
+					float const Scale = static_cast<float>(BinCount) * (1.0f - 1e-5f) / Extent;
+					uint32 BinSize[max_bins] = {0};
+					vec3 BinMin[max_bins], BinMax[max_bins];
+					for(int b = 0; b < BinCount; ++b)
+					{
+						BinMin[b] = vec3(std::numeric_limits<float>::max());
+						BinMax[b] = vec3(-std::numeric_limits<float>::max());
+					}
+
+					for(uint32 i = Begin; i < End; ++i)
+					{
+						uint32 const Triangle = Indices[i];
+						int const b = glm::min(static_cast<int>((Centroid[Triangle][a] - CentroidMin[a]) * Scale), BinCount - 1);
+						++BinSize[b];
+						BinMin[b] = glm::min(BinMin[b], Min[Triangle]);
+						BinMax[b] = glm::max(BinMax[b], Max[Triangle]);
+					}
+
+					// Sweep from the right to store the cost of the right side of each split plane
+					float RightCost[max_bins];
+					vec3 AccumMin(std::numeric_limits<float>::max());
+					vec3 AccumMax(-std::numeric_limits<float>::max());
+					uint32 AccumSize = 0;
+					for(int b = BinCount - 1; b > 0; --b)
+					{
+						AccumMin = glm::min(AccumMin, BinMin[b]);
+						AccumMax = glm::max(AccumMax, BinMax[b]);
+						AccumSize += BinSize[b];
+						RightCost[b - 1] = AccumSize > 0 ? bvh_half_area(AccumMin, AccumMax) * static_cast<float>(AccumSize) : 0.0f;
+					}
+
+					AccumMin = vec3(std::numeric_limits<float>::max());
+					AccumMax = vec3(-std::numeric_limits<float>::max());
+					AccumSize = 0;
+					for(int b = 0; b < BinCount - 1; ++b)
+					{
+						AccumMin = glm::min(AccumMin, BinMin[b]);
+						AccumMax = glm::max(AccumMax, BinMax[b]);
+						AccumSize += BinSize[b];
+						if(AccumSize == 0 || AccumSize == Count)
+							continue;
+
+						float const Cost = Params.traversalCost + (bvh_half_area(AccumMin, AccumMax) * static_cast<float>(AccumSize) + RightCost[b]) * InvArea;
+						if(Cost < BestCost)
+						{
+							BestCost = Cost;
+							BestBin = b;
+							Axis = a;
+						}
+					}
+				}
+
+				if(BestCost >= LeafCost && Count <= Params.maxLeafSize)
+					return Node;
+
+				if(Axis != -1)
+				{
+					float const Scale = static_cast<float>(BinCount) * (1.0f - 1e-5f) / (CentroidMax[Axis] - CentroidMin[Axis]);
+					float const Origin = CentroidMin[Axis];
+					centroid_bin_less const Pred = {&Centroid[0], Axis, Origin, Scale, BinCount, BestBin};
+					Mid = static_cast<uint32>(std::partition(Indices.begin() + Begin, Indices.begin() + End, Pred) - Indices.begin());
+				}
+			}
+
+			// No profitable or valid SAH split: fall back to a median split along the widest centroid extent
+			if(Mid == Begin || Mid == End)
+			{
+				if(Count <= Params.maxLeafSize)
+					return Node;
+
+				vec3 const Extent = CentroidMax - CentroidMin;
+				Axis = Extent.x >= Extent.y && Extent.x >= Extent.z ? 0 : (Extent.y >= Extent.z ? 1 : 2);
+				Mid = Begin + Count / 2;
+				centroid_less const Pred = {&Centroid[0], Axis};
+				std::nth_element(Indices.begin() + Begin, Indices.begin() + Mid, Indices.begin() + End, Pred);
+			}
+
+			Node->axis = static_cast<uint16>(Axis);
+
+			if(Depth < SpawnDepth && Count >= Params.parallelThreshold)
+			{
+				std::future<std::unique_ptr<bvh_build_node> > Left = std::async(std::launch::async, &bvh_builder::build, this, Begin, Mid, Depth + 1);
+				Node->children[1] = build(Mid, End, Depth + 1);
+				Node->children[0] = Left.get();
+			}
+			else
+			{
+				Node->children[0] = build(Begin, Mid, Depth + 1);
+				Node->children[1] = build(Mid, End, Depth + 1);
+			}
+
+			return Node;
+		}
+
+		struct centroid_bin_less
+		{
+			vec3 const * Centroid;
+			int Axis;
+			float Origin, Scale;
+			int BinCount, Bin;
+
+			GLM_FUNC_QUALIFIER bool operator()(uint32 Triangle) const
+			{
+				return glm::min(static_cast<int>((Centroid[Triangle][Axis] - Origin) * Scale), BinCount - 1) <= Bin;
+			}
+		};
+
+		struct centroid_less
+		{
+			vec3 const * Centroid;
+			int Axis;
+
+			GLM_FUNC_QUALIFIER bool operator()(uint32 a, uint32 b) const
+			{
+				return Centroid[a][Axis] < Centroid[b][Axis];
+			}
+		};
+	};
+
+	GLM_FUNC_QUALIFIER void bvh_flatten(bvh_build_node const & Node, std::vector<bvh_node> & Nodes, std::size_t Depth, std::size_t & MaxDepth)
+	{
+		MaxDepth = glm::max(MaxDepth, Depth);
+
+		std::size_t const Index = Nodes.size();
+		Nodes.push_back(bvh_node());
+		Nodes[Index].min = Node.min;
+		Nodes[Index].max = Node.max;
+		Nodes[Index].axis = Node.axis;
+
+		if(!Node.children[0])
+		{
+			Nodes[Index].offset = Node.begin;
+			Nodes[Index].count = static_cast<uint16>(Node.count);
+			return;
+		}
+
+		bvh_flatten(*Node.children[0], Nodes, Depth + 1, MaxDepth);
+		Nodes[Index].offset = static_cast<uint32>(Nodes.size());
+		Nodes[Index].count = 0;
+		bvh_flatten(*Node.children[1], Nodes, Depth + 1, MaxDepth);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER bvh_build_params::bvh_build_params() :
+		maxLeafSize(8),
+		binCount(16),
+		traversalCost(1.0f),
+		parallelThreshold(4096),
+		executor(0),
+		threadCount(0)
+	{}
+
+	GLM_FUNC_QUALIFIER bvh::bvh() :
+		Stride(0),
+		Depth(0)
+	{}
+
+	GLM_FUNC_QUALIFIER void bvh::build
+	(
+		vec3 const * Positions,
+		uint32 const * Indices,
+		std::size_t TriangleCount,
+		bvh_build_params const & Params
+	)
+	{
+		Nodes.clear();
+		Triangles.clear();
+		Data.clear();
+		Stride = 0;
+		Depth = 0;
+
+		if(TriangleCount == 0)
+			return;
+
+		detail::bvh_builder Builder;
+		Builder.Params = Params;
+		Builder.Params.maxLeafSize = glm::clamp<uint32>(Params.maxLeafSize, 1, 0xFFFF);
+		Builder.Min.resize(TriangleCount);
+		Builder.Max.resize(TriangleCount);
+		Builder.Centroid.resize(TriangleCount);
+		Builder.Indices.resize(TriangleCount);
+
+		parallel_options Options;
+		Options.executor = Params.executor;
+		Options.grain = 16384;
+		Options.threadCount = Params.threadCount;
+
+		// The top sub-trees are built on their own threads, one per thread
+		unsigned const ThreadCount = Params.threadCount > 0 ? Params.threadCount : (Params.executor ? *Params.executor : parallelDefaultExecutor()).concurrency();
+		Builder.SpawnDepth = 0;
+		while((static_cast<std::size_t>(1) << Builder.SpawnDepth) < ThreadCount)
+			++Builder.SpawnDepth;
+
+		parallelFor(TriangleCount, [&](std::size_t Begin, std::size_t End)
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				vec3 const & A = Positions[Indices ? Indices[i * 3 + 0] : i * 3 + 0];
+				vec3 const & B = Positions[Indices ? Indices[i * 3 + 1] : i * 3 + 1];
+				vec3 const & C = Positions[Indices ? Indices[i * 3 + 2] : i * 3 + 2];
+				Builder.Min[i] = glm::min(glm::min(A, B), C);
+				Builder.Max[i] = glm::max(glm::max(A, B), C);
+				Builder.Centroid[i] = (Builder.Min[i] + Builder.Max[i]) * 0.5f;
+				Builder.Indices[i] = static_cast<uint32>(i);
+			}
+		}, Options);
+
+		std::unique_ptr<detail::bvh_build_node> Root = Builder.build(0, static_cast<uint32>(TriangleCount), 0);
+
+		Nodes.reserve(TriangleCount * 2 / glm::max<uint32>(Builder.Params.maxLeafSize / 2, 1) + 1);
+		detail::bvh_flatten(*Root, Nodes, 0, Depth);
+		Root.reset();
+
+		// Store the reordered triangles as vertex 0 and two edges, the padding allows full width loads at the end of the last leaf
+		Triangles.swap(Builder.Indices);
+		Stride = TriangleCount + 8;
+		Data.assign(Stride * 9, 0.0f);
+		parallelFor(TriangleCount, [&](std::size_t Begin, std::size_t End)
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				std::size_t const Triangle = Triangles[i];
+				vec3 const & A = Positions[Indices ? Indices[Triangle * 3 + 0] : Triangle * 3 + 0];
+				vec3 const & B = Positions[Indices ? Indices[Triangle * 3 + 1] : Triangle * 3 + 1];
+				vec3 const & C = Positions[Indices ? Indices[Triangle * 3 + 2] : Triangle * 3 + 2];
+				vec3 const E1 = B - A;
+				vec3 const E2 = C - A;
+				for(length_t c = 0; c < 3; ++c)
+				{
+					Data[Stride * (0 + c) + i] = A[c];
+					Data[Stride * (3 + c) + i] = E1[c];
+					Data[Stride * (6 + c) + i] = E2[c];
+				}
+			}
+		}, Options);
+	}
+
+	GLM_FUNC_QUALIFIER float const * bvh::stream(std::size_t Index) const
+	{
+		return &Data[Stride * Index];
+	}
+
+	template <bool AnyHit>
+	GLM_FUNC_QUALIFIER bool bvh::traverse(vec3 const & Orig, vec3 const & Dir, float TMax, bvh_hit & Hit) const
+	{
+		typedef detail::bvh_simd_wide S;
+		typedef S::type real;
+
+		Hit.distance = TMax;
+		Hit.barycentric = vec2(0.0f);
+		Hit.triangle = invalid;
+
+		if(Nodes.empty())
+			return false;
+
+		vec3 const InvDir = vec3(1.0f) / Dir;
+		real const O[3] = {S::set1(Orig.x), S::set1(Orig.y), S::set1(Orig.z)};
+		real const D[3] = {S::set1(Dir.x), S::set1(Dir.y), S::set1(Dir.z)};
+		real const LaneIndex = S::lane_index();
+
+		uint32 Stack[128];
+		std::size_t StackSize = 0;
+		uint32 NodeIndex = 0;
+
+		for(;;)
+		{
+			bvh_node const & Node = Nodes[NodeIndex];
+			if(detail::bvh_intersect_box(Node, Orig, InvDir, Hit.distance))
+			{
+				if(Node.count == 0)
+				{
+					bool const Reverse = Dir[Node.axis] < 0.0f;
+					Stack[StackSize++] = Reverse ? NodeIndex + 1 : Node.offset;
+					NodeIndex = Reverse ? Node.offset : NodeIndex + 1;
+					continue;
+				}
+
+				for(uint32 i = 0; i < Node.count; i += S::lanes)
+				{
+					std::size_t const Base = Node.offset + i;
+					real const V0[3] = {S::load(stream(0) + Base), S::load(stream(1) + Base), S::load(stream(2) + Base)};
+					real const E1[3] = {S::load(stream(3) + Base), S::load(stream(4) + Base), S::load(stream(5) + Base)};
+					real const E2[3] = {S::load(stream(6) + Base), S::load(stream(7) + Base), S::load(stream(8) + Base)};
+
+					real Distance, U, V;
+					real Mask = detail::bvh_intersect_triangle<S>(O, D, V0, E1, E2, S::set1(Hit.distance), Distance, U, V);
+					Mask = S::and_(Mask, S::lt(LaneIndex, S::set1(static_cast<float>(Node.count - i))));
+
+					int const Bits = S::mask(Mask);
+					if(Bits == 0)
+						continue;
+
+					float Distances[S::lanes], Us[S::lanes], Vs[S::lanes];
+					S::store(Distances, Distance);
+					S::store(Us, U);
+					S::store(Vs, V);
+					for(int l = 0; l < S::lanes; ++l)
+					{
+						if(!(Bits & (1 << l)) || Distances[l] >= Hit.distance)
+							continue;
+						Hit.distance = Distances[l];
+						Hit.barycentric = vec2(Us[l], Vs[l]);
+						Hit.triangle = Triangles[Base + l];
+					}
+
+					if(AnyHit)
+						return true;
+				}
+			}
+
+			if(StackSize == 0)
+				break;
+			NodeIndex = Stack[--StackSize];
+		}
+
+		return Hit.triangle != invalid;
+	}
+
+	GLM_FUNC_QUALIFIER bool bvh::intersect(vec3 const & Orig, vec3 const & Dir, float TMax, bvh_hit & Hit) const
+	{
+		return traverse<false>(Orig, Dir, TMax, Hit);
+	}
+
+	GLM_FUNC_QUALIFIER bool bvh::occluded(vec3 const & Orig, vec3 const & Dir, float TMax) const
+	{
+		bvh_hit Hit;
+		return traverse<true>(Orig, Dir, TMax, Hit);
+	}
+
+	template <typename simdType>
+	GLM_FUNC_QUALIFIER void bvh::intersectPacket
+	(
+		float const * OrigX, float const * OrigY, float const * OrigZ,
+		float const * DirX, float const * DirY, float const * DirZ, float const * TMax,
+		float * Distance, float * U, float * V, uint32 * Triangle
+	) const
+	{
+		typedef simdType S;
+		typedef typename S::type real;
+
+		real const Zero = S::set1(0.0f);
+		real const One = S::set1(1.0f);
+		real const O[3] = {S::load(OrigX), S::load(OrigY), S::load(OrigZ)};
+		real const D[3] = {S::load(DirX), S::load(DirY), S::load(DirZ)};
+		real const InvD[3] = {S::div(One, D[0]), S::div(One, D[1]), S::div(One, D[2])};
+		real const Active = S::gt(S::load(TMax), Zero);
+
+		real Best = S::load(TMax);
+		real BestU = Zero;
+		real BestV = Zero;
+		for(int l = 0; l < S::lanes; ++l)
+			Triangle[l] = invalid;
+
+		// Visit order is chosen from the mean direction of the packet
+		vec3 MeanDir(0.0f);
+		for(int l = 0; l < S::lanes; ++l)
+			MeanDir += vec3(DirX[l], DirY[l], DirZ[l]);
+
+		if(!Nodes.empty() && S::mask(Active) != 0)
+		{
+			uint32 Stack[128];
+			std::size_t StackSize = 0;
+			uint32 NodeIndex = 0;
+
+			for(;;)
+			{
+				bvh_node const & Node = Nodes[NodeIndex];
+
+				real Near = Zero;
+				real Far = Best;
+				for(length_t a = 0; a < 3; ++a)
+				{
+					real const T0 = S::mul(S::sub(S::set1(Node.min[a]), O[a]), InvD[a]);
+					real const T1 = S::mul(S::sub(S::set1(Node.max[a]), O[a]), InvD[a]);
+					Near = S::max(Near, S::min(T0, T1));
+					Far = S::min(Far, S::max(T0, T1));
+				}
+
+				if(S::mask(S::and_(Active, S::le(Near, Far))) != 0)
+				{
+					if(Node.count == 0)
+					{
+						bool const Reverse = MeanDir[Node.axis] < 0.0f;
+						Stack[StackSize++] = Reverse ? NodeIndex + 1 : Node.offset;
+						NodeIndex = Reverse ? Node.offset : NodeIndex + 1;
+						continue;
+					}
+
+					for(uint32 i = Node.offset, n = Node.offset + Node.count; i < n; ++i)
+					{
+						real const V0[3] = {S::set1(stream(0)[i]), S::set1(stream(1)[i]), S::set1(stream(2)[i])};
+						real const E1[3] = {S::set1(stream(3)[i]), S::set1(stream(4)[i]), S::set1(stream(5)[i])};
+						real const E2[3] = {S::set1(stream(6)[i]), S::set1(stream(7)[i]), S::set1(stream(8)[i])};
+
+						real HitDistance, HitU, HitV;
+						real const Mask = detail::bvh_intersect_triangle<S>(O, D, V0, E1, E2, Best, HitDistance, HitU, HitV);
+						int const Bits = S::mask(Mask);
+						if(Bits == 0)
+							continue;
+
+						Best = S::select(Mask, HitDistance, Best);
+						BestU = S::select(Mask, HitU, BestU);
+						BestV = S::select(Mask, HitV, BestV);
+						for(int l = 0; l < S::lanes; ++l)
+							if(Bits & (1 << l))
+								Triangle[l] = Triangles[i];
+					}
+				}
+
+				if(StackSize == 0)
+					break;
+				NodeIndex = Stack[--StackSize];
+			}
+		}
+
+		S::store(Distance, Best);
+		S::store(U, BestU);
+		S::store(V, BestV);
+	}
+
+	GLM_FUNC_QUALIFIER void bvh::intersect(bvh_ray_packet<4> const & Rays, bvh_hit_packet<4> & Hits) const
+	{
+		intersectPacket<detail::bvh_simd_packet4>(
+			Rays.origX, Rays.origY, Rays.origZ, Rays.dirX, Rays.dirY, Rays.dirZ, Rays.tmax,
+			Hits.distance, Hits.u, Hits.v, Hits.triangle);
+	}
+
+	GLM_FUNC_QUALIFIER void bvh::intersect(bvh_ray_packet<8> const & Rays, bvh_hit_packet<8> & Hits) const
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			intersectPacket<detail::bvh_simd8>(
+				Rays.origX, Rays.origY, Rays.origZ, Rays.dirX, Rays.dirY, Rays.dirZ, Rays.tmax,
+				Hits.distance, Hits.u, Hits.v, Hits.triangle);
+#		else
+			for(std::size_t i = 0; i < 8; i += 4)
+				intersectPacket<detail::bvh_simd_packet4>(
+					Rays.origX + i, Rays.origY + i, Rays.origZ + i, Rays.dirX + i, Rays.dirY + i, Rays.dirZ + i, Rays.tmax + i,
+					Hits.distance + i, Hits.u + i, Hits.v + i, Hits.triangle + i);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER std::vector<bvh_node> const & bvh::nodes() const
+	{
+		return Nodes;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t bvh::triangleCount() const
+	{
+		return Triangles.size();
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t bvh::depth() const
+	{
+		return Depth;
+	}
+}//namespace glm
@@ -0,0 +1,78 @@
+/// @ref gtx_exponential_batch
+/// @file glm/gtx/exponential_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_exponential_batch GLM_GTX_exponential_batch
+/// @ingroup gtx
+///
+/// @brief Exponential functions of large arrays of floats.
+///
+/// Arrays are processed 8 floats at a time with AVX2 and 4 at a time with SSE2, using the same
+/// polynomial approximations as the exp, exp2, log, log2, pow and inversesqrt functions of the
+/// aligned_mediump and aligned_lowp vec4 types, aligned_highp vec4 keeps the results of the standard library.
+/// The last elements go through the same kernels, so results don't depend on the position in the array.
+/// Without SIMD the standard library functions are used.
+///
+/// Maximum errors measured over the whole float range:
+/// - exp and exp2: 2.5 ulp, exp2 of integers is exact
+/// - log and log2: 6 ulp, largest for x close to 1, log2 of powers of two is exact
+/// - inversesqrt: 4 ulp, 0 and denormals give +inf
+/// - pow: the error of log2 is scaled by the exponent. For x in [0, 1000]: 6 ulp for y = 0.5,
+///   40 ulp for y = 2.4, 90 ulp for y = 32 and 230 ulp for y = 128. x < 0 gives NaN.
+/// Like with the standard library, exp and exp2 overflow to inf and underflow to 0, log(0) is -inf
+/// and NaN is propagated.
+///
+/// <glm/gtx/exponential_batch.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_exponential_batch is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_exponential_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_exponential_batch
+	/// @{
+
+	/// Out[i] = exp(In[i]) for Count floats. In and Out may be the same array.
+	/// @see gtx_exponential_batch
+	GLM_FUNC_DECL void expBatch(std::size_t Count, float const * In, float * Out);
+
+	/// Out[i] = exp2(In[i]) for Count floats. In and Out may be the same array.
+	/// @see gtx_exponential_batch
+	GLM_FUNC_DECL void exp2Batch(std::size_t Count, float const * In, float * Out);
+
+	/// Out[i] = log(In[i]) for Count floats. In and Out may be the same array.
+	/// @see gtx_exponential_batch
+	GLM_FUNC_DECL void logBatch(std::size_t Count, float const * In, float * Out);
+
+	/// Out[i] = log2(In[i]) for Count floats. In and Out may be the same array.
+	/// @see gtx_exponential_batch
+	GLM_FUNC_DECL void log2Batch(std::size_t Count, float const * In, float * Out);
+
+	/// Out[i] = pow(Base[i], Exponent) for Count floats. Base and Out may be the same array.
+	/// @see gtx_exponential_batch
+	GLM_FUNC_DECL void powBatch(std::size_t Count, float const * Base, float Exponent, float * Out);
+
+	/// Out[i] = pow(Base[i], Exponent[i]) for Count floats. Out may be one of the input arrays.
+	/// @see gtx_exponential_batch
+	GLM_FUNC_DECL void powBatch(std::size_t Count, float const * Base, float const * Exponent, float * Out);
+
+	/// Out[i] = inversesqrt(In[i]) for Count floats. In and Out may be the same array.
+	/// @see gtx_exponential_batch
+	GLM_FUNC_DECL void inversesqrtBatch(std::size_t Count, float const * In, float * Out);
+
+	/// @}
+}//namespace glm
+
+#include "exponential_batch.inl"
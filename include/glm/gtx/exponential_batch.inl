@@ -0,0 +1,256 @@
+/// @ref gtx_exponential_batch
+/// @file glm/gtx/exponential_batch.inl
+
+#include <cmath>
+#include <cstring>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/exponential.h"
+#endif
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	// 8 floats versions of the functions of simd/exponential.h, with the same operations and results
+
+	GLM_FUNC_QUALIFIER __m256 exponential_fma_avx2(__m256 a, __m256 b, __m256 c)
+	{
+#		if GLM_HAS_FMA
+			return _mm256_fmadd_ps(a, b, c);
+#		else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER __m256 exponential_inversesqrt_avx2(__m256 x)
+	{
+		__m256 const isr0 = _mm256_rsqrt_ps(x);
+		__m256 const mul0 = _mm256_mul_ps(_mm256_mul_ps(x, _mm256_set1_ps(0.5f)), _mm256_mul_ps(isr0, isr0));
+		__m256 const nwt0 = _mm256_mul_ps(isr0, _mm256_sub_ps(_mm256_set1_ps(1.5f), mul0));
+		__m256 const spc0 = _mm256_or_ps(
+			_mm256_cmp_ps(isr0, _mm256_setzero_ps(), _CMP_EQ_OQ),
+			_mm256_cmp_ps(isr0, _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000)), _CMP_EQ_OQ));
+		return _mm256_blendv_ps(nwt0, isr0, spc0);
+	}
+
+	GLM_FUNC_QUALIFIER __m256 exponential_log2_avx2(__m256 x)
+	{
+		__m256 const den0 = _mm256_cmp_ps(x, _mm256_set1_ps(1.17549435e-38f), _CMP_LT_OQ);
+		__m256 const scl0 = _mm256_blendv_ps(x, _mm256_mul_ps(x, _mm256_set1_ps(8388608.0f)), den0);
+		__m256i const bit0 = _mm256_castps_si256(scl0);
+		__m256 const man0 = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bit0, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+		__m256 const ept0 = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bit0, 23), _mm256_set1_epi32(127)));
+		__m256 const ept1 = _mm256_sub_ps(ept0, _mm256_and_ps(den0, _mm256_set1_ps(23.0f)));
+
+		__m256 const ovr0 = _mm256_cmp_ps(man0, _mm256_set1_ps(1.41421356f), _CMP_GE_OQ);
+		__m256 const man1 = _mm256_sub_ps(man0, _mm256_and_ps(ovr0, _mm256_mul_ps(man0, _mm256_set1_ps(0.5f))));
+		__m256 const ept2 = _mm256_add_ps(ept1, _mm256_and_ps(ovr0, _mm256_set1_ps(1.0f)));
+
+		__m256 const one0 = _mm256_set1_ps(1.0f);
+		__m256 const t = _mm256_div_ps(_mm256_sub_ps(man1, one0), _mm256_add_ps(man1, one0));
+		__m256 const u = _mm256_mul_ps(t, t);
+		__m256 const pol0 = exponential_fma_avx2(u, _mm256_set1_ps(0.5957965146f), _mm256_set1_ps(0.9615878611f));
+		__m256 const pol1 = exponential_fma_avx2(pol0, u, _mm256_set1_ps(2.8853904259f));
+		__m256 const res0 = exponential_fma_avx2(pol1, t, ept2);
+
+		__m256 const zer0 = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_EQ_OQ);
+		__m256 const inf0 = _mm256_cmp_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000)), _CMP_EQ_OQ);
+		__m256 const nan0 = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_NGE_UQ);
+		__m256 const res1 = _mm256_blendv_ps(res0, _mm256_castsi256_ps(_mm256_set1_epi32(0xFF800000)), zer0);
+		__m256 const res2 = _mm256_blendv_ps(res1, x, inf0);
+		return _mm256_or_ps(res2, nan0);
+	}
+
+	GLM_FUNC_QUALIFIER __m256 exponential_exp2_reduced_avx2(__m256i n, __m256 f)
+	{
+		__m256 const pol0 = exponential_fma_avx2(f, _mm256_set1_ps(0.0013264729f), _mm256_set1_ps(0.0096715132f));
+		__m256 const pol1 = exponential_fma_avx2(pol0, f, _mm256_set1_ps(0.0555073374f));
+		__m256 const pol2 = exponential_fma_avx2(pol1, f, _mm256_set1_ps(0.2402224208f));
+		__m256 const pol3 = exponential_fma_avx2(pol2, f, _mm256_set1_ps(0.6931469776f));
+		__m256 const pol4 = exponential_fma_avx2(pol3, f, _mm256_set1_ps(1.0f));
+
+		__m256i const n1 = _mm256_srai_epi32(n, 1);
+		__m256i const n2 = _mm256_sub_epi32(n, n1);
+		__m256 const scl1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n1, _mm256_set1_epi32(127)), 23));
+		__m256 const scl2 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n2, _mm256_set1_epi32(127)), 23));
+		return _mm256_mul_ps(_mm256_mul_ps(pol4, scl1), scl2);
+	}
+
+	GLM_FUNC_QUALIFIER __m256 exponential_exp2_avx2(__m256 x)
+	{
+		__m256 const clp0 = _mm256_min_ps(_mm256_set1_ps(160.0f), _mm256_max_ps(_mm256_set1_ps(-160.0f), x));
+		__m256i const n = _mm256_cvtps_epi32(clp0);
+		__m256 const f = _mm256_sub_ps(clp0, _mm256_cvtepi32_ps(n));
+		return exponential_exp2_reduced_avx2(n, f);
+	}
+
+	GLM_FUNC_QUALIFIER __m256 exponential_exp_avx2(__m256 x)
+	{
+		__m256 const clp0 = _mm256_min_ps(_mm256_set1_ps(112.0f), _mm256_max_ps(_mm256_set1_ps(-112.0f), x));
+		__m256i const n = _mm256_cvtps_epi32(_mm256_mul_ps(clp0, _mm256_set1_ps(1.44269504f)));
+		__m256 const flt0 = _mm256_cvtepi32_ps(n);
+		__m256 const r0 = _mm256_sub_ps(clp0, _mm256_mul_ps(flt0, _mm256_set1_ps(0.693359375f)));
+		__m256 const r1 = _mm256_sub_ps(r0, _mm256_mul_ps(flt0, _mm256_set1_ps(-2.12194440e-4f)));
+		return exponential_exp2_reduced_avx2(n, _mm256_mul_ps(r1, _mm256_set1_ps(1.44269504f)));
+	}
+
+	GLM_FUNC_QUALIFIER __m256 exponential_pow_avx2(__m256 x, __m256 y)
+	{
+		__m256 const mul0 = _mm256_mul_ps(y, exponential_log2_avx2(x));
+		__m256 const mul1 = _mm256_and_ps(_mm256_cmp_ps(y, _mm256_setzero_ps(), _CMP_NEQ_UQ), mul0);
+		return exponential_exp2_avx2(mul1);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	// Kernels take the elements of the input and argument arrays
+	struct exponential_exp
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			GLM_FUNC_QUALIFIER __m256 operator()(__m256 x, __m256) const {return exponential_exp_avx2(x);}
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 operator()(glm_vec4 x, glm_vec4) const {return glm_vec4_exp(x);}
+#		endif
+		GLM_FUNC_QUALIFIER float operator()(float x, float) const {return std::exp(x);}
+	};
+
+	struct exponential_exp2
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			GLM_FUNC_QUALIFIER __m256 operator()(__m256 x, __m256) const {return exponential_exp2_avx2(x);}
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 operator()(glm_vec4 x, glm_vec4) const {return glm_vec4_exp2(x);}
+#		endif
+		GLM_FUNC_QUALIFIER float operator()(float x, float) const {return glm::exp2(x);}
+	};
+
+	struct exponential_log
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			GLM_FUNC_QUALIFIER __m256 operator()(__m256 x, __m256) const {return _mm256_mul_ps(exponential_log2_avx2(x), _mm256_set1_ps(0.693147181f));}
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 operator()(glm_vec4 x, glm_vec4) const {return glm_vec4_log(x);}
+#		endif
+		GLM_FUNC_QUALIFIER float operator()(float x, float) const {return std::log(x);}
+	};
+
+	struct exponential_log2
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			GLM_FUNC_QUALIFIER __m256 operator()(__m256 x, __m256) const {return exponential_log2_avx2(x);}
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 operator()(glm_vec4 x, glm_vec4) const {return glm_vec4_log2(x);}
+#		endif
+		GLM_FUNC_QUALIFIER float operator()(float x, float) const {return glm::log2(x);}
+	};
+
+	struct exponential_pow
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			GLM_FUNC_QUALIFIER __m256 operator()(__m256 x, __m256 y) const {return exponential_pow_avx2(x, y);}
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 operator()(glm_vec4 x, glm_vec4 y) const {return glm_vec4_pow(x, y);}
+#		endif
+		GLM_FUNC_QUALIFIER float operator()(float x, float y) const {return std::pow(x, y);}
+	};
+
+	struct exponential_inversesqrt
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			GLM_FUNC_QUALIFIER __m256 operator()(__m256 x, __m256) const {return exponential_inversesqrt_avx2(x);}
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 operator()(glm_vec4 x, glm_vec4) const {return glm_vec4_inversesqrt(x);}
+#		endif
+		GLM_FUNC_QUALIFIER float operator()(float x, float) const {return 1.0f / std::sqrt(x);}
+	};
+
+	// Arg is null for the functions of one argument, Step is 0 when the argument is the same for all elements
+	template <typename kernel>
+	GLM_FUNC_QUALIFIER void exponential_batch(std::size_t Count, float const * In, float const * Arg, std::size_t Step, float * Out, kernel const & Kernel)
+	{
+		std::size_t i = 0;
+
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			if(Step)
+				for(; i + 8 <= Count; i += 8)
+					_mm256_storeu_ps(Out + i, Kernel(_mm256_loadu_ps(In + i), _mm256_loadu_ps(Arg + i)));
+			else
+			{
+				__m256 const y = _mm256_set1_ps(Arg ? *Arg : 0.0f);
+				for(; i + 8 <= Count; i += 8)
+					_mm256_storeu_ps(Out + i, Kernel(_mm256_loadu_ps(In + i), y));
+			}
+#		endif
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Step)
+				for(; i + 4 <= Count; i += 4)
+					_mm_storeu_ps(Out + i, Kernel(_mm_loadu_ps(In + i), _mm_loadu_ps(Arg + i)));
+			else
+			{
+				glm_vec4 const y = _mm_set1_ps(Arg ? *Arg : 0.0f);
+				for(; i + 4 <= Count; i += 4)
+					_mm_storeu_ps(Out + i, Kernel(_mm_loadu_ps(In + i), y));
+			}
+
+			if(i < Count)
+			{
+				// The last elements go through the same kernel
+				std::size_t const Size = (Count - i) * sizeof(float);
+				float x[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+				float y[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+				std::memcpy(x, In + i, Size);
+				for(std::size_t j = 0; Arg && j < Count - i; ++j)
+					y[j] = Arg[(i + j) * Step];
+				float r[4];
+				_mm_storeu_ps(r, Kernel(_mm_loadu_ps(x), _mm_loadu_ps(y)));
+				std::memcpy(Out + i, r, Size);
+			}
+#		else
+			for(; i < Count; ++i)
+				Out[i] = Kernel(In[i], Arg ? Arg[i * Step] : 0.0f);
+#		endif
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void expBatch(std::size_t Count, float const * In, float * Out)
+	{
+		detail::exponential_batch(Count, In, static_cast<float const *>(NULL), 0, Out, detail::exponential_exp());
+	}
+
+	GLM_FUNC_QUALIFIER void exp2Batch(std::size_t Count, float const * In, float * Out)
+	{
+		detail::exponential_batch(Count, In, static_cast<float const *>(NULL), 0, Out, detail::exponential_exp2());
+	}
+
+	GLM_FUNC_QUALIFIER void logBatch(std::size_t Count, float const * In, float * Out)
+	{
+		detail::exponential_batch(Count, In, static_cast<float const *>(NULL), 0, Out, detail::exponential_log());
+	}
+
+	GLM_FUNC_QUALIFIER void log2Batch(std::size_t Count, float const * In, float * Out)
+	{
+		detail::exponential_batch(Count, In, static_cast<float const *>(NULL), 0, Out, detail::exponential_log2());
+	}
+
+	GLM_FUNC_QUALIFIER void powBatch(std::size_t Count, float const * Base, float Exponent, float * Out)
+	{
+		detail::exponential_batch(Count, Base, &Exponent, 0, Out, detail::exponential_pow());
+	}
+
+	GLM_FUNC_QUALIFIER void powBatch(std::size_t Count, float const * Base, float const * Exponent, float * Out)
+	{
+		detail::exponential_batch(Count, Base, Exponent, 1, Out, detail::exponential_pow());
+	}
+
+	GLM_FUNC_QUALIFIER void inversesqrtBatch(std::size_t Count, float const * In, float * Out)
+	{
+		detail::exponential_batch(Count, In, static_cast<float const *>(NULL), 0, Out, detail::exponential_inversesqrt());
+	}
+}//namespace glm
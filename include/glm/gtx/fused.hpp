@@ -0,0 +1,296 @@
+/// @ref gtx_fused
+/// @file glm/gtx/fused.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_fused GLM_GTX_fused
+/// @ingroup gtx
+///
+/// @brief Expression templates evaluating chains of vector arithmetic at once, using fused multiply-add.
+///
+/// Wrapping an operand with fused() makes the operators build an expression instead of computing a
+/// temporary vector for each operation. The expression is evaluated when it is converted to a vector,
+/// a * b + c, c + a * b, a * b - c and c - a * b are evaluated with a single fused multiply-add.
+/// Operators only build an expression when one of their operands is an expression:
+/// in fused(a) * b + c * d, c * d is computed by the regular operators, fused(c) * d is fused.
+///
+/// Fused multiply-adds are rounded once, so results may differ in the last bit from the regular operators.
+/// The FMA instructions are used for aligned vec4 and vec3 of floats when GLM_HAS_FMA is set,
+/// for example with -mfma or -march=haswell. fused() of any other vector, the default packed vec4
+/// included, returns the vector itself: its regular operators are computed component by component,
+/// which the compiler vectorizes and contracts to fused multiply-adds where allowed, and an expression
+/// would only hide the arithmetic from it.
+///
+/// fused() of a pointer to an array of vectors makes an expression that fusedBatch() evaluates
+/// for each element of the array in a single pass:
+/// @code
+/// glm::fusedBatch(Count, glm::fused(Positions) + glm::fused(Velocities) * DeltaTime, Positions);
+/// @endcode
+///
+/// Expressions keep references to the vectors and copies of the scalars and pointers they were built
+/// from, so that building them copies no vector. They must be evaluated in the statement that builds them.
+///
+/// <glm/gtx/fused.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_fused is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_fused extension included")
+#endif
+
+namespace glm{
+	template <typename E>
+	struct fused_expr;
+
+namespace detail
+{
+	template <typename V>
+	struct fused_value
+	{
+		typedef V value_type;
+
+		GLM_FUNC_QUALIFIER explicit fused_value(V const & v) : Value(v) {}
+
+		V const & Value;
+	};
+
+	template <typename V>
+	struct fused_scalar
+	{
+		typedef V value_type;
+
+		GLM_FUNC_QUALIFIER explicit fused_scalar(typename V::value_type s) : Value(s) {}
+
+		typename V::value_type Value;
+	};
+
+	template <typename V>
+	struct fused_array
+	{
+		typedef V value_type;
+
+		GLM_FUNC_QUALIFIER explicit fused_array(V const * p) : Data(p) {}
+
+		V const * Data;
+	};
+
+	template <typename A, typename B>
+	struct fused_add
+	{
+		typedef typename A::value_type value_type;
+
+		GLM_FUNC_QUALIFIER fused_add(A const & x, B const & y) : a(x), b(y) {}
+
+		A a;
+		B b;
+	};
+
+	template <typename A, typename B>
+	struct fused_sub
+	{
+		typedef typename A::value_type value_type;
+
+		GLM_FUNC_QUALIFIER fused_sub(A const & x, B const & y) : a(x), b(y) {}
+
+		A a;
+		B b;
+	};
+
+	template <typename A, typename B>
+	struct fused_mul
+	{
+		typedef typename A::value_type value_type;
+
+		GLM_FUNC_QUALIFIER fused_mul(A const & x, B const & y) : a(x), b(y) {}
+
+		A a;
+		B b;
+	};
+
+	template <typename A, typename B>
+	struct fused_div
+	{
+		typedef typename A::value_type value_type;
+
+		GLM_FUNC_QUALIFIER fused_div(A const & x, B const & y) : a(x), b(y) {}
+
+		A a;
+		B b;
+	};
+
+	template <typename A>
+	struct fused_neg
+	{
+		typedef typename A::value_type value_type;
+
+		GLM_FUNC_QUALIFIER explicit fused_neg(A const & x) : a(x) {}
+
+		A a;
+	};
+
+	// Vector operand of an operator with an expression
+	template <typename E>
+	struct fused_leaf
+	{
+		typedef fused_value<typename E::value_type> type;
+	};
+
+	// Scalar operand of an operator with an expression
+	template <typename E>
+	struct fused_scalar_leaf
+	{
+		typedef fused_scalar<typename E::value_type> type;
+	};
+
+	template <typename V, bool Expression>
+	struct fused_vector_select
+	{
+		typedef V const & type;
+
+		GLM_FUNC_QUALIFIER static type call(V const & v)
+		{
+			return v;
+		}
+	};
+
+	template <typename V>
+	struct fused_vector_select<V, true>
+	{
+		typedef fused_expr<fused_value<V> > type;
+
+		GLM_FUNC_QUALIFIER static type call(V const & v)
+		{
+			return type(fused_value<V>(v));
+		}
+	};
+
+	// fused() only builds an expression for the vectors computed with FMA instructions
+	template <typename V>
+	struct fused_vector : public fused_vector_select<V, false>
+	{};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template <precision P>
+	struct fused_vector<tvec4<float, P> > : public fused_vector_select<tvec4<float, P>, is_aligned<P>::value>
+	{};
+
+	template <precision P>
+	struct fused_vector<tvec3<float, P> > : public fused_vector_select<tvec3<float, P>, is_aligned<P>::value>
+	{};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+
+	/// @addtogroup gtx_fused
+	/// @{
+
+	/// Expression built by fused() and by the operators of expressions.
+	/// @see gtx_fused
+	template <typename E>
+	struct fused_expr
+	{
+		typedef typename E::value_type value_type;
+
+		GLM_FUNC_DECL explicit fused_expr(E const & e);
+
+		/// Value of the expression, using the elements of index i of the arrays it was built from.
+		GLM_FUNC_DECL value_type eval(std::size_t i) const;
+
+		/// Value of the expression, using the first element of the arrays it was built from.
+		GLM_FUNC_DECL operator value_type() const;
+
+		E Expr;
+	};
+
+	/// Expression of an aligned vec4 or vec3 of floats, v itself for the other vectors.
+	/// @see gtx_fused
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL typename detail::fused_vector<vecType<T, P> >::type fused(vecType<T, P> const & v);
+
+	/// Expression of the elements of an array of vectors, evaluated by fusedBatch().
+	/// @see gtx_fused
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL fused_expr<detail::fused_array<vecType<T, P> > > fused(vecType<T, P> const * Array);
+
+	/// Out[i] = Expression.eval(i) for Count vectors. Out may be one of the arrays of the expression.
+	/// @see gtx_fused
+	template <typename E>
+	GLM_FUNC_DECL void fusedBatch(std::size_t Count, fused_expr<E> const & Expression, typename E::value_type * Out);
+
+	/// Operators of an expression with an expression, a vector or a scalar. They build the expression, evaluated
+	/// when it is converted to a vector.
+	/// @see gtx_fused
+	template <typename A, typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_add<A, B> > operator+(fused_expr<A> const & a, fused_expr<B> const & b);
+
+	template <typename A>
+	GLM_FUNC_DECL fused_expr<detail::fused_add<A, typename detail::fused_leaf<A>::type> > operator+(fused_expr<A> const & a, typename A::value_type const & b);
+
+	template <typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_add<typename detail::fused_leaf<B>::type, B> > operator+(typename B::value_type const & a, fused_expr<B> const & b);
+
+	template <typename A>
+	GLM_FUNC_DECL fused_expr<detail::fused_add<A, typename detail::fused_scalar_leaf<A>::type> > operator+(fused_expr<A> const & a, typename A::value_type::value_type b);
+
+	template <typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_add<typename detail::fused_scalar_leaf<B>::type, B> > operator+(typename B::value_type::value_type a, fused_expr<B> const & b);
+
+	template <typename A, typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_sub<A, B> > operator-(fused_expr<A> const & a, fused_expr<B> const & b);
+
+	template <typename A>
+	GLM_FUNC_DECL fused_expr<detail::fused_sub<A, typename detail::fused_leaf<A>::type> > operator-(fused_expr<A> const & a, typename A::value_type const & b);
+
+	template <typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_sub<typename detail::fused_leaf<B>::type, B> > operator-(typename B::value_type const & a, fused_expr<B> const & b);
+
+	template <typename A>
+	GLM_FUNC_DECL fused_expr<detail::fused_sub<A, typename detail::fused_scalar_leaf<A>::type> > operator-(fused_expr<A> const & a, typename A::value_type::value_type b);
+
+	template <typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_sub<typename detail::fused_scalar_leaf<B>::type, B> > operator-(typename B::value_type::value_type a, fused_expr<B> const & b);
+
+	template <typename A, typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_mul<A, B> > operator*(fused_expr<A> const & a, fused_expr<B> const & b);
+
+	template <typename A>
+	GLM_FUNC_DECL fused_expr<detail::fused_mul<A, typename detail::fused_leaf<A>::type> > operator*(fused_expr<A> const & a, typename A::value_type const & b);
+
+	template <typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_mul<typename detail::fused_leaf<B>::type, B> > operator*(typename B::value_type const & a, fused_expr<B> const & b);
+
+	template <typename A>
+	GLM_FUNC_DECL fused_expr<detail::fused_mul<A, typename detail::fused_scalar_leaf<A>::type> > operator*(fused_expr<A> const & a, typename A::value_type::value_type b);
+
+	template <typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_mul<typename detail::fused_scalar_leaf<B>::type, B> > operator*(typename B::value_type::value_type a, fused_expr<B> const & b);
+
+	template <typename A, typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_div<A, B> > operator/(fused_expr<A> const & a, fused_expr<B> const & b);
+
+	template <typename A>
+	GLM_FUNC_DECL fused_expr<detail::fused_div<A, typename detail::fused_leaf<A>::type> > operator/(fused_expr<A> const & a, typename A::value_type const & b);
+
+	template <typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_div<typename detail::fused_leaf<B>::type, B> > operator/(typename B::value_type const & a, fused_expr<B> const & b);
+
+	template <typename A>
+	GLM_FUNC_DECL fused_expr<detail::fused_div<A, typename detail::fused_scalar_leaf<A>::type> > operator/(fused_expr<A> const & a, typename A::value_type::value_type b);
+
+	template <typename B>
+	GLM_FUNC_DECL fused_expr<detail::fused_div<typename detail::fused_scalar_leaf<B>::type, B> > operator/(typename B::value_type::value_type a, fused_expr<B> const & b);
+
+	template <typename A>
+	GLM_FUNC_DECL fused_expr<detail::fused_neg<A> > operator-(fused_expr<A> const & a);
+
+	/// @}
+}//namespace glm
+
+#include "fused.inl"
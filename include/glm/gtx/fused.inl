@@ -0,0 +1,445 @@
+/// @ref gtx_fused
+/// @file glm/gtx/fused.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/common.h"
+#endif
+
+namespace glm{
+namespace detail
+{
+	template <typename V>
+	struct fused_is_aligned
+	{
+		static bool const value = false;
+	};
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	struct fused_is_aligned<vecType<T, P> >
+	{
+		static bool const value = is_aligned<P>::value;
+	};
+
+	template <typename V, bool Aligned>
+	struct compute_fused_fma
+	{
+		GLM_FUNC_QUALIFIER static V call(V const & a, V const & b, V const & c)
+		{
+			return a * b + c;
+		}
+	};
+
+	template <typename V, bool Aligned>
+	struct compute_fused_fms
+	{
+		GLM_FUNC_QUALIFIER static V call(V const & a, V const & b, V const & c)
+		{
+			return a * b - c;
+		}
+	};
+
+	template <typename V, bool Aligned>
+	struct compute_fused_fnma
+	{
+		GLM_FUNC_QUALIFIER static V call(V const & a, V const & b, V const & c)
+		{
+			return c - a * b;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template <precision P>
+	struct compute_fused_fma<tvec4<float, P>, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b, tvec4<float, P> const & c)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fma(a.data, b.data, c.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fused_fma<tvec3<float, P>, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b, tvec3<float, P> const & c)
+		{
+			tvec3<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fma(a.data, b.data, c.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fused_fms<tvec4<float, P>, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b, tvec4<float, P> const & c)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fms(a.data, b.data, c.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fused_fms<tvec3<float, P>, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b, tvec3<float, P> const & c)
+		{
+			tvec3<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fms(a.data, b.data, c.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fused_fnma<tvec4<float, P>, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b, tvec4<float, P> const & c)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fnma(a.data, b.data, c.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fused_fnma<tvec3<float, P>, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b, tvec3<float, P> const & c)
+		{
+			tvec3<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fnma(a.data, b.data, c.data);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	template <typename E>
+	struct fused_eval;
+
+	template <typename V>
+	struct fused_eval<fused_value<V> >
+	{
+		GLM_FUNC_QUALIFIER static V call(fused_value<V> const & e, std::size_t)
+		{
+			return e.Value;
+		}
+	};
+
+	template <typename V>
+	struct fused_eval<fused_scalar<V> >
+	{
+		GLM_FUNC_QUALIFIER static V call(fused_scalar<V> const & e, std::size_t)
+		{
+			return V(e.Value);
+		}
+	};
+
+	template <typename V>
+	struct fused_eval<fused_array<V> >
+	{
+		GLM_FUNC_QUALIFIER static V call(fused_array<V> const & e, std::size_t i)
+		{
+			return e.Data[i];
+		}
+	};
+
+	template <typename A, typename B>
+	struct fused_eval<fused_add<A, B> >
+	{
+		GLM_FUNC_QUALIFIER static typename A::value_type call(fused_add<A, B> const & e, std::size_t i)
+		{
+			return fused_eval<A>::call(e.a, i) + fused_eval<B>::call(e.b, i);
+		}
+	};
+
+	template <typename A, typename B>
+	struct fused_eval<fused_sub<A, B> >
+	{
+		GLM_FUNC_QUALIFIER static typename A::value_type call(fused_sub<A, B> const & e, std::size_t i)
+		{
+			return fused_eval<A>::call(e.a, i) - fused_eval<B>::call(e.b, i);
+		}
+	};
+
+	template <typename A, typename B>
+	struct fused_eval<fused_mul<A, B> >
+	{
+		GLM_FUNC_QUALIFIER static typename A::value_type call(fused_mul<A, B> const & e, std::size_t i)
+		{
+			return fused_eval<A>::call(e.a, i) * fused_eval<B>::call(e.b, i);
+		}
+	};
+
+	template <typename A, typename B>
+	struct fused_eval<fused_div<A, B> >
+	{
+		GLM_FUNC_QUALIFIER static typename A::value_type call(fused_div<A, B> const & e, std::size_t i)
+		{
+			return fused_eval<A>::call(e.a, i) / fused_eval<B>::call(e.b, i);
+		}
+	};
+
+	template <typename A>
+	struct fused_eval<fused_neg<A> >
+	{
+		GLM_FUNC_QUALIFIER static typename A::value_type call(fused_neg<A> const & e, std::size_t i)
+		{
+			return -fused_eval<A>::call(e.a, i);
+		}
+	};
+
+	// a * b + c, c + a * b, a * b - c and c - a * b are computed with a fused multiply-add.
+	// When both operands are products, the second one is computed first.
+	template <typename A, typename B, typename C>
+	struct fused_eval<fused_add<fused_mul<A, B>, C> >
+	{
+		typedef typename A::value_type value_type;
+
+		GLM_FUNC_QUALIFIER static value_type call(fused_add<fused_mul<A, B>, C> const & e, std::size_t i)
+		{
+			return compute_fused_fma<value_type, fused_is_aligned<value_type>::value>::call(
+				fused_eval<A>::call(e.a.a, i), fused_eval<B>::call(e.a.b, i), fused_eval<C>::call(e.b, i));
+		}
+	};
+
+	template <typename A, typename B, typename C>
+	struct fused_eval<fused_add<C, fused_mul<A, B> > >
+	{
+		typedef typename A::value_type value_type;
+
+		GLM_FUNC_QUALIFIER static value_type call(fused_add<C, fused_mul<A, B> > const & e, std::size_t i)
+		{
+			return compute_fused_fma<value_type, fused_is_aligned<value_type>::value>::call(
+				fused_eval<A>::call(e.b.a, i), fused_eval<B>::call(e.b.b, i), fused_eval<C>::call(e.a, i));
+		}
+	};
+
+	template <typename A, typename B, typename C, typename D>
+	struct fused_eval<fused_add<fused_mul<A, B>, fused_mul<C, D> > >
+	{
+		typedef typename A::value_type value_type;
+
+		GLM_FUNC_QUALIFIER static value_type call(fused_add<fused_mul<A, B>, fused_mul<C, D> > const & e, std::size_t i)
+		{
+			return compute_fused_fma<value_type, fused_is_aligned<value_type>::value>::call(
+				fused_eval<A>::call(e.a.a, i), fused_eval<B>::call(e.a.b, i), fused_eval<fused_mul<C, D> >::call(e.b, i));
+		}
+	};
+
+	template <typename A, typename B, typename C>
+	struct fused_eval<fused_sub<fused_mul<A, B>, C> >
+	{
+		typedef typename A::value_type value_type;
+
+		GLM_FUNC_QUALIFIER static value_type call(fused_sub<fused_mul<A, B>, C> const & e, std::size_t i)
+		{
+			return compute_fused_fms<value_type, fused_is_aligned<value_type>::value>::call(
+				fused_eval<A>::call(e.a.a, i), fused_eval<B>::call(e.a.b, i), fused_eval<C>::call(e.b, i));
+		}
+	};
+
+	template <typename A, typename B, typename C>
+	struct fused_eval<fused_sub<C, fused_mul<A, B> > >
+	{
+		typedef typename A::value_type value_type;
+
+		GLM_FUNC_QUALIFIER static value_type call(fused_sub<C, fused_mul<A, B> > const & e, std::size_t i)
+		{
+			return compute_fused_fnma<value_type, fused_is_aligned<value_type>::value>::call(
+				fused_eval<A>::call(e.b.a, i), fused_eval<B>::call(e.b.b, i), fused_eval<C>::call(e.a, i));
+		}
+	};
+
+	template <typename A, typename B, typename C, typename D>
+	struct fused_eval<fused_sub<fused_mul<A, B>, fused_mul<C, D> > >
+	{
+		typedef typename A::value_type value_type;
+
+		GLM_FUNC_QUALIFIER static value_type call(fused_sub<fused_mul<A, B>, fused_mul<C, D> > const & e, std::size_t i)
+		{
+			return compute_fused_fms<value_type, fused_is_aligned<value_type>::value>::call(
+				fused_eval<A>::call(e.a.a, i), fused_eval<B>::call(e.a.b, i), fused_eval<fused_mul<C, D> >::call(e.b, i));
+		}
+	};
+}//namespace detail
+
+	template <typename E>
+	GLM_FUNC_QUALIFIER fused_expr<E>::fused_expr(E const & e) :
+		Expr(e)
+	{}
+
+	template <typename E>
+	GLM_FUNC_QUALIFIER typename fused_expr<E>::value_type fused_expr<E>::eval(std::size_t i) const
+	{
+		return detail::fused_eval<E>::call(Expr, i);
+	}
+
+	template <typename E>
+	GLM_FUNC_QUALIFIER fused_expr<E>::operator value_type() const
+	{
+		return detail::fused_eval<E>::call(Expr, 0);
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::fused_vector<vecType<T, P> >::type fused(vecType<T, P> const & v)
+	{
+		return detail::fused_vector<vecType<T, P> >::call(v);
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_array<vecType<T, P> > > fused(vecType<T, P> const * Array)
+	{
+		return fused_expr<detail::fused_array<vecType<T, P> > >(detail::fused_array<vecType<T, P> >(Array));
+	}
+
+	template <typename E>
+	GLM_FUNC_QUALIFIER void fusedBatch(std::size_t Count, fused_expr<E> const & Expression, typename E::value_type * Out)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = detail::fused_eval<E>::call(Expression.Expr, i);
+	}
+
+	template <typename A, typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_add<A, B> > operator+(fused_expr<A> const & a, fused_expr<B> const & b)
+	{
+		return fused_expr<detail::fused_add<A, B> >(detail::fused_add<A, B>(a.Expr, b.Expr));
+	}
+
+	template <typename A>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_add<A, typename detail::fused_leaf<A>::type> > operator+(fused_expr<A> const & a, typename A::value_type const & b)
+	{
+		typedef typename detail::fused_leaf<A>::type leaf;
+		return fused_expr<detail::fused_add<A, leaf> >(detail::fused_add<A, leaf>(a.Expr, leaf(b)));
+	}
+
+	template <typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_add<typename detail::fused_leaf<B>::type, B> > operator+(typename B::value_type const & a, fused_expr<B> const & b)
+	{
+		typedef typename detail::fused_leaf<B>::type leaf;
+		return fused_expr<detail::fused_add<leaf, B> >(detail::fused_add<leaf, B>(leaf(a), b.Expr));
+	}
+
+	template <typename A>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_add<A, typename detail::fused_scalar_leaf<A>::type> > operator+(fused_expr<A> const & a, typename A::value_type::value_type b)
+	{
+		typedef typename detail::fused_scalar_leaf<A>::type leaf;
+		return fused_expr<detail::fused_add<A, leaf> >(detail::fused_add<A, leaf>(a.Expr, leaf(b)));
+	}
+
+	template <typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_add<typename detail::fused_scalar_leaf<B>::type, B> > operator+(typename B::value_type::value_type a, fused_expr<B> const & b)
+	{
+		typedef typename detail::fused_scalar_leaf<B>::type leaf;
+		return fused_expr<detail::fused_add<leaf, B> >(detail::fused_add<leaf, B>(leaf(a), b.Expr));
+	}
+
+	template <typename A, typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_sub<A, B> > operator-(fused_expr<A> const & a, fused_expr<B> const & b)
+	{
+		return fused_expr<detail::fused_sub<A, B> >(detail::fused_sub<A, B>(a.Expr, b.Expr));
+	}
+
+	template <typename A>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_sub<A, typename detail::fused_leaf<A>::type> > operator-(fused_expr<A> const & a, typename A::value_type const & b)
+	{
+		typedef typename detail::fused_leaf<A>::type leaf;
+		return fused_expr<detail::fused_sub<A, leaf> >(detail::fused_sub<A, leaf>(a.Expr, leaf(b)));
+	}
+
+	template <typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_sub<typename detail::fused_leaf<B>::type, B> > operator-(typename B::value_type const & a, fused_expr<B> const & b)
+	{
+		typedef typename detail::fused_leaf<B>::type leaf;
+		return fused_expr<detail::fused_sub<leaf, B> >(detail::fused_sub<leaf, B>(leaf(a), b.Expr));
+	}
+
+	template <typename A>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_sub<A, typename detail::fused_scalar_leaf<A>::type> > operator-(fused_expr<A> const & a, typename A::value_type::value_type b)
+	{
+		typedef typename detail::fused_scalar_leaf<A>::type leaf;
+		return fused_expr<detail::fused_sub<A, leaf> >(detail::fused_sub<A, leaf>(a.Expr, leaf(b)));
+	}
+
+	template <typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_sub<typename detail::fused_scalar_leaf<B>::type, B> > operator-(typename B::value_type::value_type a, fused_expr<B> const & b)
+	{
+		typedef typename detail::fused_scalar_leaf<B>::type leaf;
+		return fused_expr<detail::fused_sub<leaf, B> >(detail::fused_sub<leaf, B>(leaf(a), b.Expr));
+	}
+
+	template <typename A, typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_mul<A, B> > operator*(fused_expr<A> const & a, fused_expr<B> const & b)
+	{
+		return fused_expr<detail::fused_mul<A, B> >(detail::fused_mul<A, B>(a.Expr, b.Expr));
+	}
+
+	template <typename A>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_mul<A, typename detail::fused_leaf<A>::type> > operator*(fused_expr<A> const & a, typename A::value_type const & b)
+	{
+		typedef typename detail::fused_leaf<A>::type leaf;
+		return fused_expr<detail::fused_mul<A, leaf> >(detail::fused_mul<A, leaf>(a.Expr, leaf(b)));
+	}
+
+	template <typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_mul<typename detail::fused_leaf<B>::type, B> > operator*(typename B::value_type const & a, fused_expr<B> const & b)
+	{
+		typedef typename detail::fused_leaf<B>::type leaf;
+		return fused_expr<detail::fused_mul<leaf, B> >(detail::fused_mul<leaf, B>(leaf(a), b.Expr));
+	}
+
+	template <typename A>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_mul<A, typename detail::fused_scalar_leaf<A>::type> > operator*(fused_expr<A> const & a, typename A::value_type::value_type b)
+	{
+		typedef typename detail::fused_scalar_leaf<A>::type leaf;
+		return fused_expr<detail::fused_mul<A, leaf> >(detail::fused_mul<A, leaf>(a.Expr, leaf(b)));
+	}
+
+	template <typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_mul<typename detail::fused_scalar_leaf<B>::type, B> > operator*(typename B::value_type::value_type a, fused_expr<B> const & b)
+	{
+		typedef typename detail::fused_scalar_leaf<B>::type leaf;
+		return fused_expr<detail::fused_mul<leaf, B> >(detail::fused_mul<leaf, B>(leaf(a), b.Expr));
+	}
+
+	template <typename A, typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_div<A, B> > operator/(fused_expr<A> const & a, fused_expr<B> const & b)
+	{
+		return fused_expr<detail::fused_div<A, B> >(detail::fused_div<A, B>(a.Expr, b.Expr));
+	}
+
+	template <typename A>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_div<A, typename detail::fused_leaf<A>::type> > operator/(fused_expr<A> const & a, typename A::value_type const & b)
+	{
+		typedef typename detail::fused_leaf<A>::type leaf;
+		return fused_expr<detail::fused_div<A, leaf> >(detail::fused_div<A, leaf>(a.Expr, leaf(b)));
+	}
+
+	template <typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_div<typename detail::fused_leaf<B>::type, B> > operator/(typename B::value_type const & a, fused_expr<B> const & b)
+	{
+		typedef typename detail::fused_leaf<B>::type leaf;
+		return fused_expr<detail::fused_div<leaf, B> >(detail::fused_div<leaf, B>(leaf(a), b.Expr));
+	}
+
+	template <typename A>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_div<A, typename detail::fused_scalar_leaf<A>::type> > operator/(fused_expr<A> const & a, typename A::value_type::value_type b)
+	{
+		typedef typename detail::fused_scalar_leaf<A>::type leaf;
+		return fused_expr<detail::fused_div<A, leaf> >(detail::fused_div<A, leaf>(a.Expr, leaf(b)));
+	}
+
+	template <typename B>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_div<typename detail::fused_scalar_leaf<B>::type, B> > operator/(typename B::value_type::value_type a, fused_expr<B> const & b)
+	{
+		typedef typename detail::fused_scalar_leaf<B>::type leaf;
+		return fused_expr<detail::fused_div<leaf, B> >(detail::fused_div<leaf, B>(leaf(a), b.Expr));
+	}
+
+	template <typename A>
+	GLM_FUNC_QUALIFIER fused_expr<detail::fused_neg<A> > operator-(fused_expr<A> const & a)
+	{
+		return fused_expr<detail::fused_neg<A> >(detail::fused_neg<A>(a.Expr));
+	}
+}//namespace glm
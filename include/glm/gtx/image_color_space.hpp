@@ -0,0 +1,92 @@
+/// @ref gtx_image_color_space
+/// @file glm/gtx/image_color_space.hpp
+///
+/// @see core (dependence)
+/// @see gtc_color_space (dependence)
+/// @see gtc_packing (dependence)
+/// @see gtx_parallel (dependence)
+///
+/// @defgroup gtx_image_color_space GLM_GTX_image_color_space
+/// @ingroup gtx
+///
+/// @brief Bulk sRGB and linear conversions of colors and images.
+///
+/// 8 bits sRGB values are decoded with a 256 entries table. Other conversions evaluate the transfer
+/// functions with polynomial approximations of log2 and exp2 instead of pow, 4 components at a time
+/// with SSE2. The absolute error against the exact IEC 61966-2-1 curves is below 5e-7 on [0, 1],
+/// well under the precision of RGBA16F. 8 bits results only differ from the correctly rounded
+/// value for inputs within 5e-7 of a rounding boundary, and decoding then encoding sRGB8 is lossless.
+/// Images are converted row by row over multiple threads.
+///
+/// <glm/gtx/image_color_space.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/color_space.hpp"
+#include "../gtc/packing.hpp"
+#include "../gtc/type_precision.hpp"
+#include "../gtx/parallel.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_image_color_space is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_image_color_space extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_image_color_space
+	/// @{
+
+	/// Pixel formats of the image conversions, always 4 components.
+	enum image_format
+	{
+		IMAGE_FORMAT_RGBA8,
+		IMAGE_FORMAT_RGBA16F,
+		IMAGE_FORMAT_RGBA32F
+	};
+
+	/// Size in bytes of a pixel.
+	GLM_FUNC_DECL std::size_t imagePixelSize(image_format Format);
+
+	/// Convert Count linear colors to sRGB, alpha is copied. Linear and SRGB may be the same array.
+	/// @see gtx_image_color_space
+	GLM_FUNC_DECL void convertLinearToSRGBBatch(std::size_t Count, vec4 const * Linear, vec4 * SRGB);
+
+	/// Convert Count sRGB colors to linear, alpha is copied. SRGB and Linear may be the same array.
+	/// @see gtx_image_color_space
+	GLM_FUNC_DECL void convertSRGBToLinearBatch(std::size_t Count, vec4 const * SRGB, vec4 * Linear);
+
+	/// Decode Count sRGB 8 bits colors to linear colors, alpha is normalized.
+	/// @see gtx_image_color_space
+	GLM_FUNC_DECL void convertSRGBToLinearBatch(std::size_t Count, u8vec4 const * SRGB, vec4 * Linear);
+
+	/// Convert a Width x Height image from sRGB to linear. Row pitches are in bytes.
+	/// Source and destination may overlap only when they have the same format and pitch.
+	/// Options.grain is in rows, 0 means about 16k pixels per chunk.
+	/// @see gtx_image_color_space
+	GLM_FUNC_DECL void convertImageSRGBToLinear(
+		std::size_t Width, std::size_t Height,
+		image_format SrcFormat, void const * Src, std::size_t SrcPitch,
+		image_format DstFormat, void * Dst, std::size_t DstPitch,
+		parallel_options const & Options = parallel_options());
+
+	/// Convert a Width x Height image from linear to sRGB. Row pitches are in bytes.
+	/// Source and destination may overlap only when they have the same format and pitch.
+	/// Options.grain is in rows, 0 means about 16k pixels per chunk.
+	/// @see gtx_image_color_space
+	GLM_FUNC_DECL void convertImageLinearToSRGB(
+		std::size_t Width, std::size_t Height,
+		image_format SrcFormat, void const * Src, std::size_t SrcPitch,
+		image_format DstFormat, void * Dst, std::size_t DstPitch,
+		parallel_options const & Options = parallel_options());
+
+	/// @}
+}//namespace glm
+
+#include "image_color_space.inl"
@@ -0,0 +1,346 @@
+/// @ref gtx_image_color_space
+/// @file glm/gtx/image_color_space.inl
+
+#include <cmath>
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	// Minimax polynomials: log2(m) = t * P(t^2) with t = (m - 1) / (m + 1) and m in [sqrt(0.5), sqrt(2)],
+	// absolute error 6e-8, and 2^f for f in [-0.5, 0.5], relative error 8e-8.
+	static float const image_log2_c0 = 2.8853904259f;
+	static float const image_log2_c1 = 0.9615878611f;
+	static float const image_log2_c2 = 0.5957965146f;
+	static float const image_exp2_c0 = 1.0000000755f;
+	static float const image_exp2_c1 = 0.6931472254f;
+	static float const image_exp2_c2 = 0.2402210737f;
+	static float const image_exp2_c3 = 0.0555029730f;
+	static float const image_exp2_c4 = 0.0096760364f;
+	static float const image_exp2_c5 = 0.0013410005f;
+
+	// Number of pixels converted at a time, a tile of vec4 stays in the L1 cache
+	static std::size_t const image_tile_size = 256;
+
+	// Exact decoding of the 256 sRGB 8 bits values.
+	struct image_srgb8_table
+	{
+		GLM_FUNC_QUALIFIER image_srgb8_table()
+		{
+			for(int i = 0; i < 256; ++i)
+			{
+				double const c = static_cast<double>(i) / 255.0;
+				this->Values[i] = static_cast<float>(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+			}
+		}
+
+		float Values[256];
+	};
+
+	GLM_FUNC_QUALIFIER float const * image_srgb8_lut()
+	{
+		static image_srgb8_table const Table;
+		return Table.Values;
+	}
+
+	// Valid for x in [2^-126, 2^128)
+	GLM_FUNC_QUALIFIER float image_pow(float x, float y)
+	{
+		int Exp = 0;
+		float m = std::frexp(x, &Exp);
+		if(m < 0.70710678f)
+		{
+			m *= 2.0f;
+			--Exp;
+		}
+		float const t = (m - 1.0f) / (m + 1.0f);
+		float const u = t * t;
+		float const Log = static_cast<float>(Exp) + t * (image_log2_c0 + u * (image_log2_c1 + u * image_log2_c2));
+
+		float const e = Log * y;
+		float const n = std::floor(e + 0.5f);
+		float const f = e - n;
+		float const p = image_exp2_c0 + f * (image_exp2_c1 + f * (image_exp2_c2 + f * (image_exp2_c3 + f * (image_exp2_c4 + f * image_exp2_c5))));
+		return std::ldexp(p, static_cast<int>(n));
+	}
+
+	GLM_FUNC_QUALIFIER float image_linear_to_srgb(float c)
+	{
+		c = c < 0.0f ? 0.0f : (c > 1.0f ? 1.0f : c);
+		return c < 0.0031308f ? c * 12.92f : 1.055f * image_pow(c, 1.0f / 2.4f) - 0.055f;
+	}
+
+	GLM_FUNC_QUALIFIER float image_srgb_to_linear(float c)
+	{
+		c = c < 0.0f ? 0.0f : (c > 1.0f ? 1.0f : c);
+		return c <= 0.04045f ? c * (1.0f / 12.92f) : image_pow((c + 0.055f) * (1.0f / 1.055f), 2.4f);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Valid for positive normalized x
+	GLM_FUNC_QUALIFIER glm_vec4 image_pow(glm_vec4 x, glm_vec4 y)
+	{
+		__m128i const Bits = _mm_castps_si128(x);
+		glm_vec4 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+		glm_vec4 Exp = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(127)));
+
+		// Move m from [1, 2) to [sqrt(0.5), sqrt(2))
+		glm_vec4 const Over = _mm_cmpgt_ps(m, _mm_set1_ps(1.41421356f));
+		m = _mm_sub_ps(m, _mm_and_ps(Over, _mm_mul_ps(m, _mm_set1_ps(0.5f))));
+		Exp = _mm_add_ps(Exp, _mm_and_ps(Over, _mm_set1_ps(1.0f)));
+
+		glm_vec4 const One = _mm_set1_ps(1.0f);
+		glm_vec4 const t = _mm_div_ps(_mm_sub_ps(m, One), _mm_add_ps(m, One));
+		glm_vec4 const u = _mm_mul_ps(t, t);
+		glm_vec4 Log = _mm_add_ps(_mm_mul_ps(u, _mm_set1_ps(image_log2_c2)), _mm_set1_ps(image_log2_c1));
+		Log = _mm_add_ps(_mm_mul_ps(Log, u), _mm_set1_ps(image_log2_c0));
+		Log = _mm_add_ps(_mm_mul_ps(Log, t), Exp);
+
+		glm_vec4 const e = _mm_mul_ps(Log, y);
+		__m128i const n = _mm_cvtps_epi32(e);
+		glm_vec4 const f = _mm_sub_ps(e, _mm_cvtepi32_ps(n));
+		glm_vec4 p = _mm_add_ps(_mm_mul_ps(f, _mm_set1_ps(image_exp2_c5)), _mm_set1_ps(image_exp2_c4));
+		p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(image_exp2_c3));
+		p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(image_exp2_c2));
+		p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(image_exp2_c1));
+		p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(image_exp2_c0));
+		return _mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23)));
+	}
+
+	// The alpha lane is passed through
+	GLM_FUNC_QUALIFIER glm_vec4 image_linear_to_srgb(glm_vec4 c)
+	{
+		glm_vec4 const Clamped = _mm_min_ps(_mm_max_ps(c, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+		glm_vec4 const Curve = _mm_sub_ps(
+			_mm_mul_ps(image_pow(_mm_max_ps(Clamped, _mm_set1_ps(0.0031308f)), _mm_set1_ps(1.0f / 2.4f)), _mm_set1_ps(1.055f)),
+			_mm_set1_ps(0.055f));
+		glm_vec4 const Line = _mm_mul_ps(Clamped, _mm_set1_ps(12.92f));
+		glm_vec4 const Low = _mm_cmplt_ps(Clamped, _mm_set1_ps(0.0031308f));
+		glm_vec4 const Result = _mm_or_ps(_mm_and_ps(Low, Line), _mm_andnot_ps(Low, Curve));
+		glm_vec4 const Alpha = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+		return _mm_or_ps(_mm_and_ps(Alpha, c), _mm_andnot_ps(Alpha, Result));
+	}
+
+	// The alpha lane is passed through
+	GLM_FUNC_QUALIFIER glm_vec4 image_srgb_to_linear(glm_vec4 c)
+	{
+		glm_vec4 const Clamped = _mm_min_ps(_mm_max_ps(c, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+		glm_vec4 const Base = _mm_mul_ps(_mm_add_ps(_mm_max_ps(Clamped, _mm_set1_ps(0.04045f)), _mm_set1_ps(0.055f)), _mm_set1_ps(1.0f / 1.055f));
+		glm_vec4 const Curve = image_pow(Base, _mm_set1_ps(2.4f));
+		glm_vec4 const Line = _mm_mul_ps(Clamped, _mm_set1_ps(1.0f / 12.92f));
+		glm_vec4 const Low = _mm_cmple_ps(Clamped, _mm_set1_ps(0.04045f));
+		glm_vec4 const Result = _mm_or_ps(_mm_and_ps(Low, Line), _mm_andnot_ps(Low, Curve));
+		glm_vec4 const Alpha = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+		return _mm_or_ps(_mm_and_ps(Alpha, c), _mm_andnot_ps(Alpha, Result));
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	// Read Count pixels as floats, without transfer function.
+	GLM_FUNC_QUALIFIER void image_load(image_format Format, void const * Src, std::size_t Count, vec4 * Dst)
+	{
+		switch(Format)
+		{
+		case IMAGE_FORMAT_RGBA8:
+		{
+			u8vec4 const * Pixels = static_cast<u8vec4 const *>(Src);
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				__m128i const Zero = _mm_setzero_si128();
+				glm_vec4 const Scale = _mm_set1_ps(1.0f / 255.0f);
+				for(std::size_t i = 0; i < Count; ++i)
+				{
+					int Packed;
+					std::memcpy(&Packed, &Pixels[i], sizeof(Packed));
+					__m128i const Wide = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(Packed), Zero), Zero);
+					_mm_storeu_ps(&Dst[i].x, _mm_mul_ps(_mm_cvtepi32_ps(Wide), Scale));
+				}
+#			else
+				for(std::size_t i = 0; i < Count; ++i)
+					Dst[i] = vec4(Pixels[i]) * (1.0f / 255.0f);
+#			endif
+			break;
+		}
+		case IMAGE_FORMAT_RGBA16F:
+		{
+			uint64 const * Pixels = static_cast<uint64 const *>(Src);
+#			if (GLM_ARCH & GLM_ARCH_AVX_BIT) && (defined(__F16C__) || (GLM_COMPILER & GLM_COMPILER_VC))
+				for(std::size_t i = 0; i < Count; ++i)
+					_mm_storeu_ps(&Dst[i].x, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(Pixels + i))));
+#			else
+				for(std::size_t i = 0; i < Count; ++i)
+					Dst[i] = unpackHalf4x16(Pixels[i]);
+#			endif
+			break;
+		}
+		case IMAGE_FORMAT_RGBA32F:
+			std::memcpy(&Dst[0].x, Src, Count * sizeof(vec4));
+			break;
+		}
+	}
+
+	// Write Count float pixels, without transfer function. RGBA8 values are clamped and rounded.
+	GLM_FUNC_QUALIFIER void image_store(image_format Format, vec4 const * Src, std::size_t Count, void * Dst)
+	{
+		switch(Format)
+		{
+		case IMAGE_FORMAT_RGBA8:
+		{
+			u8vec4 * Pixels = static_cast<u8vec4 *>(Dst);
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				glm_vec4 const Zero = _mm_setzero_ps();
+				glm_vec4 const One = _mm_set1_ps(1.0f);
+				glm_vec4 const Scale = _mm_set1_ps(255.0f);
+				glm_vec4 const Half = _mm_set1_ps(0.5f);
+				for(; i + 4 <= Count; i += 4)
+				{
+					__m128i Words[4];
+					for(std::size_t j = 0; j < 4; ++j)
+					{
+						glm_vec4 const c = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&Src[i + j].x), Zero), One);
+						Words[j] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(c, Scale), Half));
+					}
+					__m128i const Bytes = _mm_packus_epi16(_mm_packs_epi32(Words[0], Words[1]), _mm_packs_epi32(Words[2], Words[3]));
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(Pixels + i), Bytes);
+				}
+#			endif
+			for(; i < Count; ++i)
+				Pixels[i] = u8vec4(clamp(Src[i], 0.0f, 1.0f) * 255.0f + 0.5f);
+			break;
+		}
+		case IMAGE_FORMAT_RGBA16F:
+		{
+			uint64 * Pixels = static_cast<uint64 *>(Dst);
+#			if (GLM_ARCH & GLM_ARCH_AVX_BIT) && (defined(__F16C__) || (GLM_COMPILER & GLM_COMPILER_VC))
+				for(std::size_t i = 0; i < Count; ++i)
+					_mm_storel_epi64(reinterpret_cast<__m128i *>(Pixels + i), _mm_cvtps_ph(_mm_loadu_ps(&Src[i].x), 0));
+#			else
+				for(std::size_t i = 0; i < Count; ++i)
+					Pixels[i] = packHalf4x16(Src[i]);
+#			endif
+			break;
+		}
+		case IMAGE_FORMAT_RGBA32F:
+			std::memmove(Dst, &Src[0].x, Count * sizeof(vec4));
+			break;
+		}
+	}
+
+	template <bool ToLinear>
+	GLM_FUNC_QUALIFIER void image_convert(
+		std::size_t Width, std::size_t Height,
+		image_format SrcFormat, void const * Src, std::size_t SrcPitch,
+		image_format DstFormat, void * Dst, std::size_t DstPitch,
+		parallel_options const & Options)
+	{
+		if(Width == 0)
+			return;
+
+		std::size_t const SrcPixelSize = imagePixelSize(SrcFormat);
+		std::size_t const DstPixelSize = imagePixelSize(DstFormat);
+
+		// Small images stay on the calling thread, about 16k pixels per chunk
+		parallel_options RowOptions(Options);
+		if(RowOptions.grain == 0)
+			RowOptions.grain = Width >= 16384 ? 1 : 16384 / Width;
+
+		parallelFor(Height, [&](std::size_t Begin, std::size_t End)
+		{
+			vec4 Tile[image_tile_size];
+
+			for(std::size_t y = Begin; y < End; ++y)
+			{
+				unsigned char const * SrcRow = static_cast<unsigned char const *>(Src) + y * SrcPitch;
+				unsigned char * DstRow = static_cast<unsigned char *>(Dst) + y * DstPitch;
+
+				for(std::size_t x = 0; x < Width; x += image_tile_size)
+				{
+					std::size_t const Count = Width - x < image_tile_size ? Width - x : image_tile_size;
+					void const * SrcPixels = SrcRow + x * SrcPixelSize;
+
+					if(ToLinear && SrcFormat == IMAGE_FORMAT_RGBA8)
+						convertSRGBToLinearBatch(Count, static_cast<u8vec4 const *>(SrcPixels), Tile);
+					else
+					{
+						image_load(SrcFormat, SrcPixels, Count, Tile);
+						if(ToLinear)
+							convertSRGBToLinearBatch(Count, Tile, Tile);
+						else
+							convertLinearToSRGBBatch(Count, Tile, Tile);
+					}
+
+					image_store(DstFormat, Tile, Count, DstRow + x * DstPixelSize);
+				}
+			}
+		}, RowOptions);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER std::size_t imagePixelSize(image_format Format)
+	{
+		switch(Format)
+		{
+		case IMAGE_FORMAT_RGBA8:
+			return 4;
+		case IMAGE_FORMAT_RGBA16F:
+			return 8;
+		default:
+			return 16;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void convertLinearToSRGBBatch(std::size_t Count, vec4 const * Linear, vec4 * SRGB)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t i = 0; i < Count; ++i)
+				_mm_storeu_ps(&SRGB[i].x, detail::image_linear_to_srgb(_mm_loadu_ps(&Linear[i].x)));
+#		else
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec4 const c = Linear[i];
+				SRGB[i] = vec4(detail::image_linear_to_srgb(c.x), detail::image_linear_to_srgb(c.y), detail::image_linear_to_srgb(c.z), c.w);
+			}
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void convertSRGBToLinearBatch(std::size_t Count, vec4 const * SRGB, vec4 * Linear)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t i = 0; i < Count; ++i)
+				_mm_storeu_ps(&Linear[i].x, detail::image_srgb_to_linear(_mm_loadu_ps(&SRGB[i].x)));
+#		else
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec4 const c = SRGB[i];
+				Linear[i] = vec4(detail::image_srgb_to_linear(c.x), detail::image_srgb_to_linear(c.y), detail::image_srgb_to_linear(c.z), c.w);
+			}
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void convertSRGBToLinearBatch(std::size_t Count, u8vec4 const * SRGB, vec4 * Linear)
+	{
+		float const * Table = detail::image_srgb8_lut();
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			u8vec4 const c = SRGB[i];
+			Linear[i] = vec4(Table[c.x], Table[c.y], Table[c.z], static_cast<float>(c.w) * (1.0f / 255.0f));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void convertImageSRGBToLinear(
+		std::size_t Width, std::size_t Height,
+		image_format SrcFormat, void const * Src, std::size_t SrcPitch,
+		image_format DstFormat, void * Dst, std::size_t DstPitch,
+		parallel_options const & Options)
+	{
+		detail::image_convert<true>(Width, Height, SrcFormat, Src, SrcPitch, DstFormat, Dst, DstPitch, Options);
+	}
+
+	GLM_FUNC_QUALIFIER void convertImageLinearToSRGB(
+		std::size_t Width, std::size_t Height,
+		image_format SrcFormat, void const * Src, std::size_t SrcPitch,
+		image_format DstFormat, void * Dst, std::size_t DstPitch,
+		parallel_options const & Options)
+	{
+		detail::image_convert<false>(Width, Height, SrcFormat, Src, SrcPitch, DstFormat, Dst, DstPitch, Options);
+	}
+}//namespace glm
@@ -0,0 +1,90 @@
+/// @ref gtx_image_mipmap
+/// @file glm/gtx/image_mipmap.hpp
+///
+/// @see core (dependence)
+/// @see gtx_image_color_space (dependence)
+/// @see gtx_parallel (dependence)
+///
+/// @defgroup gtx_image_mipmap GLM_GTX_image_mipmap
+/// @ingroup gtx
+///
+/// @brief Generation of mip chains with box, Kaiser and Lanczos filters in linear space.
+///
+/// Level l of a Width x Height image is max(Width >> l, 1) x max(Height >> l, 1), as with glGenerateMipmap.
+/// Each level is filtered from the previous one by separable polyphase filters, so odd sizes are handled
+/// exactly: the box filter averages the source area covered by each pixel, the Kaiser filter is a sinc
+/// windowed by a Kaiser window of radius 3 and alpha 4, the Lanczos filter a sinc windowed by a sinc of
+/// radius 3. Borders are clamped to the edge.
+///
+/// sRGB images are decoded with the conversions of GLM_GTX_image_color_space, filtered, then encoded again.
+/// The source is read once: each of its rows is decoded and filtered horizontally as soon as the vertical
+/// filter reaches it, then dropped. The following levels are filtered from a linear float copy of the
+/// previous level, never from the quantized results. Rows are filtered 4 floats at a time with SSE2 and
+/// 2 pixels at a time with AVX2, and each level is split in bands of rows run by the executor of GLM_GTX_parallel.
+///
+/// Kaiser and Lanczos ring next to sharp edges: RGBA8 results are clamped to [0, 1], float results are not.
+///
+/// <glm/gtx/image_mipmap.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/image_color_space.hpp"
+#include "../gtx/parallel.hpp"
+#include <cstddef>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_image_mipmap is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_image_mipmap extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_image_mipmap
+	/// @{
+
+	/// Downsampling filters.
+	enum image_mipmap_filter
+	{
+		/// Average of the covered source area, the fastest and the softest.
+		IMAGE_MIPMAP_BOX,
+		/// Kaiser windowed sinc, sharp with little ringing.
+		IMAGE_MIPMAP_KAISER,
+		/// Lanczos 3, the sharpest, with the most ringing.
+		IMAGE_MIPMAP_LANCZOS
+	};
+
+	/// Number of levels of the full mip chain of a Width x Height image, the base level included.
+	/// @see gtx_image_mipmap
+	GLM_FUNC_DECL std::size_t imageMipmapLevelCount(std::size_t Width, std::size_t Height);
+
+	/// Write the levels 1 to LevelCount of the Width x Height image Src, all in the same Format.
+	/// Levels[i] and LevelPitches[i] are the pixels and the row pitch in bytes of level i + 1;
+	/// LevelPitches may be null for tightly packed rows. Pitches are in bytes.
+	/// SRGB means the color components are sRGB encoded, as in GL_SRGB8_ALPHA8. Alpha is always linear.
+	/// Options.grain is the minimum number of rows per band, 0 means bands of at least 16k pixels.
+	/// @see gtx_image_mipmap
+	GLM_FUNC_DECL void generateImageMipmaps(
+		std::size_t Width, std::size_t Height, image_format Format, bool SRGB,
+		void const * Src, std::size_t SrcPitch,
+		std::size_t LevelCount, void * const * Levels, std::size_t const * LevelPitches,
+		image_mipmap_filter Filter = IMAGE_MIPMAP_KAISER,
+		parallel_options const & Options = parallel_options());
+
+	/// Generate the full mip chain of Src, the levels 1 and up, packed one after the other in the returned array.
+	/// @see gtx_image_mipmap
+	GLM_FUNC_DECL std::vector<unsigned char> generateImageMipmaps(
+		std::size_t Width, std::size_t Height, image_format Format, bool SRGB,
+		void const * Src, std::size_t SrcPitch,
+		image_mipmap_filter Filter = IMAGE_MIPMAP_KAISER,
+		parallel_options const & Options = parallel_options());
+
+	/// @}
+}//namespace glm
+
+#include "image_mipmap.inl"
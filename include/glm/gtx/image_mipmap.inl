@@ -0,0 +1,365 @@
+/// @ref gtx_image_mipmap
+/// @file glm/gtx/image_mipmap.inl
+
+#include <cmath>
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	// Radius of the windowed sinc filters, in destination pixels
+	static double const image_mipmap_radius = 3.0;
+	static double const image_mipmap_kaiser_alpha = 4.0;
+
+	GLM_FUNC_QUALIFIER double image_mipmap_sinc(double x)
+	{
+		if(std::abs(x) < 1e-9)
+			return 1.0;
+		double const a = 3.14159265358979323846 * x;
+		return std::sin(a) / a;
+	}
+
+	// Modified Bessel function of the first kind of order 0
+	GLM_FUNC_QUALIFIER double image_mipmap_bessel0(double x)
+	{
+		double const h = x * x * 0.25;
+		double Sum = 1.0;
+		double Term = 1.0;
+		for(int k = 1; k < 64 && Term > Sum * 1e-17; ++k)
+		{
+			Term *= h / (static_cast<double>(k) * static_cast<double>(k));
+			Sum += Term;
+		}
+		return Sum;
+	}
+
+	// Windowed sinc at x destination pixels from the center of a destination pixel
+	GLM_FUNC_QUALIFIER double image_mipmap_kernel(image_mipmap_filter Filter, double x)
+	{
+		if(std::abs(x) >= image_mipmap_radius)
+			return 0.0;
+		if(Filter == IMAGE_MIPMAP_LANCZOS)
+			return image_mipmap_sinc(x) * image_mipmap_sinc(x / image_mipmap_radius);
+
+		double const t = x / image_mipmap_radius;
+		return image_mipmap_sinc(x) * image_mipmap_bessel0(image_mipmap_kaiser_alpha * std::sqrt(1.0 - t * t)) / image_mipmap_bessel0(image_mipmap_kaiser_alpha);
+	}
+
+	// Polyphase filter of one axis: destination pixel i is the sum of Weights[i * Taps + t] * Source[First[i] + t].
+	// First[i] may be out of the source, by up to PadBefore pixels before it and PadAfter pixels after it.
+	struct image_mipmap_axis
+	{
+		GLM_FUNC_QUALIFIER image_mipmap_axis(image_mipmap_filter Filter, std::size_t SrcSize, std::size_t DstSize) :
+			Taps(0), First(DstSize), PadBefore(0), PadAfter(0)
+		{
+			double const Scale = static_cast<double>(SrcSize) / static_cast<double>(DstSize);
+			double const Support = (Filter == IMAGE_MIPMAP_BOX ? 0.5 : image_mipmap_radius) * Scale;
+			std::size_t const MaxTaps = static_cast<std::size_t>(std::ceil(Support * 2.0)) + 2;
+
+			std::vector<double> Values(DstSize * MaxTaps, 0.0);
+			std::vector<std::size_t> Begin(DstSize);
+			std::vector<std::size_t> End(DstSize);
+			for(std::size_t i = 0; i < DstSize; ++i)
+			{
+				double const Center = (static_cast<double>(i) + 0.5) * Scale;
+				int const Low = static_cast<int>(std::floor(Center - Support));
+				double * Value = &Values[i * MaxTaps];
+
+				double Sum = 0.0;
+				for(std::size_t t = 0; t < MaxTaps; ++t)
+				{
+					double const x = static_cast<double>(Low + static_cast<int>(t));
+					if(Filter == IMAGE_MIPMAP_BOX)
+						Value[t] = max(0.0, min(x + 1.0, Center + Support) - max(x, Center - Support));
+					else
+						Value[t] = image_mipmap_kernel(Filter, (x + 0.5 - Center) / Scale);
+					Sum += Value[t];
+				}
+
+				// Drop the zero weights at both ends, the sinc is zero at whole destination pixels
+				Begin[i] = 0;
+				End[i] = MaxTaps;
+				for(std::size_t t = 0; t < MaxTaps; ++t)
+					Value[t] /= Sum;
+				while(End[i] > 1 && std::abs(Value[End[i] - 1]) < 1e-7)
+					--End[i];
+				while(Begin[i] + 1 < End[i] && std::abs(Value[Begin[i]]) < 1e-7)
+					++Begin[i];
+
+				this->First[i] = Low + static_cast<int>(Begin[i]);
+				this->Taps = max(this->Taps, End[i] - Begin[i]);
+			}
+
+			this->Weights.resize(DstSize * this->Taps, 0.0f);
+			for(std::size_t i = 0; i < DstSize; ++i)
+				for(std::size_t t = Begin[i]; t < End[i]; ++t)
+					this->Weights[i * this->Taps + t - Begin[i]] = static_cast<float>(Values[i * MaxTaps + t]);
+
+			int const Last = this->First[DstSize - 1] + static_cast<int>(this->Taps);
+			this->PadBefore = this->First[0] < 0 ? static_cast<std::size_t>(-this->First[0]) : 0;
+			this->PadAfter = Last > static_cast<int>(SrcSize) ? static_cast<std::size_t>(Last) - SrcSize : 0;
+		}
+
+		std::size_t Taps;
+		std::vector<int> First;
+		std::vector<float> Weights;
+		std::size_t PadBefore;
+		std::size_t PadAfter;
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	GLM_FUNC_QUALIFIER __m256 image_mipmap_fma(__m256 a, __m256 b, __m256 c)
+	{
+#		if GLM_HAS_FMA
+			return _mm256_fmadd_ps(a, b, c);
+#		else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#		endif
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	// Horizontal filter of Count destination pixels. In is the source pixel 0 of a row padded as the axis requires.
+	GLM_FUNC_QUALIFIER void image_mipmap_filter_row(image_mipmap_axis const & Axis, vec4 const * In, vec4 * Out, std::size_t Count)
+	{
+		std::size_t const Taps = Axis.Taps;
+		float const * Weights = &Axis.Weights[0];
+		std::size_t i = 0;
+
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			// Two destination pixels per register, each lane reads its own source pixels
+			for(; i + 2 <= Count; i += 2)
+			{
+				float const * Src0 = &In[Axis.First[i]].x;
+				float const * Src1 = &In[Axis.First[i + 1]].x;
+				float const * Weight0 = Weights + i * Taps;
+				float const * Weight1 = Weight0 + Taps;
+
+				__m256 Sum = _mm256_setzero_ps();
+				for(std::size_t t = 0; t < Taps; ++t)
+				{
+					__m256 const Weight = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_broadcast_ss(Weight0 + t)), _mm_broadcast_ss(Weight1 + t), 1);
+					__m256 const Pixels = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Src0 + t * 4)), _mm_loadu_ps(Src1 + t * 4), 1);
+					Sum = image_mipmap_fma(Weight, Pixels, Sum);
+				}
+				_mm256_storeu_ps(&Out[i].x, Sum);
+			}
+#		endif
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i < Count; ++i)
+			{
+				float const * Src = &In[Axis.First[i]].x;
+				float const * Weight = Weights + i * Taps;
+
+				glm_vec4 Sum = _mm_setzero_ps();
+				for(std::size_t t = 0; t < Taps; ++t)
+					Sum = glm_vec4_fma(_mm_set1_ps(Weight[t]), _mm_loadu_ps(Src + t * 4), Sum);
+				_mm_storeu_ps(&Out[i].x, Sum);
+			}
+#		else
+			for(; i < Count; ++i)
+			{
+				vec4 const * Src = In + Axis.First[i];
+				float const * Weight = Weights + i * Taps;
+
+				vec4 Sum(0.0f);
+				for(std::size_t t = 0; t < Taps; ++t)
+					Sum += Weight[t] * Src[t];
+				Out[i] = Sum;
+			}
+#		endif
+	}
+
+	// Vertical filter of Count floats: Out[x] is the sum of Weights[t] * Rows[t][x]
+	GLM_FUNC_QUALIFIER void image_mipmap_filter_column(std::size_t Count, std::size_t Taps, float const * Weights, float const * const * Rows, float * Out)
+	{
+		std::size_t x = 0;
+
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; x + 8 <= Count; x += 8)
+			{
+				__m256 Sum = _mm256_setzero_ps();
+				for(std::size_t t = 0; t < Taps; ++t)
+					Sum = image_mipmap_fma(_mm256_broadcast_ss(Weights + t), _mm256_loadu_ps(Rows[t] + x), Sum);
+				_mm256_storeu_ps(Out + x, Sum);
+			}
+#		endif
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; x + 4 <= Count; x += 4)
+			{
+				glm_vec4 Sum = _mm_setzero_ps();
+				for(std::size_t t = 0; t < Taps; ++t)
+					Sum = glm_vec4_fma(_mm_set1_ps(Weights[t]), _mm_loadu_ps(Rows[t] + x), Sum);
+				_mm_storeu_ps(Out + x, Sum);
+			}
+#		endif
+
+		for(; x < Count; ++x)
+		{
+			float Sum = 0.0f;
+			for(std::size_t t = 0; t < Taps; ++t)
+				Sum += Weights[t] * Rows[t][x];
+			Out[x] = Sum;
+		}
+	}
+
+	// Filter a level from the previous one. LoadRow(y, Pixels) writes the linear pixels of the row y of the previous level.
+	// Linear receives a linear copy of the level when not null.
+	template <typename loadType>
+	GLM_FUNC_QUALIFIER void image_mipmap_level(
+		std::size_t SrcWidth, std::size_t SrcHeight, loadType const & LoadRow,
+		std::size_t DstWidth, std::size_t DstHeight, image_format Format, bool SRGB, void * Dst, std::size_t DstPitch,
+		vec4 * Linear, image_mipmap_filter Filter, parallel_options const & Options)
+	{
+		image_mipmap_axis const AxisX(Filter, SrcWidth, DstWidth);
+		image_mipmap_axis const AxisY(Filter, SrcHeight, DstHeight);
+		std::size_t const Taps = AxisY.Taps;
+
+		// Each band reads Taps rows more than it needs, bands of at least 16k pixels keep this low
+		parallel_options BandOptions(Options);
+		if(BandOptions.grain == 0)
+			BandOptions.grain = max(DstWidth >= 16384 ? 1 : 16384 / DstWidth, Taps);
+
+		parallelFor(DstHeight, [&](std::size_t Begin, std::size_t End)
+		{
+			std::vector<vec4> Input(AxisX.PadBefore + SrcWidth + AxisX.PadAfter);
+			std::vector<vec4> Ring(Taps * DstWidth);
+			std::vector<vec4> Result(Linear ? 0 : DstWidth);
+			std::vector<vec4> Encoded(SRGB ? DstWidth : 0);
+			std::vector<float const *> Rows(Taps);
+			vec4 * const Pixels = &Input[AxisX.PadBefore];
+
+			// Row r of the previous level is in the ring slot (r - Origin) % Taps while the filter needs it
+			int const Origin = AxisY.First[Begin];
+			int Next = Origin;
+			for(std::size_t y = Begin; y < End; ++y)
+			{
+				int const First = AxisY.First[y];
+				if(Next < First)
+					Next = First;
+				for(; Next < First + static_cast<int>(Taps); ++Next)
+				{
+					int const Row = clamp(Next, 0, static_cast<int>(SrcHeight) - 1);
+					LoadRow(static_cast<std::size_t>(Row), Pixels);
+					for(std::size_t i = 0; i < AxisX.PadBefore; ++i)
+						Input[i] = Pixels[0];
+					for(std::size_t i = 0; i < AxisX.PadAfter; ++i)
+						Pixels[SrcWidth + i] = Pixels[SrcWidth - 1];
+					image_mipmap_filter_row(AxisX, Pixels, &Ring[static_cast<std::size_t>(Next - Origin) % Taps * DstWidth], DstWidth);
+				}
+
+				for(std::size_t t = 0; t < Taps; ++t)
+					Rows[t] = &Ring[static_cast<std::size_t>(First + static_cast<int>(t) - Origin) % Taps * DstWidth].x;
+				vec4 * const Out = Linear ? Linear + y * DstWidth : &Result[0];
+				image_mipmap_filter_column(DstWidth * 4, Taps, &AxisY.Weights[y * Taps], &Rows[0], &Out->x);
+
+				vec4 const * Store = Out;
+				if(SRGB)
+				{
+					convertLinearToSRGBBatch(DstWidth, Out, &Encoded[0]);
+					Store = &Encoded[0];
+				}
+				image_store(Format, Store, DstWidth, static_cast<unsigned char *>(Dst) + y * DstPitch);
+			}
+		}, BandOptions);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER std::size_t imageMipmapLevelCount(std::size_t Width, std::size_t Height)
+	{
+		if(Width == 0 || Height == 0)
+			return 0;
+
+		std::size_t Count = 1;
+		for(std::size_t Size = max(Width, Height); Size > 1; Size >>= 1)
+			++Count;
+		return Count;
+	}
+
+	GLM_FUNC_QUALIFIER void generateImageMipmaps(
+		std::size_t Width, std::size_t Height, image_format Format, bool SRGB,
+		void const * Src, std::size_t SrcPitch,
+		std::size_t LevelCount, void * const * Levels, std::size_t const * LevelPitches,
+		image_mipmap_filter Filter, parallel_options const & Options)
+	{
+		assert(LevelCount < imageMipmapLevelCount(Width, Height) || LevelCount == 0);
+
+		std::size_t const PixelSize = imagePixelSize(Format);
+
+		// Linear copies of the odd and even levels, each level is filtered from the previous one
+		std::vector<vec4> Linear[2];
+
+		std::size_t SrcWidth = Width;
+		std::size_t SrcHeight = Height;
+		for(std::size_t Level = 1; Level <= LevelCount; ++Level)
+		{
+			std::size_t const DstWidth = max(Width >> Level, static_cast<std::size_t>(1));
+			std::size_t const DstHeight = max(Height >> Level, static_cast<std::size_t>(1));
+			std::size_t const DstPitch = LevelPitches ? LevelPitches[Level - 1] : DstWidth * PixelSize;
+
+			vec4 * Out = 0;
+			if(Level < LevelCount)
+			{
+				Linear[Level & 1].resize(DstWidth * DstHeight);
+				Out = &Linear[Level & 1][0];
+			}
+
+			if(Level == 1)
+			{
+				std::size_t const RowWidth = SrcWidth;
+				detail::image_mipmap_level(SrcWidth, SrcHeight, [&](std::size_t y, vec4 * Pixels)
+				{
+					void const * Row = static_cast<unsigned char const *>(Src) + y * SrcPitch;
+					if(SRGB && Format == IMAGE_FORMAT_RGBA8)
+						convertSRGBToLinearBatch(RowWidth, static_cast<u8vec4 const *>(Row), Pixels);
+					else
+					{
+						detail::image_load(Format, Row, RowWidth, Pixels);
+						if(SRGB)
+							convertSRGBToLinearBatch(RowWidth, Pixels, Pixels);
+					}
+				}, DstWidth, DstHeight, Format, SRGB, Levels[Level - 1], DstPitch, Out, Filter, Options);
+			}
+			else
+			{
+				std::size_t const RowWidth = SrcWidth;
+				vec4 const * Previous = &Linear[(Level - 1) & 1][0];
+				detail::image_mipmap_level(SrcWidth, SrcHeight, [&](std::size_t y, vec4 * Pixels)
+				{
+					std::memcpy(&Pixels[0].x, &Previous[y * RowWidth].x, RowWidth * sizeof(vec4));
+				}, DstWidth, DstHeight, Format, SRGB, Levels[Level - 1], DstPitch, Out, Filter, Options);
+			}
+
+			SrcWidth = DstWidth;
+			SrcHeight = DstHeight;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER std::vector<unsigned char> generateImageMipmaps(
+		std::size_t Width, std::size_t Height, image_format Format, bool SRGB,
+		void const * Src, std::size_t SrcPitch,
+		image_mipmap_filter Filter, parallel_options const & Options)
+	{
+		std::size_t const LevelCount = imageMipmapLevelCount(Width, Height);
+		if(LevelCount <= 1)
+			return std::vector<unsigned char>();
+
+		std::size_t const PixelSize = imagePixelSize(Format);
+		std::vector<std::size_t> Offsets(LevelCount - 1);
+		std::size_t Size = 0;
+		for(std::size_t Level = 1; Level < LevelCount; ++Level)
+		{
+			Offsets[Level - 1] = Size;
+			Size += max(Width >> Level, static_cast<std::size_t>(1)) * max(Height >> Level, static_cast<std::size_t>(1)) * PixelSize;
+		}
+
+		std::vector<unsigned char> Result(Size);
+		std::vector<void *> Levels(LevelCount - 1);
+		for(std::size_t Level = 1; Level < LevelCount; ++Level)
+			Levels[Level - 1] = &Result[Offsets[Level - 1]];
+
+		generateImageMipmaps(Width, Height, Format, SRGB, Src, SrcPitch, LevelCount - 1, &Levels[0], 0, Filter, Options);
+		return Result;
+	}
+}//namespace glm
@@ -0,0 +1,46 @@
+/// @ref gtx_matrix_batch
+/// @file glm/gtx/matrix_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_matrix_inverse (dependence)
+///
+/// @defgroup gtx_matrix_batch GLM_GTX_matrix_batch
+/// @ingroup gtx
+///
+/// @brief Operations on large arrays of matrices.
+///
+/// With SSE2 the columns of each matrix are processed as SIMD registers, two matrices at a time with AVX.
+/// Results are identical to the functions applied to each matrix, unless the compiler contracts the scalar
+/// code to FMA.
+///
+/// <glm/gtx/matrix_batch.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/matrix_inverse.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_matrix_batch is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_matrix_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_batch
+	/// @{
+
+	/// Out[i] = inverseTranspose(mat3(ModelView[i])) for Count matrices: the matrices transforming the
+	/// normals with the model-view matrices. Singular matrices give infinite or NaN components.
+	/// @see gtx_matrix_batch
+	GLM_FUNC_DECL void normalMatrixBatch(std::size_t Count, mat4 const * ModelView, mat3 * Out);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_batch.inl"
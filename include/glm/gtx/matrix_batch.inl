@@ -0,0 +1,102 @@
+/// @ref gtx_matrix_batch
+/// @file glm/gtx/matrix_batch.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/matrix.h"
+#endif
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Stores the first three components of each column. With Overlap, the 16 bytes store of the last
+	// column writes the first float after the matrix, which must be written again later.
+	GLM_FUNC_QUALIFIER void matrix_batch_store_mat3(float * Dst, glm_vec4 Col0, glm_vec4 Col1, glm_vec4 Col2, bool Overlap)
+	{
+		_mm_storeu_ps(Dst + 0, Col0);
+		_mm_storeu_ps(Dst + 3, Col1);
+		if(Overlap)
+			_mm_storeu_ps(Dst + 6, Col2);
+		else
+		{
+			_mm_storel_pi(reinterpret_cast<__m64 *>(Dst + 6), Col2);
+			_mm_store_ss(Dst + 8, _mm_movehl_ps(Col2, Col2));
+		}
+	}
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER __m256 matrix_batch_cross_avx(__m256 v1, __m256 v2)
+	{
+		__m256 const swp0 = _mm256_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 0, 2, 1));
+		__m256 const swp1 = _mm256_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 1, 0, 2));
+		__m256 const swp2 = _mm256_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 0, 2, 1));
+		__m256 const swp3 = _mm256_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 1, 0, 2));
+		__m256 const mul0 = _mm256_mul_ps(swp0, swp3);
+		__m256 const mul1 = _mm256_mul_ps(swp1, swp2);
+		__m256 const sub0 = _mm256_sub_ps(mul0, mul1);
+		return sub0;
+	}
+
+	// Same operations as glm_vec3_dot in each 128 bits lane
+	GLM_FUNC_QUALIFIER __m256 matrix_batch_dot_avx(__m256 v1, __m256 v2)
+	{
+		__m256 const mul0 = _mm256_mul_ps(v1, v2);
+		__m256 const swp0 = _mm256_shuffle_ps(mul0, mul0, _MM_SHUFFLE(0, 0, 0, 0));
+		__m256 const swp1 = _mm256_shuffle_ps(mul0, mul0, _MM_SHUFFLE(1, 1, 1, 1));
+		__m256 const swp2 = _mm256_shuffle_ps(mul0, mul0, _MM_SHUFFLE(2, 2, 2, 2));
+		__m256 const add0 = _mm256_add_ps(swp0, swp1);
+		__m256 const add1 = _mm256_add_ps(add0, swp2);
+		return add1;
+	}
+#	endif
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void normalMatrixBatch(std::size_t Count, mat4 const * ModelView, mat3 * Out)
+	{
+		std::size_t i = 0;
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		if(sizeof(mat4) == sizeof(float) * 16 && sizeof(mat3) == sizeof(float) * 9)
+		{
+			float const * Src = reinterpret_cast<float const *>(ModelView);
+			float * Dst = reinterpret_cast<float *>(Out);
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				// Two matrices per iteration, one in each 128 bits lane. The pair is never the last
+				// matrices so that the overlapping stores are always overwritten.
+				for(; i + 2 < Count; i += 2)
+				{
+					float const * A = Src + i * 16;
+					__m256 const Col0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(A + 0)), _mm_loadu_ps(A + 16), 1);
+					__m256 const Col1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(A + 4)), _mm_loadu_ps(A + 20), 1);
+					__m256 const Col2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(A + 8)), _mm_loadu_ps(A + 24), 1);
+
+					__m256 const Cof0 = detail::matrix_batch_cross_avx(Col1, Col2);
+					__m256 const Cof1 = detail::matrix_batch_cross_avx(Col2, Col0);
+					__m256 const Cof2 = detail::matrix_batch_cross_avx(Col0, Col1);
+					__m256 const Det = detail::matrix_batch_dot_avx(Col0, Cof0);
+
+					__m256 const Res0 = _mm256_div_ps(Cof0, Det);
+					__m256 const Res1 = _mm256_div_ps(Cof1, Det);
+					__m256 const Res2 = _mm256_div_ps(Cof2, Det);
+
+					detail::matrix_batch_store_mat3(Dst + i * 9, _mm256_castps256_ps128(Res0), _mm256_castps256_ps128(Res1), _mm256_castps256_ps128(Res2), true);
+					detail::matrix_batch_store_mat3(Dst + i * 9 + 9, _mm256_extractf128_ps(Res0, 1), _mm256_extractf128_ps(Res1, 1), _mm256_extractf128_ps(Res2, 1), true);
+				}
+#			endif
+
+			for(; i < Count; ++i)
+			{
+				glm_vec4 const Col[3] = {_mm_loadu_ps(Src + i * 16 + 0), _mm_loadu_ps(Src + i * 16 + 4), _mm_loadu_ps(Src + i * 16 + 8)};
+				glm_vec4 Res[3];
+				glm_mat3_inverseTranspose(Col, Res);
+				detail::matrix_batch_store_mat3(Dst + i * 9, Res[0], Res[1], Res[2], i + 1 < Count);
+			}
+		}
+#		endif
+
+		for(; i < Count; ++i)
+			Out[i] = inverseTranspose(mat3(ModelView[i]));
+	}
+}//namespace glm
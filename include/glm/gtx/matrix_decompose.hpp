@@ -19,6 +19,9 @@
 #include "../geometric.hpp"
 #include "../gtc/quaternion.hpp"
 #include "../gtc/matrix_transform.hpp"
+#include "../gtc/constants.hpp"
+#include <cstddef>
+#include <limits>
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_matrix_decompose is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -40,6 +43,27 @@ namespace glm
 		tmat4x4<T, P> const & modelMatrix,
 		tvec3<T, P> & scale, tquat<T, P> & orientation, tvec3<T, P> & translation, tvec3<T, P> & skew, tvec4<T, P> & perspective);
 
+	/// Decomposes Count model matrices, each output is a separate array of Count elements.
+	/// Matrices without perspective and with columns orthogonal within ShearEpsilon take a fast path,
+	/// vectorized with SSE2 for float. The others go through decompose.
+	/// skew and perspective may be null. Elements decompose fails on are written as identity with a null scale.
+	/// Returns the number of elements that took the fast path.
+	/// @see gtx_matrix_decompose
+	template <typename T, precision P>
+	GLM_FUNC_DECL std::size_t decomposeBatch(
+		std::size_t count, tmat4x4<T, P> const * modelMatrices,
+		tvec3<T, P> * scale, tquat<T, P> * orientation, tvec3<T, P> * translation,
+		tvec3<T, P> * skew = NULL, tvec4<T, P> * perspective = NULL,
+		T shearEpsilon = epsilon<T>() * static_cast<T>(64));
+
+	/// Builds Count translation * rotation * scale matrices from separate arrays of components.
+	/// @see gtx_matrix_decompose
+	template <typename T, precision P>
+	GLM_FUNC_DECL void recomposeBatch(
+		std::size_t count,
+		tvec3<T, P> const * scale, tquat<T, P> const * orientation, tvec3<T, P> const * translation,
+		tmat4x4<T, P> * modelMatrices);
+
 	/// @}
 }//namespace glm
 
@@ -20,6 +20,55 @@ namespace detail
 	{
 		return v * desiredLength / length(v);
 	}
+
+	// Extracts the rotation of an orthonormal basis, given by the columns of the matrix.
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void decompose_rotation(tvec3<T, P> const Row[3], tquat<T, P> & Orientation)
+	{
+		// FIXME - Add the ability to return either quaternions (which are
+		// easier to recompose with) or Euler angles (rx, ry, rz), which
+		// are easier for authors to deal with. The latter will only be useful
+		// when we fix https://bugs.webkit.org/show_bug.cgi?id=23799, so I
+		// will leave the Euler angle code here for now.
+
+		// ret.rotateY = asin(-Row[0][2]);
+		// if (cos(ret.rotateY) != 0) {
+		//     ret.rotateX = atan2(Row[1][2], Row[2][2]);
+		//     ret.rotateZ = atan2(Row[0][1], Row[0][0]);
+		// } else {
+		//     ret.rotateX = atan2(-Row[2][0], Row[1][1]);
+		//     ret.rotateZ = 0;
+		// }
+
+		int i, j, k = 0;
+		float root, trace = Row[0].x + Row[1].y + Row[2].z;
+		if(trace > static_cast<T>(0))
+		{
+			root = sqrt(trace + static_cast<T>(1.0));
+			Orientation.w = static_cast<T>(0.5) * root;
+			root = static_cast<T>(0.5) / root;
+			Orientation.x = root * (Row[1].z - Row[2].y);
+			Orientation.y = root * (Row[2].x - Row[0].z);
+			Orientation.z = root * (Row[0].y - Row[1].x);
+		} // End if > 0
+		else
+		{
+			static int Next[3] = {1, 2, 0};
+			i = 0;
+			if(Row[1].y > Row[0].x) i = 1;
+			if(Row[2].z > Row[i][i]) i = 2;
+			j = Next[i];
+			k = Next[j];
+
+			root = sqrt(Row[i][i] - Row[j][j] - Row[k][k] + static_cast<T>(1.0));
+
+			Orientation[i] = static_cast<T>(0.5) * root;
+			root = static_cast<T>(0.5) / root;
+			Orientation[j] = root * (Row[i][j] + Row[j][i]);
+			Orientation[k] = root * (Row[i][k] + Row[k][i]);
+			Orientation.w = root * (Row[j][k] - Row[k][j]);
+		} // End if <= 0
+	}
 }//namespace detail
 
 	// Matrix decompose
@@ -131,51 +180,354 @@ namespace detail
 		}
 
 		// Now, get the rotations out, as described in the gem.
+		detail::decompose_rotation(Row, Orientation);
 
-		// FIXME - Add the ability to return either quaternions (which are
-		// easier to recompose with) or Euler angles (rx, ry, rz), which
-		// are easier for authors to deal with. The latter will only be useful
-		// when we fix https://bugs.webkit.org/show_bug.cgi?id=23799, so I
-		// will leave the Euler angle code here for now.
+		return true;
+	}
+namespace detail
+{
+	// Decomposition of matrices without perspective and shear. Returns false when the general path is required.
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool decompose_fast(tmat4x4<T, P> const & ModelMatrix, T ShearEpsilon, tvec3<T, P> & Scale, tquat<T, P> & Orientation, tvec3<T, P> & Translation)
+	{
+		if(ModelMatrix[0][3] != static_cast<T>(0) || ModelMatrix[1][3] != static_cast<T>(0) || ModelMatrix[2][3] != static_cast<T>(0) || ModelMatrix[3][3] != static_cast<T>(1))
+			return false;
 
-		// ret.rotateY = asin(-Row[0][2]);
-		// if (cos(ret.rotateY) != 0) {
-		//     ret.rotateX = atan2(Row[1][2], Row[2][2]);
-		//     ret.rotateZ = atan2(Row[0][1], Row[0][0]);
-		// } else {
-		//     ret.rotateX = atan2(-Row[2][0], Row[1][1]);
-		//     ret.rotateZ = 0;
-		// }
+		tvec3<T, P> Row[3] = {tvec3<T, P>(ModelMatrix[0]), tvec3<T, P>(ModelMatrix[1]), tvec3<T, P>(ModelMatrix[2])};
+		tvec3<T, P> const Length2(dot(Row[0], Row[0]), dot(Row[1], Row[1]), dot(Row[2], Row[2]));
+		if(!(Length2.x > std::numeric_limits<T>::min() && Length2.y > std::numeric_limits<T>::min() && Length2.z > std::numeric_limits<T>::min()))
+			return false;
 
-		int i, j, k = 0;
-		float root, trace = Row[0].x + Row[1].y + Row[2].z;
-		if(trace > static_cast<T>(0))
+		// Columns orthogonal within ShearEpsilon: |dot(a, b)| <= ShearEpsilon * |a| * |b|
+		T const Epsilon2 = ShearEpsilon * ShearEpsilon;
+		T const Dot01 = dot(Row[0], Row[1]);
+		T const Dot02 = dot(Row[0], Row[2]);
+		T const Dot12 = dot(Row[1], Row[2]);
+		if(Dot01 * Dot01 > Epsilon2 * Length2.x * Length2.y || Dot02 * Dot02 > Epsilon2 * Length2.x * Length2.z || Dot12 * Dot12 > Epsilon2 * Length2.y * Length2.z)
+			return false;
+
+		Scale = sqrt(Length2);
+		for(length_t i = 0; i < 3; ++i)
+			Row[i] /= Scale[i];
+
+		if(dot(Row[0], cross(Row[1], Row[2])) < static_cast<T>(0))
 		{
-			root = sqrt(trace + static_cast<T>(1.0));
-			Orientation.w = static_cast<T>(0.5) * root;
-			root = static_cast<T>(0.5) / root;
-			Orientation.x = root * (Row[1].z - Row[2].y);
-			Orientation.y = root * (Row[2].x - Row[0].z);
-			Orientation.z = root * (Row[0].y - Row[1].x);
-		} // End if > 0
-		else
+			Scale = -Scale;
+			for(length_t i = 0; i < 3; ++i)
+				Row[i] = -Row[i];
+		}
+
+		decompose_rotation(Row, Orientation);
+		Translation = tvec3<T, P>(ModelMatrix[3]);
+		return true;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void decompose_element(
+		std::size_t i, tmat4x4<T, P> const * ModelMatrices,
+		tvec3<T, P> * Scale, tquat<T, P> * Orientation, tvec3<T, P> * Translation,
+		tvec3<T, P> * Skew, tvec4<T, P> * Perspective)
+	{
+		tvec3<T, P> LocalSkew;
+		tvec4<T, P> LocalPerspective;
+		if(!decompose(ModelMatrices[i], Scale[i], Orientation[i], Translation[i], LocalSkew, LocalPerspective))
 		{
-			static int Next[3] = {1, 2, 0};
-			i = 0;
-			if(Row[1].y > Row[0].x) i = 1;
-			if(Row[2].z > Row[i][i]) i = 2;
-			j = Next[i];
-			k = Next[j];
+			Scale[i] = tvec3<T, P>(static_cast<T>(0));
+			Orientation[i] = tquat<T, P>(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+			Translation[i] = tvec3<T, P>(static_cast<T>(0));
+			LocalSkew = tvec3<T, P>(static_cast<T>(0));
+			LocalPerspective = tvec4<T, P>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1));
+		}
+		if(Skew)
+			Skew[i] = LocalSkew;
+		if(Perspective)
+			Perspective[i] = LocalPerspective;
+	}
 
-			root = sqrt(Row[i][i] - Row[j][j] - Row[k][k] + static_cast<T>(1.0));
+	template <typename T, precision P, bool UseSimd = true>
+	struct compute_decompose_batch
+	{
+		GLM_FUNC_QUALIFIER static std::size_t call(
+			std::size_t Count, tmat4x4<T, P> const * ModelMatrices,
+			tvec3<T, P> * Scale, tquat<T, P> * Orientation, tvec3<T, P> * Translation,
+			tvec3<T, P> * Skew, tvec4<T, P> * Perspective, T ShearEpsilon)
+		{
+			std::size_t FastCount = 0;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				if(decompose_fast(ModelMatrices[i], ShearEpsilon, Scale[i], Orientation[i], Translation[i]))
+				{
+					if(Skew)
+						Skew[i] = tvec3<T, P>(static_cast<T>(0));
+					if(Perspective)
+						Perspective[i] = tvec4<T, P>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1));
+					++FastCount;
+				}
+				else
+					decompose_element(i, ModelMatrices, Scale, Orientation, Translation, Skew, Perspective);
+			}
+			return FastCount;
+		}
+	};
 
-			Orientation[i] = static_cast<T>(0.5) * root;
-			root = static_cast<T>(0.5) / root;
-			Orientation[j] = root * (Row[i][j] + Row[j][i]);
-			Orientation[k] = root * (Row[i][k] + Row[k][i]);
-			Orientation.w = root * (Row[j][k] - Row[k][j]);
-		} // End if <= 0
+	template <typename T, precision P, bool UseSimd = true>
+	struct compute_recompose_batch
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			std::size_t Count,
+			tvec3<T, P> const * Scale, tquat<T, P> const * Orientation, tvec3<T, P> const * Translation,
+			tmat4x4<T, P> * ModelMatrices)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				tmat3x3<T, P> const Rotation = mat3_cast(Orientation[i]);
+				ModelMatrices[i][0] = tvec4<T, P>(Rotation[0] * Scale[i].x, static_cast<T>(0));
+				ModelMatrices[i][1] = tvec4<T, P>(Rotation[1] * Scale[i].y, static_cast<T>(0));
+				ModelMatrices[i][2] = tvec4<T, P>(Rotation[2] * Scale[i].z, static_cast<T>(0));
+				ModelMatrices[i][3] = tvec4<T, P>(Translation[i], static_cast<T>(1));
+			}
+		}
+	};
 
-		return true;
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Four matrices per iteration, each lane of a register holds one matrix.
+	template <precision P>
+	struct compute_decompose_batch<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static std::size_t call(
+			std::size_t Count, tmat4x4<float, P> const * ModelMatrices,
+			tvec3<float, P> * Scale, tquat<float, P> * Orientation, tvec3<float, P> * Translation,
+			tvec3<float, P> * Skew, tvec4<float, P> * Perspective, float ShearEpsilon)
+		{
+			__m128 const Zero = _mm_setzero_ps();
+			__m128 const One = _mm_set1_ps(1.0f);
+			__m128 const Half = _mm_set1_ps(0.5f);
+			__m128 const Epsilon2 = _mm_set1_ps(ShearEpsilon * ShearEpsilon);
+			__m128 const MinLength2 = _mm_set1_ps(std::numeric_limits<float>::min());
+
+			std::size_t FastCount = 0;
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				// C[c][j]: component j of column c for the four matrices
+				__m128 C[4][4];
+				for(length_t c = 0; c < 4; ++c)
+				{
+					C[c][0] = _mm_loadu_ps(&ModelMatrices[i + 0][c][0]);
+					C[c][1] = _mm_loadu_ps(&ModelMatrices[i + 1][c][0]);
+					C[c][2] = _mm_loadu_ps(&ModelMatrices[i + 2][c][0]);
+					C[c][3] = _mm_loadu_ps(&ModelMatrices[i + 3][c][0]);
+					_MM_TRANSPOSE4_PS(C[c][0], C[c][1], C[c][2], C[c][3]);
+				}
+
+				__m128 Fast = _mm_and_ps(_mm_cmpeq_ps(C[0][3], Zero), _mm_cmpeq_ps(C[1][3], Zero));
+				Fast = _mm_and_ps(Fast, _mm_and_ps(_mm_cmpeq_ps(C[2][3], Zero), _mm_cmpeq_ps(C[3][3], One)));
+
+				__m128 Length2[3], Dot[3];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					Length2[c] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(C[c][0], C[c][0]), _mm_mul_ps(C[c][1], C[c][1])), _mm_mul_ps(C[c][2], C[c][2]));
+					Fast = _mm_and_ps(Fast, _mm_cmpgt_ps(Length2[c], MinLength2));
+				}
+				for(length_t c = 0; c < 3; ++c)
+				{
+					length_t const a = c == 2 ? 1 : 0;
+					length_t const b = c == 0 ? 1 : 2;
+					Dot[c] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(C[a][0], C[b][0]), _mm_mul_ps(C[a][1], C[b][1])), _mm_mul_ps(C[a][2], C[b][2]));
+					Fast = _mm_and_ps(Fast, _mm_cmple_ps(_mm_mul_ps(Dot[c], Dot[c]), _mm_mul_ps(Epsilon2, _mm_mul_ps(Length2[a], Length2[b]))));
+				}
+
+				int const FastBits = _mm_movemask_ps(Fast);
+				if(FastBits == 0)
+				{
+					for(std::size_t l = 0; l < 4; ++l)
+						decompose_element(i + l, ModelMatrices, Scale, Orientation, Translation, Skew, Perspective);
+					continue;
+				}
+
+				// Normalize the columns
+				__m128 S[3], R[3][3];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					S[c] = _mm_sqrt_ps(Length2[c]);
+					__m128 const InvS = _mm_div_ps(One, S[c]);
+					for(length_t j = 0; j < 3; ++j)
+						R[c][j] = _mm_mul_ps(C[c][j], InvS);
+				}
+
+				// Coordinate system flip
+				__m128 const CrossX = _mm_sub_ps(_mm_mul_ps(R[1][1], R[2][2]), _mm_mul_ps(R[1][2], R[2][1]));
+				__m128 const CrossY = _mm_sub_ps(_mm_mul_ps(R[1][2], R[2][0]), _mm_mul_ps(R[1][0], R[2][2]));
+				__m128 const CrossZ = _mm_sub_ps(_mm_mul_ps(R[1][0], R[2][1]), _mm_mul_ps(R[1][1], R[2][0]));
+				__m128 const Det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(R[0][0], CrossX), _mm_mul_ps(R[0][1], CrossY)), _mm_mul_ps(R[0][2], CrossZ));
+				__m128 const Flip = _mm_and_ps(_mm_cmplt_ps(Det, Zero), _mm_set1_ps(-0.0f));
+				for(length_t c = 0; c < 3; ++c)
+				{
+					S[c] = _mm_xor_ps(S[c], Flip);
+					for(length_t j = 0; j < 3; ++j)
+						R[c][j] = _mm_xor_ps(R[c][j], Flip);
+				}
+
+				// Branchless version of decompose_rotation: select the case per lane, then evaluate it once
+				__m128 const Trace = _mm_add_ps(_mm_add_ps(R[0][0], R[1][1]), R[2][2]);
+				__m128 const CaseW = _mm_cmpgt_ps(Trace, Zero);
+				__m128 const Y = _mm_cmpgt_ps(R[1][1], R[0][0]);
+				__m128 const Z = _mm_cmpgt_ps(R[2][2], _mm_max_ps(R[0][0], R[1][1]));
+				__m128 const CaseZ = _mm_andnot_ps(CaseW, Z);
+				__m128 const CaseY = _mm_andnot_ps(_mm_or_ps(CaseW, Z), Y);
+				__m128 const CaseX = _mm_andnot_ps(_mm_or_ps(_mm_or_ps(CaseW, CaseY), CaseZ), _mm_castsi128_ps(_mm_set1_epi32(-1)));
+
+				__m128 const Sum01 = _mm_add_ps(R[0][1], R[1][0]);
+				__m128 const Sum02 = _mm_add_ps(R[0][2], R[2][0]);
+				__m128 const Sum12 = _mm_add_ps(R[1][2], R[2][1]);
+				__m128 const Diff01 = _mm_sub_ps(R[0][1], R[1][0]);
+				__m128 const Diff20 = _mm_sub_ps(R[2][0], R[0][2]);
+				__m128 const Diff12 = _mm_sub_ps(R[1][2], R[2][1]);
+
+#				define GLM_DECOMPOSE_SELECT(w, x, y, z) _mm_or_ps(_mm_or_ps(_mm_and_ps(CaseW, w), _mm_and_ps(CaseX, x)), _mm_or_ps(_mm_and_ps(CaseY, y), _mm_and_ps(CaseZ, z)))
+				__m128 const Root = _mm_sqrt_ps(_mm_add_ps(GLM_DECOMPOSE_SELECT(
+					Trace,
+					_mm_sub_ps(_mm_sub_ps(R[0][0], R[1][1]), R[2][2]),
+					_mm_sub_ps(_mm_sub_ps(R[1][1], R[2][2]), R[0][0]),
+					_mm_sub_ps(_mm_sub_ps(R[2][2], R[0][0]), R[1][1])), One));
+				__m128 const Big = _mm_mul_ps(Half, Root);
+				__m128 const Factor = _mm_div_ps(Half, Root);
+				__m128 const QuatX = GLM_DECOMPOSE_SELECT(_mm_mul_ps(Factor, Diff12), Big, _mm_mul_ps(Factor, Sum01), _mm_mul_ps(Factor, Sum02));
+				__m128 const QuatY = GLM_DECOMPOSE_SELECT(_mm_mul_ps(Factor, Diff20), _mm_mul_ps(Factor, Sum01), Big, _mm_mul_ps(Factor, Sum12));
+				__m128 const QuatZ = GLM_DECOMPOSE_SELECT(_mm_mul_ps(Factor, Diff01), _mm_mul_ps(Factor, Sum02), _mm_mul_ps(Factor, Sum12), Big);
+				__m128 const QuatW = GLM_DECOMPOSE_SELECT(Big, _mm_mul_ps(Factor, Diff12), _mm_mul_ps(Factor, Diff20), _mm_mul_ps(Factor, Diff01));
+#				undef GLM_DECOMPOSE_SELECT
+
+				GLM_ALIGN(16) float Out[10][4];
+				_mm_store_ps(Out[0], S[0]);
+				_mm_store_ps(Out[1], S[1]);
+				_mm_store_ps(Out[2], S[2]);
+				_mm_store_ps(Out[3], QuatX);
+				_mm_store_ps(Out[4], QuatY);
+				_mm_store_ps(Out[5], QuatZ);
+				_mm_store_ps(Out[6], QuatW);
+				_mm_store_ps(Out[7], C[3][0]);
+				_mm_store_ps(Out[8], C[3][1]);
+				_mm_store_ps(Out[9], C[3][2]);
+
+				for(std::size_t l = 0; l < 4; ++l)
+				{
+					if(!(FastBits & (1 << l)))
+					{
+						decompose_element(i + l, ModelMatrices, Scale, Orientation, Translation, Skew, Perspective);
+						continue;
+					}
+
+					Scale[i + l] = tvec3<float, P>(Out[0][l], Out[1][l], Out[2][l]);
+					Orientation[i + l] = tquat<float, P>(Out[6][l], Out[3][l], Out[4][l], Out[5][l]);
+					Translation[i + l] = tvec3<float, P>(Out[7][l], Out[8][l], Out[9][l]);
+					if(Skew)
+						Skew[i + l] = tvec3<float, P>(0.0f);
+					if(Perspective)
+						Perspective[i + l] = tvec4<float, P>(0.0f, 0.0f, 0.0f, 1.0f);
+					++FastCount;
+				}
+			}
+
+			return FastCount + compute_decompose_batch<float, P, false>::call(
+				Count - i, ModelMatrices + i, Scale + i, Orientation + i, Translation + i,
+				Skew ? Skew + i : NULL, Perspective ? Perspective + i : NULL, ShearEpsilon);
+		}
+	};
+
+	template <precision P>
+	struct compute_recompose_batch<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			std::size_t Count,
+			tvec3<float, P> const * Scale, tquat<float, P> const * Orientation, tvec3<float, P> const * Translation,
+			tmat4x4<float, P> * ModelMatrices)
+		{
+			__m128 const One = _mm_set1_ps(1.0f);
+			__m128 const Two = _mm_set1_ps(2.0f);
+
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				__m128 QuatX = _mm_loadu_ps(&Orientation[i + 0].x);
+				__m128 QuatY = _mm_loadu_ps(&Orientation[i + 1].x);
+				__m128 QuatZ = _mm_loadu_ps(&Orientation[i + 2].x);
+				__m128 QuatW = _mm_loadu_ps(&Orientation[i + 3].x);
+				_MM_TRANSPOSE4_PS(QuatX, QuatY, QuatZ, QuatW);
+
+				__m128 const S[3] = {
+					_mm_setr_ps(Scale[i + 0].x, Scale[i + 1].x, Scale[i + 2].x, Scale[i + 3].x),
+					_mm_setr_ps(Scale[i + 0].y, Scale[i + 1].y, Scale[i + 2].y, Scale[i + 3].y),
+					_mm_setr_ps(Scale[i + 0].z, Scale[i + 1].z, Scale[i + 2].z, Scale[i + 3].z)};
+
+				__m128 const XX = _mm_mul_ps(QuatX, QuatX);
+				__m128 const YY = _mm_mul_ps(QuatY, QuatY);
+				__m128 const ZZ = _mm_mul_ps(QuatZ, QuatZ);
+				__m128 const XZ = _mm_mul_ps(QuatX, QuatZ);
+				__m128 const XY = _mm_mul_ps(QuatX, QuatY);
+				__m128 const YZ = _mm_mul_ps(QuatY, QuatZ);
+				__m128 const WX = _mm_mul_ps(QuatW, QuatX);
+				__m128 const WY = _mm_mul_ps(QuatW, QuatY);
+				__m128 const WZ = _mm_mul_ps(QuatW, QuatZ);
+
+				// Same terms as mat3_cast, Col[c][j] is component j of column c for the four matrices
+				__m128 Col[4][4];
+				Col[0][0] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(YY, ZZ)));
+				Col[0][1] = _mm_mul_ps(Two, _mm_add_ps(XY, WZ));
+				Col[0][2] = _mm_mul_ps(Two, _mm_sub_ps(XZ, WY));
+				Col[1][0] = _mm_mul_ps(Two, _mm_sub_ps(XY, WZ));
+				Col[1][1] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(XX, ZZ)));
+				Col[1][2] = _mm_mul_ps(Two, _mm_add_ps(YZ, WX));
+				Col[2][0] = _mm_mul_ps(Two, _mm_add_ps(XZ, WY));
+				Col[2][1] = _mm_mul_ps(Two, _mm_sub_ps(YZ, WX));
+				Col[2][2] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(XX, YY)));
+				for(length_t c = 0; c < 3; ++c)
+				{
+					for(length_t j = 0; j < 3; ++j)
+						Col[c][j] = _mm_mul_ps(Col[c][j], S[c]);
+					Col[c][3] = _mm_setzero_ps();
+				}
+				Col[3][0] = _mm_setr_ps(Translation[i + 0].x, Translation[i + 1].x, Translation[i + 2].x, Translation[i + 3].x);
+				Col[3][1] = _mm_setr_ps(Translation[i + 0].y, Translation[i + 1].y, Translation[i + 2].y, Translation[i + 3].y);
+				Col[3][2] = _mm_setr_ps(Translation[i + 0].z, Translation[i + 1].z, Translation[i + 2].z, Translation[i + 3].z);
+				Col[3][3] = One;
+
+				for(length_t c = 0; c < 4; ++c)
+				{
+					_MM_TRANSPOSE4_PS(Col[c][0], Col[c][1], Col[c][2], Col[c][3]);
+					_mm_storeu_ps(&ModelMatrices[i + 0][c][0], Col[c][0]);
+					_mm_storeu_ps(&ModelMatrices[i + 1][c][0], Col[c][1]);
+					_mm_storeu_ps(&ModelMatrices[i + 2][c][0], Col[c][2]);
+					_mm_storeu_ps(&ModelMatrices[i + 3][c][0], Col[c][3]);
+				}
+			}
+
+			compute_recompose_batch<float, P, false>::call(Count - i, Scale + i, Orientation + i, Translation + i, ModelMatrices + i);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER std::size_t decomposeBatch
+	(
+		std::size_t Count, tmat4x4<T, P> const * ModelMatrices,
+		tvec3<T, P> * Scale, tquat<T, P> * Orientation, tvec3<T, P> * Translation,
+		tvec3<T, P> * Skew, tvec4<T, P> * Perspective,
+		T ShearEpsilon
+	)
+	{
+		return detail::compute_decompose_batch<T, P>::call(Count, ModelMatrices, Scale, Orientation, Translation, Skew, Perspective, ShearEpsilon);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void recomposeBatch
+	(
+		std::size_t Count,
+		tvec3<T, P> const * Scale, tquat<T, P> const * Orientation, tvec3<T, P> const * Translation,
+		tmat4x4<T, P> * ModelMatrices
+	)
+	{
+		detail::compute_recompose_batch<T, P>::call(Count, Scale, Orientation, Translation, ModelMatrices);
 	}
 }//namespace glm
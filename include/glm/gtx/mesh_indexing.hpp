@@ -0,0 +1,84 @@
+/// @ref gtx_mesh_indexing
+/// @file glm/gtx/mesh_indexing.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_mesh_indexing GLM_GTX_mesh_indexing
+/// @ingroup gtx
+///
+/// @brief Vertex deduplication and index buffer generation for interleaved vertex streams.
+///
+/// Vertices are compared as raw bytes, so any interleaved layout works, for example a struct of
+/// a vec3 position and a vec2 texture coordinate. Duplicates are found with a flat open addressing
+/// table and a hash that mixes 16 bytes of the vertex per step. The welding mode instead merges
+/// vertices whose float components are within an epsilon of each other.
+///
+/// <glm/gtx/mesh_indexing.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_mesh_indexing is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_mesh_indexing extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_mesh_indexing
+	/// @{
+
+	/// Unique vertices and index buffer ready to be uploaded with glBufferData.
+	struct indexed_mesh
+	{
+		GLM_FUNC_DECL indexed_mesh();
+
+		/// vertexCount vertices of stride bytes.
+		std::vector<unsigned char> vertices;
+		std::size_t vertexCount;
+		std::size_t stride;
+		/// indexCount indices of indexSize bytes: 2 (GL_UNSIGNED_SHORT) when there are at most 65535
+		/// vertices, keeping 0xFFFF free for primitive restart, 4 (GL_UNSIGNED_INT) otherwise.
+		std::vector<unsigned char> indices;
+		std::size_t indexCount;
+		std::size_t indexSize;
+	};
+
+	/// Find the first occurrence of each vertex, comparing all Stride bytes.
+	/// Remap[i] is the index of vertex i in the list of unique vertices, in order of first occurrence.
+	/// Returns the number of unique vertices. Note that 0.0 and -0.0 are different vertices.
+	/// @see gtx_mesh_indexing
+	GLM_FUNC_DECL std::size_t generateVertexRemap(
+		std::size_t VertexCount, void const * Vertices, std::size_t Stride, uint32 * Remap);
+
+	/// Merge the vertices whose float components all differ by Epsilon or less.
+	/// Each vertex is Stride / 4 floats and candidates are searched on a grid over the vec3 at PositionOffset bytes.
+	/// A vertex is merged with the first unique vertex it matches. Returns the number of unique vertices.
+	/// @see gtx_mesh_indexing
+	GLM_FUNC_DECL std::size_t generateVertexRemapWeld(
+		std::size_t VertexCount, void const * Vertices, std::size_t Stride,
+		std::size_t PositionOffset, float Epsilon, uint32 * Remap);
+
+	/// Copy the unique vertices of a remap in Destination, UniqueCount * Stride bytes.
+	/// @see gtx_mesh_indexing
+	GLM_FUNC_DECL void remapVertexBuffer(
+		std::size_t VertexCount, void const * Vertices, std::size_t Stride,
+		uint32 const * Remap, void * Destination);
+
+	/// Deduplicate VertexCount vertices that form a triangle list, or weld them when Epsilon > 0.
+	/// @see gtx_mesh_indexing
+	GLM_FUNC_DECL void indexVertices(
+		std::size_t VertexCount, void const * Vertices, std::size_t Stride,
+		indexed_mesh & Mesh, float Epsilon = 0.0f, std::size_t PositionOffset = 0);
+
+	/// @}
+}//namespace glm
+
+#include "mesh_indexing.inl"
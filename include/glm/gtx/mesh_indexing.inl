@@ -0,0 +1,305 @@
+/// @ref gtx_mesh_indexing
+/// @file glm/gtx/mesh_indexing.inl
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER uint32 mesh_rotl(uint32 x, int r)
+	{
+		return (x << r) | (x >> (32 - r));
+	}
+
+	// Murmur3 finalizer
+	GLM_FUNC_QUALIFIER uint32 mesh_fmix(uint32 h)
+	{
+		h ^= h >> 16;
+		h *= 0x85EBCA6Bu;
+		h ^= h >> 13;
+		h *= 0xC2B2AE35u;
+		h ^= h >> 16;
+		return h;
+	}
+
+	// Four independent lanes consume 16 bytes per step, the loop is vectorized by the compiler
+	// and the lanes are only combined at the end.
+	GLM_FUNC_QUALIFIER uint32 mesh_hash_bytes(unsigned char const * Data, std::size_t Size)
+	{
+		uint32 Lanes[4] = {0x9E3779B9u, 0x7F4A7C15u, 0x85EBCA77u, 0xC2B2AE3Du};
+
+		std::size_t i = 0;
+		for(; i + 16 <= Size; i += 16)
+		{
+			uint32 Words[4];
+			std::memcpy(Words, Data + i, 16);
+			for(std::size_t l = 0; l < 4; ++l)
+			{
+				Lanes[l] = (Lanes[l] ^ Words[l]) * 0x9E3779B1u;
+				Lanes[l] ^= Lanes[l] >> 15;
+			}
+		}
+
+		if(i < Size)
+		{
+			uint32 Words[4] = {0, 0, 0, 0};
+			std::memcpy(Words, Data + i, Size - i);
+			for(std::size_t l = 0; l < 4; ++l)
+			{
+				Lanes[l] = (Lanes[l] ^ Words[l]) * 0x9E3779B1u;
+				Lanes[l] ^= Lanes[l] >> 15;
+			}
+		}
+
+		return mesh_fmix(Lanes[0] ^ mesh_rotl(Lanes[1], 7) ^ mesh_rotl(Lanes[2], 14) ^ mesh_rotl(Lanes[3], 21) ^ static_cast<uint32>(Size));
+	}
+
+	GLM_FUNC_QUALIFIER uint32 mesh_hash_cell(ivec3 const & Cell)
+	{
+		return mesh_fmix(static_cast<uint32>(Cell.x) * 0x8DA6B343u ^ static_cast<uint32>(Cell.y) * 0xD8163841u ^ static_cast<uint32>(Cell.z) * 0xCB1AB31Fu);
+	}
+
+	// Open addressing with linear probing, kept at most half full. Slots keep the full hash to skip
+	// most of the vertex comparisons and to grow without rehashing the vertices.
+	class mesh_hash_table
+	{
+	public:
+		static uint32 const empty = 0xFFFFFFFFu;
+
+		struct slot
+		{
+			uint32 hash;
+			uint32 vertex;
+		};
+
+		// Triangle soups typically have 6 times more vertices than unique vertices
+		GLM_FUNC_QUALIFIER explicit mesh_hash_table(std::size_t VertexCount) :
+			Count(0)
+		{
+			this->allocate(VertexCount / 3);
+		}
+
+		GLM_FUNC_QUALIFIER std::size_t first(uint32 Hash) const
+		{
+			return static_cast<std::size_t>(Hash) & this->Mask;
+		}
+
+		GLM_FUNC_QUALIFIER std::size_t next(std::size_t Slot) const
+		{
+			return (Slot + 1) & this->Mask;
+		}
+
+		// Fill an empty slot found by probing, may grow the table
+		GLM_FUNC_QUALIFIER void insert(std::size_t Slot, uint32 Hash, uint32 Vertex)
+		{
+			this->Slots[Slot].hash = Hash;
+			this->Slots[Slot].vertex = Vertex;
+			if(++this->Count * 2 <= this->Slots.size())
+				return;
+
+			std::vector<slot> Old;
+			Old.swap(this->Slots);
+			this->allocate(Old.size() * 2);
+			for(std::size_t i = 0; i < Old.size(); ++i)
+			{
+				if(Old[i].vertex == empty)
+					continue;
+				std::size_t j = this->first(Old[i].hash);
+				while(this->Slots[j].vertex != empty)
+					j = this->next(j);
+				this->Slots[j] = Old[i];
+			}
+		}
+
+		std::vector<slot> Slots;
+
+	private:
+		GLM_FUNC_QUALIFIER void allocate(std::size_t Capacity)
+		{
+			std::size_t Size = 16;
+			while(Size < Capacity)
+				Size *= 2;
+			slot const Empty = {0, empty};
+			this->Slots.assign(Size, Empty);
+			this->Mask = Size - 1;
+		}
+
+		std::size_t Mask;
+		std::size_t Count;
+	};
+
+	GLM_FUNC_QUALIFIER ivec3 mesh_cell(vec3 const & Position, float CellSize)
+	{
+		return ivec3(floor(Position / CellSize));
+	}
+
+	GLM_FUNC_QUALIFIER bool mesh_weld_equal(float const * a, float const * b, std::size_t Count, float Epsilon)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			if(!(std::fabs(a[i] - b[i]) <= Epsilon))
+				return false;
+		return true;
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER indexed_mesh::indexed_mesh() :
+		vertexCount(0),
+		stride(0),
+		indexCount(0),
+		indexSize(2)
+	{}
+
+	GLM_FUNC_QUALIFIER std::size_t generateVertexRemap(
+		std::size_t VertexCount, void const * Vertices, std::size_t Stride, uint32 * Remap)
+	{
+		unsigned char const * Data = static_cast<unsigned char const *>(Vertices);
+		detail::mesh_hash_table Table(VertexCount);
+		// Source index of each unique vertex
+		std::vector<uint32> Unique;
+		Unique.reserve(VertexCount);
+
+		for(std::size_t i = 0; i < VertexCount; ++i)
+		{
+			unsigned char const * Vertex = Data + i * Stride;
+			uint32 const Hash = detail::mesh_hash_bytes(Vertex, Stride);
+
+			std::size_t Slot = Table.first(Hash);
+			for(;; Slot = Table.next(Slot))
+			{
+				detail::mesh_hash_table::slot & Entry = Table.Slots[Slot];
+				if(Entry.vertex == detail::mesh_hash_table::empty)
+				{
+					Remap[i] = static_cast<uint32>(Unique.size());
+					Unique.push_back(static_cast<uint32>(i));
+					Table.insert(Slot, Hash, Remap[i]);
+					break;
+				}
+				if(Entry.hash == Hash && std::memcmp(Data + Unique[Entry.vertex] * Stride, Vertex, Stride) == 0)
+				{
+					Remap[i] = Entry.vertex;
+					break;
+				}
+			}
+		}
+
+		return Unique.size();
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t generateVertexRemapWeld(
+		std::size_t VertexCount, void const * Vertices, std::size_t Stride,
+		std::size_t PositionOffset, float Epsilon, uint32 * Remap)
+	{
+		assert(Stride % sizeof(float) == 0 && PositionOffset + sizeof(vec3) <= Stride);
+
+		if(!(Epsilon > 0.0f))
+			return generateVertexRemap(VertexCount, Vertices, Stride, Remap);
+
+		unsigned char const * Data = static_cast<unsigned char const *>(Vertices);
+		std::size_t const FloatCount = Stride / sizeof(float);
+		// Cells twice the size of epsilon: the neighborhood of a vertex overlaps at most 2 cells per axis
+		float const CellSize = Epsilon * 2.0f;
+
+		detail::mesh_hash_table Table(VertexCount);
+		std::vector<uint32> Unique;
+		Unique.reserve(VertexCount);
+		std::vector<float> Vertex(FloatCount);
+		std::vector<float> Candidate(FloatCount);
+
+		for(std::size_t i = 0; i < VertexCount; ++i)
+		{
+			std::memcpy(&Vertex[0], Data + i * Stride, Stride);
+			vec3 Position;
+			std::memcpy(&Position[0], Data + i * Stride + PositionOffset, sizeof(vec3));
+
+			ivec3 const Low = detail::mesh_cell(Position - Epsilon, CellSize);
+			ivec3 const High = detail::mesh_cell(Position + Epsilon, CellSize);
+
+			uint32 Match = detail::mesh_hash_table::empty;
+			for(int z = Low.z; z <= High.z && Match == detail::mesh_hash_table::empty; ++z)
+			for(int y = Low.y; y <= High.y && Match == detail::mesh_hash_table::empty; ++y)
+			for(int x = Low.x; x <= High.x && Match == detail::mesh_hash_table::empty; ++x)
+			{
+				uint32 const Hash = detail::mesh_hash_cell(ivec3(x, y, z));
+				for(std::size_t Slot = Table.first(Hash); Table.Slots[Slot].vertex != detail::mesh_hash_table::empty; Slot = Table.next(Slot))
+				{
+					detail::mesh_hash_table::slot const & Entry = Table.Slots[Slot];
+					if(Entry.hash != Hash)
+						continue;
+					std::memcpy(&Candidate[0], Data + Unique[Entry.vertex] * Stride, Stride);
+					if(detail::mesh_weld_equal(&Vertex[0], &Candidate[0], FloatCount, Epsilon))
+					{
+						Match = Entry.vertex;
+						break;
+					}
+				}
+			}
+
+			if(Match != detail::mesh_hash_table::empty)
+			{
+				Remap[i] = Match;
+				continue;
+			}
+
+			// Several unique vertices may share a cell, they are stored in the probe sequence of the cell hash
+			uint32 const Hash = detail::mesh_hash_cell(detail::mesh_cell(Position, CellSize));
+			std::size_t Slot = Table.first(Hash);
+			while(Table.Slots[Slot].vertex != detail::mesh_hash_table::empty)
+				Slot = Table.next(Slot);
+			Remap[i] = static_cast<uint32>(Unique.size());
+			Unique.push_back(static_cast<uint32>(i));
+			Table.insert(Slot, Hash, Remap[i]);
+		}
+
+		return Unique.size();
+	}
+
+	GLM_FUNC_QUALIFIER void remapVertexBuffer(
+		std::size_t VertexCount, void const * Vertices, std::size_t Stride,
+		uint32 const * Remap, void * Destination)
+	{
+		unsigned char const * Src = static_cast<unsigned char const *>(Vertices);
+		unsigned char * Dst = static_cast<unsigned char *>(Destination);
+
+		// Unique vertices are numbered in order of first occurrence
+		uint32 Next = 0;
+		for(std::size_t i = 0; i < VertexCount; ++i)
+		{
+			if(Remap[i] != Next)
+				continue;
+			std::memcpy(Dst + static_cast<std::size_t>(Next) * Stride, Src + i * Stride, Stride);
+			++Next;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void indexVertices(
+		std::size_t VertexCount, void const * Vertices, std::size_t Stride,
+		indexed_mesh & Mesh, float Epsilon, std::size_t PositionOffset)
+	{
+		std::vector<uint32> Remap(VertexCount);
+		std::size_t const UniqueCount = VertexCount == 0 ? 0 : (Epsilon > 0.0f
+			? generateVertexRemapWeld(VertexCount, Vertices, Stride, PositionOffset, Epsilon, &Remap[0])
+			: generateVertexRemap(VertexCount, Vertices, Stride, &Remap[0]));
+
+		Mesh.stride = Stride;
+		Mesh.vertexCount = UniqueCount;
+		Mesh.vertices.resize(UniqueCount * Stride);
+		if(UniqueCount > 0)
+			remapVertexBuffer(VertexCount, Vertices, Stride, &Remap[0], &Mesh.vertices[0]);
+
+		Mesh.indexCount = VertexCount;
+		Mesh.indexSize = UniqueCount <= 0xFFFF ? 2 : 4;
+		Mesh.indices.resize(VertexCount * Mesh.indexSize);
+		for(std::size_t i = 0; i < VertexCount; ++i)
+		{
+			if(Mesh.indexSize == 2)
+			{
+				uint16 const Index = static_cast<uint16>(Remap[i]);
+				std::memcpy(&Mesh.indices[i * 2], &Index, 2);
+			}
+			else
+				std::memcpy(&Mesh.indices[i * 4], &Remap[i], 4);
+		}
+	}
+}//namespace glm
@@ -0,0 +1,95 @@
+/// @ref gtx_mesh_optimize
+/// @file glm/gtx/mesh_optimize.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_mesh_optimize GLM_GTX_mesh_optimize
+/// @ingroup gtx
+///
+/// @brief Reordering of indexed triangle lists for the post transform vertex cache, overdraw and vertex fetch.
+///
+/// The usual pipeline is optimizeVertexCache, then optimizeOverdraw, then optimizeVertexFetch.
+/// Triangles are ordered with Tipsify (Sander, Nehab and Barczak, Fast Triangle Reordering for
+/// Vertex Locality and Reduced Overdraw, 2007), which runs in linear time. The analyzers simulate
+/// a FIFO post transform cache and a cache of 64 bytes lines for vertex fetch, so the gains can be
+/// measured without a GPU.
+///
+/// <glm/gtx/mesh_optimize.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_mesh_optimize is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_mesh_optimize extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_mesh_optimize
+	/// @{
+
+	/// Post transform vertex cache efficiency of a triangle list.
+	struct vertex_cache_statistics
+	{
+		/// Number of vertex shader invocations.
+		std::size_t verticesTransformed;
+		/// Average cache miss ratio: transformed vertices per triangle, between 0.5 and 3.
+		float acmr;
+		/// Average transformed vertex ratio: transformed vertices per referenced vertex, 1 is optimal.
+		float atvr;
+	};
+
+	/// Vertex fetch efficiency of a triangle list.
+	struct vertex_fetch_statistics
+	{
+		/// Bytes read from the vertex buffer, by 64 bytes lines.
+		std::size_t bytesFetched;
+		/// Bytes fetched per byte of referenced vertices, 1 is optimal.
+		float overfetch;
+	};
+
+	/// Reorder the triangles of a triangle list for a FIFO post transform cache of CacheSize vertices.
+	/// Destination and Indices may be the same array.
+	/// @see gtx_mesh_optimize
+	GLM_FUNC_DECL void optimizeVertexCache(
+		uint32 * Destination, uint32 const * Indices, std::size_t IndexCount,
+		std::size_t VertexCount, uint32 CacheSize = 16);
+
+	/// Reorder clusters of triangles of a cache optimized triangle list so that triangles facing
+	/// outward are drawn first, while keeping the cache miss ratio within Threshold of the input.
+	/// Positions are vec3 at a distance of Stride bytes. Destination and Indices may be the same array.
+	/// @see gtx_mesh_optimize
+	GLM_FUNC_DECL void optimizeOverdraw(
+		uint32 * Destination, uint32 const * Indices, std::size_t IndexCount,
+		void const * Positions, std::size_t Stride, std::size_t VertexCount,
+		float Threshold = 1.05f, uint32 CacheSize = 16);
+
+	/// Reorder the vertices in order of first use and update Indices in place.
+	/// Unreferenced vertices are dropped. Returns the number of vertices written in Destination.
+	/// @see gtx_mesh_optimize
+	GLM_FUNC_DECL std::size_t optimizeVertexFetch(
+		void * Destination, uint32 * Indices, std::size_t IndexCount,
+		void const * Vertices, std::size_t VertexCount, std::size_t Stride);
+
+	/// Simulate a FIFO post transform cache of CacheSize vertices.
+	/// @see gtx_mesh_optimize
+	GLM_FUNC_DECL vertex_cache_statistics analyzeVertexCache(
+		uint32 const * Indices, std::size_t IndexCount, std::size_t VertexCount, uint32 CacheSize = 16);
+
+	/// Simulate a 16 KB direct mapped cache of 64 bytes lines in front of the vertex buffer.
+	/// @see gtx_mesh_optimize
+	GLM_FUNC_DECL vertex_fetch_statistics analyzeVertexFetch(
+		uint32 const * Indices, std::size_t IndexCount, std::size_t VertexCount, std::size_t Stride);
+
+	/// @}
+}//namespace glm
+
+#include "mesh_optimize.inl"
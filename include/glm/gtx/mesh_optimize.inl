@@ -0,0 +1,376 @@
+/// @ref gtx_mesh_optimize
+/// @file glm/gtx/mesh_optimize.inl
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	static uint32 const mesh_invalid = 0xFFFFFFFFu;
+
+	// FIFO post transform cache: a vertex is cached while fewer than CacheSize misses happened since it was loaded.
+	class mesh_vertex_cache
+	{
+	public:
+		GLM_FUNC_QUALIFIER mesh_vertex_cache(std::size_t VertexCount, uint32 CacheSize) :
+			Stamps(VertexCount, 0),
+			Time(CacheSize + 1),
+			Size(CacheSize)
+		{}
+
+		GLM_FUNC_QUALIFIER bool cached(uint32 Vertex) const
+		{
+			return this->Time - this->Stamps[Vertex] <= this->Size;
+		}
+
+		// Return 1 on a miss, 0 on a hit
+		GLM_FUNC_QUALIFIER uint32 access(uint32 Vertex)
+		{
+			if(this->cached(Vertex))
+				return 0;
+			this->Stamps[Vertex] = this->Time++;
+			return 1;
+		}
+
+		// Age of a cached vertex, in number of misses since it was loaded
+		GLM_FUNC_QUALIFIER uint32 age(uint32 Vertex) const
+		{
+			return this->Time - this->Stamps[Vertex];
+		}
+
+		GLM_FUNC_QUALIFIER void flush()
+		{
+			this->Time += this->Size + 1;
+		}
+
+	private:
+		std::vector<uint32> Stamps;
+		uint32 Time;
+		uint32 Size;
+	};
+
+	GLM_FUNC_QUALIFIER vec3 mesh_position(unsigned char const * Positions, std::size_t Stride, uint32 Vertex)
+	{
+		vec3 Position;
+		std::memcpy(&Position.x, Positions + static_cast<std::size_t>(Vertex) * Stride, sizeof(vec3));
+		return Position;
+	}
+
+	struct mesh_cluster
+	{
+		std::size_t begin;
+		std::size_t end;
+		float sortKey;
+	};
+
+	struct mesh_cluster_greater
+	{
+		GLM_FUNC_QUALIFIER bool operator()(mesh_cluster const & a, mesh_cluster const & b) const
+		{
+			return a.sortKey > b.sortKey;
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void optimizeVertexCache(
+		uint32 * Destination, uint32 const * Indices, std::size_t IndexCount,
+		std::size_t VertexCount, uint32 CacheSize)
+	{
+		assert(IndexCount % 3 == 0);
+
+		if(IndexCount == 0)
+			return;
+
+		std::vector<uint32> Input;
+		if(Destination == Indices)
+		{
+			Input.assign(Indices, Indices + IndexCount);
+			Indices = &Input[0];
+		}
+
+		std::size_t const TriangleCount = IndexCount / 3;
+
+		// Triangles adjacent to each vertex, Live counts the ones not emitted yet
+		std::vector<uint32> Live(VertexCount, 0);
+		for(std::size_t i = 0; i < IndexCount; ++i)
+			++Live[Indices[i]];
+
+		std::vector<uint32> Offsets(VertexCount + 1, 0);
+		for(std::size_t v = 0; v < VertexCount; ++v)
+			Offsets[v + 1] = Offsets[v] + Live[v];
+
+		std::vector<uint32> Adjacency(IndexCount);
+		{
+			std::vector<uint32> Cursors(Offsets.begin(), Offsets.end() - 1);
+			for(std::size_t i = 0; i < IndexCount; ++i)
+				Adjacency[Cursors[Indices[i]]++] = static_cast<uint32>(i / 3);
+		}
+
+		detail::mesh_vertex_cache Cache(VertexCount, CacheSize);
+		std::vector<unsigned char> Emitted(TriangleCount, 0);
+		std::vector<uint32> DeadEnds;
+		DeadEnds.reserve(IndexCount);
+		std::vector<uint32> Candidates;
+
+		std::size_t Output = 0;
+		std::size_t Scan = 0;
+		uint32 Fanning = Indices[0];
+
+		while(Fanning != detail::mesh_invalid)
+		{
+			// Emit every remaining triangle around the fanning vertex
+			Candidates.clear();
+			for(uint32 a = Offsets[Fanning]; a < Offsets[Fanning + 1]; ++a)
+			{
+				uint32 const Triangle = Adjacency[a];
+				if(Emitted[Triangle])
+					continue;
+				Emitted[Triangle] = 1;
+
+				for(std::size_t k = 0; k < 3; ++k)
+				{
+					uint32 const Vertex = Indices[Triangle * 3 + k];
+					Destination[Output++] = Vertex;
+					DeadEnds.push_back(Vertex);
+					Candidates.push_back(Vertex);
+					--Live[Vertex];
+					Cache.access(Vertex);
+				}
+			}
+
+			// Next fanning vertex: the oldest candidate that would still be cached after emitting its triangles
+			uint32 Next = detail::mesh_invalid;
+			int64 BestPriority = -1;
+			for(std::size_t c = 0; c < Candidates.size(); ++c)
+			{
+				uint32 const Vertex = Candidates[c];
+				if(Live[Vertex] == 0)
+					continue;
+
+				int64 Priority = 0;
+				uint32 const Age = Cache.age(Vertex);
+				if(Age + 2 * Live[Vertex] <= CacheSize)
+					Priority = Age;
+				if(Priority > BestPriority)
+				{
+					BestPriority = Priority;
+					Next = Vertex;
+				}
+			}
+
+			// Dead end: restart from a recently used vertex, then from the first vertex with triangles left
+			while(Next == detail::mesh_invalid && !DeadEnds.empty())
+			{
+				uint32 const Vertex = DeadEnds.back();
+				DeadEnds.pop_back();
+				if(Live[Vertex] > 0)
+					Next = Vertex;
+			}
+			for(; Next == detail::mesh_invalid && Scan < VertexCount; ++Scan)
+				if(Live[Scan] > 0)
+					Next = static_cast<uint32>(Scan);
+
+			Fanning = Next;
+		}
+
+		assert(Output == IndexCount);
+	}
+
+	GLM_FUNC_QUALIFIER void optimizeOverdraw(
+		uint32 * Destination, uint32 const * Indices, std::size_t IndexCount,
+		void const * Positions, std::size_t Stride, std::size_t VertexCount,
+		float Threshold, uint32 CacheSize)
+	{
+		assert(IndexCount % 3 == 0);
+
+		if(IndexCount == 0)
+			return;
+
+		std::vector<uint32> Input;
+		if(Destination == Indices)
+		{
+			Input.assign(Indices, Indices + IndexCount);
+			Indices = &Input[0];
+		}
+
+		std::size_t const TriangleCount = IndexCount / 3;
+		unsigned char const * Data = static_cast<unsigned char const *>(Positions);
+
+		// Hard boundaries: triangles missing all 3 vertices, where the cache optimizer restarted
+		std::vector<std::size_t> HardBoundaries;
+		{
+			detail::mesh_vertex_cache Cache(VertexCount, CacheSize);
+			for(std::size_t t = 0; t < TriangleCount; ++t)
+			{
+				uint32 const Misses = Cache.access(Indices[t * 3 + 0]) + Cache.access(Indices[t * 3 + 1]) + Cache.access(Indices[t * 3 + 2]);
+				if(Misses == 3 || t == 0)
+					HardBoundaries.push_back(t);
+			}
+			HardBoundaries.push_back(TriangleCount);
+		}
+
+		// Soft boundaries: split a hard cluster as soon as the cache miss ratio of the current piece,
+		// starting with a cold cache, is within Threshold of the one of the whole hard cluster.
+		std::vector<detail::mesh_cluster> Clusters;
+		detail::mesh_vertex_cache Cache(VertexCount, CacheSize);
+		for(std::size_t h = 0; h + 1 < HardBoundaries.size(); ++h)
+		{
+			std::size_t const Begin = HardBoundaries[h];
+			std::size_t const End = HardBoundaries[h + 1];
+
+			Cache.flush();
+			std::size_t ClusterMisses = 0;
+			for(std::size_t i = Begin * 3; i < End * 3; ++i)
+				ClusterMisses += Cache.access(Indices[i]);
+			float const Limit = static_cast<float>(ClusterMisses) / static_cast<float>(End - Begin) * Threshold;
+
+			Cache.flush();
+			std::size_t Start = Begin;
+			std::size_t Misses = 0;
+			for(std::size_t t = Begin; t < End; ++t)
+			{
+				Misses += Cache.access(Indices[t * 3 + 0]) + Cache.access(Indices[t * 3 + 1]) + Cache.access(Indices[t * 3 + 2]);
+				if(t + 1 < End && static_cast<float>(Misses) <= Limit * static_cast<float>(t + 1 - Start))
+				{
+					detail::mesh_cluster const Cluster = {Start, t + 1, 0.0f};
+					Clusters.push_back(Cluster);
+					Start = t + 1;
+					Misses = 0;
+					Cache.flush();
+				}
+			}
+			detail::mesh_cluster const Cluster = {Start, End, 0.0f};
+			Clusters.push_back(Cluster);
+		}
+
+		// Area weighted centroid of the mesh
+		vec3 MeshCentroid(0.0f);
+		float MeshArea = 0.0f;
+		for(std::size_t t = 0; t < TriangleCount; ++t)
+		{
+			vec3 const a = detail::mesh_position(Data, Stride, Indices[t * 3 + 0]);
+			vec3 const b = detail::mesh_position(Data, Stride, Indices[t * 3 + 1]);
+			vec3 const c = detail::mesh_position(Data, Stride, Indices[t * 3 + 2]);
+			float const Area = length(cross(b - a, c - a));
+			MeshCentroid += (a + b + c) * Area;
+			MeshArea += Area;
+		}
+		MeshCentroid = MeshArea > 0.0f ? MeshCentroid / (MeshArea * 3.0f) : vec3(0.0f);
+
+		// Clusters facing away from the center are the most likely occluders
+		for(std::size_t k = 0; k < Clusters.size(); ++k)
+		{
+			vec3 Centroid(0.0f);
+			vec3 Normal(0.0f);
+			float Area = 0.0f;
+			for(std::size_t t = Clusters[k].begin; t < Clusters[k].end; ++t)
+			{
+				vec3 const a = detail::mesh_position(Data, Stride, Indices[t * 3 + 0]);
+				vec3 const b = detail::mesh_position(Data, Stride, Indices[t * 3 + 1]);
+				vec3 const c = detail::mesh_position(Data, Stride, Indices[t * 3 + 2]);
+				vec3 const Cross = cross(b - a, c - a);
+				float const TriangleArea = length(Cross);
+				Centroid += (a + b + c) * TriangleArea;
+				Normal += Cross;
+				Area += TriangleArea;
+			}
+			Centroid = Area > 0.0f ? Centroid / (Area * 3.0f) : MeshCentroid;
+			float const NormalLength = length(Normal);
+			Clusters[k].sortKey = NormalLength > 0.0f ? dot(Centroid - MeshCentroid, Normal / NormalLength) : 0.0f;
+		}
+
+		std::stable_sort(Clusters.begin(), Clusters.end(), detail::mesh_cluster_greater());
+
+		std::size_t Output = 0;
+		for(std::size_t k = 0; k < Clusters.size(); ++k)
+		{
+			std::size_t const Count = (Clusters[k].end - Clusters[k].begin) * 3;
+			std::memcpy(Destination + Output, Indices + Clusters[k].begin * 3, Count * sizeof(uint32));
+			Output += Count;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t optimizeVertexFetch(
+		void * Destination, uint32 * Indices, std::size_t IndexCount,
+		void const * Vertices, std::size_t VertexCount, std::size_t Stride)
+	{
+		unsigned char const * Src = static_cast<unsigned char const *>(Vertices);
+		unsigned char * Dst = static_cast<unsigned char *>(Destination);
+
+		std::vector<uint32> Remap(VertexCount, detail::mesh_invalid);
+		uint32 Next = 0;
+		for(std::size_t i = 0; i < IndexCount; ++i)
+		{
+			uint32 & Index = Remap[Indices[i]];
+			if(Index == detail::mesh_invalid)
+			{
+				std::memcpy(Dst + static_cast<std::size_t>(Next) * Stride, Src + static_cast<std::size_t>(Indices[i]) * Stride, Stride);
+				Index = Next++;
+			}
+			Indices[i] = Index;
+		}
+
+		return Next;
+	}
+
+	GLM_FUNC_QUALIFIER vertex_cache_statistics analyzeVertexCache(
+		uint32 const * Indices, std::size_t IndexCount, std::size_t VertexCount, uint32 CacheSize)
+	{
+		detail::mesh_vertex_cache Cache(VertexCount, CacheSize);
+		std::vector<unsigned char> Referenced(VertexCount, 0);
+		std::size_t ReferencedCount = 0;
+
+		vertex_cache_statistics Result;
+		Result.verticesTransformed = 0;
+		for(std::size_t i = 0; i < IndexCount; ++i)
+		{
+			Result.verticesTransformed += Cache.access(Indices[i]);
+			if(!Referenced[Indices[i]])
+			{
+				Referenced[Indices[i]] = 1;
+				++ReferencedCount;
+			}
+		}
+
+		std::size_t const TriangleCount = IndexCount / 3;
+		Result.acmr = TriangleCount > 0 ? static_cast<float>(Result.verticesTransformed) / static_cast<float>(TriangleCount) : 0.0f;
+		Result.atvr = ReferencedCount > 0 ? static_cast<float>(Result.verticesTransformed) / static_cast<float>(ReferencedCount) : 0.0f;
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER vertex_fetch_statistics analyzeVertexFetch(
+		uint32 const * Indices, std::size_t IndexCount, std::size_t VertexCount, std::size_t Stride)
+	{
+		std::size_t const LineSize = 64;
+		std::size_t const LineCount = 256;
+		std::vector<std::size_t> Tags(LineCount, ~std::size_t(0));
+		std::vector<unsigned char> Referenced(VertexCount, 0);
+		std::size_t ReferencedCount = 0;
+
+		vertex_fetch_statistics Result;
+		Result.bytesFetched = 0;
+		for(std::size_t i = 0; i < IndexCount; ++i)
+		{
+			std::size_t const Begin = static_cast<std::size_t>(Indices[i]) * Stride;
+			for(std::size_t Line = Begin / LineSize; Line <= (Begin + Stride - 1) / LineSize; ++Line)
+			{
+				std::size_t & Tag = Tags[Line % LineCount];
+				if(Tag == Line)
+					continue;
+				Tag = Line;
+				Result.bytesFetched += LineSize;
+			}
+
+			if(!Referenced[Indices[i]])
+			{
+				Referenced[Indices[i]] = 1;
+				++ReferencedCount;
+			}
+		}
+
+		Result.overfetch = ReferencedCount > 0 ? static_cast<float>(Result.bytesFetched) / static_cast<float>(ReferencedCount * Stride) : 0.0f;
+		return Result;
+	}
+}//namespace glm
@@ -0,0 +1,86 @@
+/// @ref gtx_morton
+/// @file glm/gtx/morton.hpp
+///
+/// @see core (dependence)
+/// @see gtc_bitfield (dependence)
+/// @see gtx_parallel (dependence)
+///
+/// @defgroup gtx_morton GLM_GTX_morton
+/// @ingroup gtx
+///
+/// @brief Bulk Morton codes and spatial sorting of arrays.
+///
+/// 2D codes interleave two 32 bits coordinates, 3D codes interleave three 21 bits coordinates,
+/// both match bitfieldInterleave from GLM_GTC_bitfield. Codes are computed with _pdep_u64 and
+/// _pext_u64 when the compiler targets BMI2, two codes at a time with SSE2 otherwise.
+/// mortonSort is a parallel least significant digit radix sort that produces the permutation
+/// used to reorder vertex or instance arrays. The arrays are processed by chunks of Options.grain
+/// elements, 65536 by default.
+///
+/// <glm/gtx/morton.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/bitfield.hpp"
+#include "../gtc/type_precision.hpp"
+#include "../gtx/parallel.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_morton is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_morton extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_morton
+	/// @{
+
+	/// Interleave the bits of Count 2D coordinates.
+	/// @see gtx_morton
+	GLM_FUNC_DECL void mortonEncode(std::size_t Count, u32vec2 const * Coords, uint64 * Codes, parallel_options const & Options = parallel_options());
+
+	/// Interleave the bits of Count 3D coordinates, only the 21 least significant bits of each coordinate are used.
+	/// @see gtx_morton
+	GLM_FUNC_DECL void mortonEncode(std::size_t Count, u32vec3 const * Coords, uint64 * Codes, parallel_options const & Options = parallel_options());
+
+	/// Quantize Count positions inside the box [Min, Max] on a 2^32 grid and interleave the coordinates.
+	/// @see gtx_morton
+	GLM_FUNC_DECL void mortonEncode(std::size_t Count, vec2 const * Positions, vec2 const & Min, vec2 const & Max, uint64 * Codes, parallel_options const & Options = parallel_options());
+
+	/// Quantize Count positions inside the box [Min, Max] on a 2^21 grid and interleave the coordinates.
+	/// @see gtx_morton
+	GLM_FUNC_DECL void mortonEncode(std::size_t Count, vec3 const * Positions, vec3 const & Min, vec3 const & Max, uint64 * Codes, parallel_options const & Options = parallel_options());
+
+	/// Extract the 2D coordinates of Count codes.
+	/// @see gtx_morton
+	GLM_FUNC_DECL void mortonDecode(std::size_t Count, uint64 const * Codes, u32vec2 * Coords, parallel_options const & Options = parallel_options());
+
+	/// Extract the 3D coordinates of Count codes.
+	/// @see gtx_morton
+	GLM_FUNC_DECL void mortonDecode(std::size_t Count, uint64 const * Codes, u32vec3 * Coords, parallel_options const & Options = parallel_options());
+
+	/// Sort Count codes in increasing order and write in Order the source index of each sorted code, Count must fit in 32 bits.
+	/// The sort is stable. Only the KeyBits least significant bits are compared, 42 for 2D codes of
+	/// 21 bits coordinates, 63 for 3D codes.
+	/// @see gtx_morton
+	GLM_FUNC_DECL void mortonSort(std::size_t Count, uint64 * Codes, uint32 * Order, length_t KeyBits = 64, parallel_options const & Options = parallel_options());
+
+	/// Dst[i] = Src[Order[i]] for Count elements. Src and Dst must not overlap.
+	/// @see gtx_morton
+	template <typename genType>
+	GLM_FUNC_DECL void mortonReorder(std::size_t Count, uint32 const * Order, genType const * Src, genType * Dst, parallel_options const & Options = parallel_options());
+
+	/// Reorder Count elements of Stride bytes, for interleaved vertex arrays. Src and Dst must not overlap.
+	/// @see gtx_morton
+	GLM_FUNC_DECL void mortonReorder(std::size_t Count, uint32 const * Order, void const * Src, void * Dst, std::size_t Stride, parallel_options const & Options = parallel_options());
+
+	/// @}
+}//namespace glm
+
+#include "morton.inl"
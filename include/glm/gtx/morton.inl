@@ -0,0 +1,399 @@
+/// @ref gtx_morton
+/// @file glm/gtx/morton.inl
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// BMI2 has its own CPUID flag: GCC and Clang only accept _pdep_u64 and _pext_u64 with -mbmi2 or a -march that includes it
+#if !defined(GLM_FORCE_PURE) && (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__BMI2__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_MORTON_BMI2 1
+#	include <immintrin.h>
+#else
+#	define GLM_MORTON_BMI2 0
+#endif
+
+namespace glm{
+namespace detail
+{
+	static uint64 const morton_mask2 = 0x5555555555555555ull;
+	static uint64 const morton_mask3 = 0x1249249249249249ull;
+
+	// Number of codes per parallel task
+	static std::size_t const morton_grain = 65536;
+
+	// Radix sort digits, 6 passes for 3D codes with histograms that fit in the L1 cache
+	static unsigned const morton_digit_bits = 11;
+	static std::size_t const morton_digit_count = 1 << morton_digit_bits;
+
+	GLM_FUNC_QUALIFIER uint64 morton_compact2(uint64 x)
+	{
+		x &= 0x5555555555555555ull;
+		x = (x ^ (x >>  1)) & 0x3333333333333333ull;
+		x = (x ^ (x >>  2)) & 0x0F0F0F0F0F0F0F0Full;
+		x = (x ^ (x >>  4)) & 0x00FF00FF00FF00FFull;
+		x = (x ^ (x >>  8)) & 0x0000FFFF0000FFFFull;
+		x = (x ^ (x >> 16)) & 0x00000000FFFFFFFFull;
+		return x;
+	}
+
+	GLM_FUNC_QUALIFIER uint64 morton_compact3(uint64 x)
+	{
+		x &= 0x1249249249249249ull;
+		x = (x ^ (x >>  2)) & 0x10C30C30C30C30C3ull;
+		x = (x ^ (x >>  4)) & 0x100F00F00F00F00Full;
+		x = (x ^ (x >>  8)) & 0x001F0000FF0000FFull;
+		x = (x ^ (x >> 16)) & 0x001F00000000FFFFull;
+		x = (x ^ (x >> 32)) & 0x00000000001FFFFFull;
+		return x;
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Same shift and mask sequences as bitfieldInterleave, on two 64 bits lanes
+	GLM_FUNC_QUALIFIER __m128i morton_spread2(__m128i x)
+	{
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi64(x, 16)), _mm_set1_epi64x(0x0000FFFF0000FFFFll));
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi64(x,  8)), _mm_set1_epi64x(0x00FF00FF00FF00FFll));
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi64(x,  4)), _mm_set1_epi64x(0x0F0F0F0F0F0F0F0Fll));
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi64(x,  2)), _mm_set1_epi64x(0x3333333333333333ll));
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi64(x,  1)), _mm_set1_epi64x(0x5555555555555555ll));
+		return x;
+	}
+
+	GLM_FUNC_QUALIFIER __m128i morton_spread3(__m128i x)
+	{
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi64(x, 32)), _mm_set1_epi64x(0x001F00000000FFFFll));
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi64(x, 16)), _mm_set1_epi64x(0x001F0000FF0000FFll));
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi64(x,  8)), _mm_set1_epi64x(0x100F00F00F00F00Fll));
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi64(x,  4)), _mm_set1_epi64x(0x10C30C30C30C30C3ll));
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi64(x,  2)), _mm_set1_epi64x(0x1249249249249249ll));
+		return x;
+	}
+
+	GLM_FUNC_QUALIFIER __m128i morton_compact2(__m128i x)
+	{
+		x = _mm_and_si128(x, _mm_set1_epi64x(0x5555555555555555ll));
+		x = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x,  1)), _mm_set1_epi64x(0x3333333333333333ll));
+		x = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x,  2)), _mm_set1_epi64x(0x0F0F0F0F0F0F0F0Fll));
+		x = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x,  4)), _mm_set1_epi64x(0x00FF00FF00FF00FFll));
+		x = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x,  8)), _mm_set1_epi64x(0x0000FFFF0000FFFFll));
+		x = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x, 16)), _mm_set1_epi64x(0x00000000FFFFFFFFll));
+		return x;
+	}
+
+	GLM_FUNC_QUALIFIER __m128i morton_compact3(__m128i x)
+	{
+		x = _mm_and_si128(x, _mm_set1_epi64x(0x1249249249249249ll));
+		x = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x,  2)), _mm_set1_epi64x(0x10C30C30C30C30C3ll));
+		x = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x,  4)), _mm_set1_epi64x(0x100F00F00F00F00Fll));
+		x = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x,  8)), _mm_set1_epi64x(0x001F0000FF0000FFll));
+		x = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x, 16)), _mm_set1_epi64x(0x001F00000000FFFFll));
+		x = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x, 32)), _mm_set1_epi64x(0x00000000001FFFFFll));
+		return x;
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	GLM_FUNC_QUALIFIER void morton_encode(std::size_t Count, u32vec2 const * Coords, uint64 * Codes)
+	{
+		std::size_t i = 0;
+#		if GLM_MORTON_BMI2
+			for(; i < Count; ++i)
+				Codes[i] = _pdep_u64(Coords[i].x, morton_mask2) | _pdep_u64(Coords[i].y, morton_mask2 << 1);
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 2 <= Count; i += 2)
+			{
+				// x0 y0 x1 y1 split in 64 bits lanes of x and y
+				__m128i const Data = _mm_loadu_si128(reinterpret_cast<__m128i const *>(Coords + i));
+				__m128i const Low = _mm_set1_epi64x(0x00000000FFFFFFFFll);
+				__m128i const x = _mm_and_si128(_mm_shuffle_epi32(Data, _MM_SHUFFLE(3, 2, 2, 0)), Low);
+				__m128i const y = _mm_and_si128(_mm_shuffle_epi32(Data, _MM_SHUFFLE(3, 3, 3, 1)), Low);
+				__m128i const Code = _mm_or_si128(morton_spread2(x), _mm_slli_epi64(morton_spread2(y), 1));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(Codes + i), Code);
+			}
+#		endif
+		for(; i < Count; ++i)
+			Codes[i] = glm::bitfieldInterleave(Coords[i].x, Coords[i].y);
+	}
+
+	GLM_FUNC_QUALIFIER void morton_encode(std::size_t Count, u32vec3 const * Coords, uint64 * Codes)
+	{
+		std::size_t i = 0;
+#		if GLM_MORTON_BMI2
+			for(; i < Count; ++i)
+				Codes[i] = _pdep_u64(Coords[i].x, morton_mask3) | _pdep_u64(Coords[i].y, morton_mask3 << 1) | _pdep_u64(Coords[i].z, morton_mask3 << 2);
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128i const Mask = _mm_set1_epi64x(0x1FFFFF);
+			for(; i + 2 <= Count; i += 2)
+			{
+				__m128i const x = _mm_and_si128(_mm_set_epi64x(Coords[i + 1].x, Coords[i].x), Mask);
+				__m128i const y = _mm_and_si128(_mm_set_epi64x(Coords[i + 1].y, Coords[i].y), Mask);
+				__m128i const z = _mm_and_si128(_mm_set_epi64x(Coords[i + 1].z, Coords[i].z), Mask);
+				__m128i const Code = _mm_or_si128(_mm_or_si128(morton_spread3(x), _mm_slli_epi64(morton_spread3(y), 1)), _mm_slli_epi64(morton_spread3(z), 2));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(Codes + i), Code);
+			}
+#		endif
+		for(; i < Count; ++i)
+			Codes[i] = glm::bitfieldInterleave(Coords[i].x & 0x1FFFFFu, Coords[i].y & 0x1FFFFFu, Coords[i].z & 0x1FFFFFu);
+	}
+
+	GLM_FUNC_QUALIFIER void morton_decode(std::size_t Count, uint64 const * Codes, u32vec2 * Coords)
+	{
+		std::size_t i = 0;
+#		if GLM_MORTON_BMI2
+			for(; i < Count; ++i)
+				Coords[i] = u32vec2(static_cast<uint32>(_pext_u64(Codes[i], morton_mask2)), static_cast<uint32>(_pext_u64(Codes[i], morton_mask2 << 1)));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 2 <= Count; i += 2)
+			{
+				__m128i const Code = _mm_loadu_si128(reinterpret_cast<__m128i const *>(Codes + i));
+				__m128i const x = morton_compact2(Code);
+				__m128i const y = morton_compact2(_mm_srli_epi64(Code, 1));
+				// x0 y0 x1 y1 from the low 32 bits of each lane
+				__m128i const Data = _mm_unpacklo_epi32(_mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 2, 0)), _mm_shuffle_epi32(y, _MM_SHUFFLE(3, 3, 2, 0)));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(Coords + i), Data);
+			}
+#		endif
+		for(; i < Count; ++i)
+			Coords[i] = u32vec2(static_cast<uint32>(morton_compact2(Codes[i])), static_cast<uint32>(morton_compact2(Codes[i] >> 1)));
+	}
+
+	GLM_FUNC_QUALIFIER void morton_decode(std::size_t Count, uint64 const * Codes, u32vec3 * Coords)
+	{
+		std::size_t i = 0;
+#		if GLM_MORTON_BMI2
+			for(; i < Count; ++i)
+				Coords[i] = u32vec3(
+					static_cast<uint32>(_pext_u64(Codes[i], morton_mask3)),
+					static_cast<uint32>(_pext_u64(Codes[i], morton_mask3 << 1)),
+					static_cast<uint32>(_pext_u64(Codes[i], morton_mask3 << 2)));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 2 <= Count; i += 2)
+			{
+				__m128i const Code = _mm_loadu_si128(reinterpret_cast<__m128i const *>(Codes + i));
+				GLM_ALIGN(16) uint64 Result[3][2];
+				_mm_store_si128(reinterpret_cast<__m128i *>(Result[0]), morton_compact3(Code));
+				_mm_store_si128(reinterpret_cast<__m128i *>(Result[1]), morton_compact3(_mm_srli_epi64(Code, 1)));
+				_mm_store_si128(reinterpret_cast<__m128i *>(Result[2]), morton_compact3(_mm_srli_epi64(Code, 2)));
+				Coords[i + 0] = u32vec3(static_cast<uint32>(Result[0][0]), static_cast<uint32>(Result[1][0]), static_cast<uint32>(Result[2][0]));
+				Coords[i + 1] = u32vec3(static_cast<uint32>(Result[0][1]), static_cast<uint32>(Result[1][1]), static_cast<uint32>(Result[2][1]));
+			}
+#		endif
+		for(; i < Count; ++i)
+			Coords[i] = u32vec3(
+				static_cast<uint32>(morton_compact3(Codes[i])),
+				static_cast<uint32>(morton_compact3(Codes[i] >> 1)),
+				static_cast<uint32>(morton_compact3(Codes[i] >> 2)));
+	}
+
+	GLM_FUNC_QUALIFIER void morton_quantize(std::size_t Count, vec2 const * Positions, vec2 const & Min, vec2 const & Max, u32vec2 * Coords)
+	{
+		// Doubles keep the 32 bits of the grid
+		dvec2 const Extent(dvec2(Max) - dvec2(Min));
+		dvec2 const Scale(
+			Extent.x > 0.0 ? 4294967295.0 / Extent.x : 0.0,
+			Extent.y > 0.0 ? 4294967295.0 / Extent.y : 0.0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			dvec2 const Grid(clamp((dvec2(Positions[i]) - dvec2(Min)) * Scale, 0.0, 4294967295.0));
+			Coords[i] = u32vec2(Grid);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void morton_quantize(std::size_t Count, vec3 const * Positions, vec3 const & Min, vec3 const & Max, u32vec3 * Coords)
+	{
+		float const Last = 2097151.0f;
+		vec3 const Extent(Max - Min);
+		vec3 const Scale(
+			Extent.x > 0.0f ? Last / Extent.x : 0.0f,
+			Extent.y > 0.0f ? Last / Extent.y : 0.0f,
+			Extent.z > 0.0f ? Last / Extent.z : 0.0f);
+		for(std::size_t i = 0; i < Count; ++i)
+			Coords[i] = u32vec3(clamp((Positions[i] - Min) * Scale, 0.0f, Last));
+	}
+
+	// Chunks of morton_grain elements unless the caller chose a grain
+	GLM_FUNC_QUALIFIER parallel_options morton_options(parallel_options const & Options)
+	{
+		parallel_options Result(Options);
+		if(Result.grain == 0)
+			Result.grain = morton_grain;
+		return Result;
+	}
+
+	// Quantize blocks of positions to integer coordinates then encode them
+	template <typename vecType, typename coordType>
+	GLM_FUNC_QUALIFIER void morton_encode_positions(std::size_t Count, vecType const * Positions, vecType const & Min, vecType const & Max, uint64 * Codes, parallel_options const & Options)
+	{
+		parallelFor(Count, [&](std::size_t Begin, std::size_t End)
+		{
+			std::size_t const BlockSize = 256;
+			coordType Coords[BlockSize];
+			for(std::size_t i = Begin; i < End; i += BlockSize)
+			{
+				std::size_t const Size = End - i < BlockSize ? End - i : BlockSize;
+				morton_quantize(Size, Positions + i, Min, Max, Coords);
+				morton_encode(Size, Coords, Codes + i);
+			}
+		}, morton_options(Options));
+	}
+
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void mortonEncode(std::size_t Count, u32vec2 const * Coords, uint64 * Codes, parallel_options const & Options)
+	{
+		parallelFor(Count, [&](std::size_t Begin, std::size_t End)
+		{
+			detail::morton_encode(End - Begin, Coords + Begin, Codes + Begin);
+		}, detail::morton_options(Options));
+	}
+
+	GLM_FUNC_QUALIFIER void mortonEncode(std::size_t Count, u32vec3 const * Coords, uint64 * Codes, parallel_options const & Options)
+	{
+		parallelFor(Count, [&](std::size_t Begin, std::size_t End)
+		{
+			detail::morton_encode(End - Begin, Coords + Begin, Codes + Begin);
+		}, detail::morton_options(Options));
+	}
+
+	GLM_FUNC_QUALIFIER void mortonEncode(std::size_t Count, vec2 const * Positions, vec2 const & Min, vec2 const & Max, uint64 * Codes, parallel_options const & Options)
+	{
+		detail::morton_encode_positions<vec2, u32vec2>(Count, Positions, Min, Max, Codes, Options);
+	}
+
+	GLM_FUNC_QUALIFIER void mortonEncode(std::size_t Count, vec3 const * Positions, vec3 const & Min, vec3 const & Max, uint64 * Codes, parallel_options const & Options)
+	{
+		detail::morton_encode_positions<vec3, u32vec3>(Count, Positions, Min, Max, Codes, Options);
+	}
+
+	GLM_FUNC_QUALIFIER void mortonDecode(std::size_t Count, uint64 const * Codes, u32vec2 * Coords, parallel_options const & Options)
+	{
+		parallelFor(Count, [&](std::size_t Begin, std::size_t End)
+		{
+			detail::morton_decode(End - Begin, Codes + Begin, Coords + Begin);
+		}, detail::morton_options(Options));
+	}
+
+	GLM_FUNC_QUALIFIER void mortonDecode(std::size_t Count, uint64 const * Codes, u32vec3 * Coords, parallel_options const & Options)
+	{
+		parallelFor(Count, [&](std::size_t Begin, std::size_t End)
+		{
+			detail::morton_decode(End - Begin, Codes + Begin, Coords + Begin);
+		}, detail::morton_options(Options));
+	}
+
+	GLM_FUNC_QUALIFIER void mortonSort(std::size_t Count, uint64 * Codes, uint32 * Order, length_t KeyBits, parallel_options const & Options)
+	{
+		if(Count == 0)
+			return;
+
+		// Each task owns a contiguous block of keys and a histogram per pass, scattering the blocks
+		// in order keeps the sort stable.
+		parallel_options const SortOptions = detail::morton_options(Options);
+		unsigned const Concurrency = (Options.executor ? *Options.executor : parallelDefaultExecutor()).concurrency();
+		std::size_t const MaxTasks = Options.threadCount > 0 && Options.threadCount < Concurrency ? Options.threadCount : Concurrency;
+		std::size_t const TaskCount = std::min<std::size_t>(MaxTasks, (Count + SortOptions.grain - 1) / SortOptions.grain);
+		std::size_t const TaskSize = (Count + TaskCount - 1) / TaskCount;
+		parallel_options TaskOptions(Options);
+		TaskOptions.grain = 1;
+
+		std::vector<uint64> TempCodes(Count);
+		std::vector<uint32> TempOrder(Count);
+		std::vector<std::size_t> Histograms(TaskCount * detail::morton_digit_count);
+
+		uint64 * SrcCodes = Codes;
+		uint64 * DstCodes = &TempCodes[0];
+		uint32 * SrcOrder = &TempOrder[0];
+		uint32 * DstOrder = Order;
+		for(std::size_t i = 0; i < Count; ++i)
+			SrcOrder[i] = static_cast<uint32>(i);
+
+		std::size_t const DigitCount = detail::morton_digit_count;
+		length_t const Bits = std::min<length_t>(KeyBits, 64);
+		length_t const PassCount = (Bits + detail::morton_digit_bits - 1) / detail::morton_digit_bits;
+		for(length_t Pass = 0; Pass < PassCount; ++Pass)
+		{
+			unsigned const Shift = static_cast<unsigned>(Pass) * detail::morton_digit_bits;
+			// The last digit stops at KeyBits, the bits above are ignored
+			unsigned const DigitBits = std::min(detail::morton_digit_bits, static_cast<unsigned>(Bits) - Shift);
+			uint64 const DigitMask = (static_cast<uint64>(1) << DigitBits) - 1;
+
+			parallelFor(TaskCount, [&](std::size_t TaskBegin, std::size_t TaskEnd)
+			{
+				for(std::size_t Task = TaskBegin; Task < TaskEnd; ++Task)
+				{
+					std::size_t * Histogram = &Histograms[Task * DigitCount];
+					std::fill(Histogram, Histogram + DigitCount, std::size_t(0));
+					std::size_t const End = std::min(Count, (Task + 1) * TaskSize);
+					for(std::size_t i = Task * TaskSize; i < End; ++i)
+						++Histogram[(SrcCodes[i] >> Shift) & DigitMask];
+				}
+			}, TaskOptions);
+
+			// Skip the digits shared by every key, typically the high bits of 3D codes
+			bool Uniform = false;
+			for(std::size_t Digit = 0; Digit < DigitCount && !Uniform; ++Digit)
+			{
+				std::size_t Total = 0;
+				for(std::size_t Task = 0; Task < TaskCount; ++Task)
+					Total += Histograms[Task * DigitCount + Digit];
+				Uniform = Total == Count;
+			}
+			if(Uniform)
+				continue;
+
+			// Exclusive prefix sum in digit major, task minor order
+			std::size_t Offset = 0;
+			for(std::size_t Digit = 0; Digit < DigitCount; ++Digit)
+			for(std::size_t Task = 0; Task < TaskCount; ++Task)
+			{
+				std::size_t const Size = Histograms[Task * DigitCount + Digit];
+				Histograms[Task * DigitCount + Digit] = Offset;
+				Offset += Size;
+			}
+
+			parallelFor(TaskCount, [&](std::size_t TaskBegin, std::size_t TaskEnd)
+			{
+				for(std::size_t Task = TaskBegin; Task < TaskEnd; ++Task)
+				{
+					std::size_t * Histogram = &Histograms[Task * DigitCount];
+					std::size_t const End = std::min(Count, (Task + 1) * TaskSize);
+					for(std::size_t i = Task * TaskSize; i < End; ++i)
+					{
+						std::size_t const Index = Histogram[(SrcCodes[i] >> Shift) & DigitMask]++;
+						DstCodes[Index] = SrcCodes[i];
+						DstOrder[Index] = SrcOrder[i];
+					}
+				}
+			}, TaskOptions);
+
+			std::swap(SrcCodes, DstCodes);
+			std::swap(SrcOrder, DstOrder);
+		}
+
+		if(SrcCodes != Codes)
+			std::memcpy(Codes, SrcCodes, Count * sizeof(uint64));
+		if(SrcOrder != Order)
+			std::memcpy(Order, SrcOrder, Count * sizeof(uint32));
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void mortonReorder(std::size_t Count, uint32 const * Order, genType const * Src, genType * Dst, parallel_options const & Options)
+	{
+		parallelFor(Count, [&](std::size_t Begin, std::size_t End)
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Dst[i] = Src[Order[i]];
+		}, detail::morton_options(Options));
+	}
+
+	GLM_FUNC_QUALIFIER void mortonReorder(std::size_t Count, uint32 const * Order, void const * Src, void * Dst, std::size_t Stride, parallel_options const & Options)
+	{
+		unsigned char const * In = static_cast<unsigned char const *>(Src);
+		unsigned char * Out = static_cast<unsigned char *>(Dst);
+		parallelFor(Count, [&](std::size_t Begin, std::size_t End)
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				std::memcpy(Out + i * Stride, In + static_cast<std::size_t>(Order[i]) * Stride, Stride);
+		}, detail::morton_options(Options));
+	}
+}//namespace glm
@@ -0,0 +1,182 @@
+/// @ref gtx_parallel
+/// @file glm/gtx/parallel.hpp
+///
+/// @see core (dependence)
+/// @see gtc_packing (dependence)
+/// @see gtx_vertex_batch (dependence)
+///
+/// @defgroup gtx_parallel GLM_GTX_parallel
+/// @ingroup gtx
+///
+/// @brief Multithreaded transformation, normalization, reduction and packing of large arrays.
+///
+/// An array is cut in chunks of grain elements. The grain is rounded up to whole cache lines and the chunk
+/// boundaries are aligned on cache lines of the output array, so that two threads never write the same line.
+/// Each task of a parallel call starts with a contiguous range of chunks; a task that runs out of chunks
+/// steals half of the chunks left to another task. Ranges are single atomic words, no lock is taken.
+///
+/// The tasks are run by a parallel_executor: by default a parallel_pool of persistent threads shared by
+/// the process, or any job system implementing the interface. Arrays of a single chunk, calls from
+/// inside a task of the same pool and concurrent calls on the same pool run on the calling thread.
+///
+/// Reductions combine the chunk results in chunk order. Since chunks only depend on the grain,
+/// floating point results don't depend on the number of threads or on the scheduling.
+/// The functions built on GLM_GTX_vertex_batch give the same results as a single call of the batch function.
+///
+/// <glm/gtx/parallel.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/packing.hpp"
+#include "../gtx/vertex_batch.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if !GLM_HAS_CXX11_STL
+#	error "GLM_GTX_parallel requires C++11 standard library support"
+#endif
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_parallel is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_parallel extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_parallel
+	/// @{
+
+	/// Interface of the job systems running the tasks of the parallel functions.
+	class parallel_executor
+	{
+	public:
+		typedef void (*task)(void * Data, unsigned Index);
+
+		virtual ~parallel_executor() {}
+
+		/// Number of tasks that can run at the same time, including the calling thread.
+		virtual unsigned concurrency() const = 0;
+
+		/// Call Task(Data, i) for i in [0, TaskCount), concurrently if possible, and return when every call returned.
+		/// The calls may run in any order and on any thread, including the calling thread.
+		virtual void run(unsigned TaskCount, task Task, void * Data) = 0;
+	};
+
+	/// Executor with persistent threads. The calling thread of run takes part in the work.
+	class parallel_pool : public parallel_executor
+	{
+	public:
+		/// ThreadCount is the concurrency of the pool, including the calling thread, 0 means one per hardware thread.
+		GLM_FUNC_DECL explicit parallel_pool(unsigned ThreadCount = 0);
+		GLM_FUNC_DECL ~parallel_pool();
+
+		GLM_FUNC_DECL unsigned concurrency() const;
+
+		/// Runs the tasks on the calling thread when called from a task of this pool or while another thread runs tasks on it.
+		GLM_FUNC_DECL void run(unsigned TaskCount, task Task, void * Data);
+
+	private:
+		parallel_pool(parallel_pool const &);
+		parallel_pool & operator=(parallel_pool const &);
+
+		GLM_FUNC_DECL void work();
+		GLM_FUNC_DECL void execute();
+
+		std::vector<std::thread> Threads;
+		std::mutex RunMutex;
+		std::mutex Mutex;
+		std::condition_variable Wake;
+		std::condition_variable Done;
+		task Task;
+		void * Data;
+		unsigned TaskCount;
+		std::atomic<unsigned> Next;
+		unsigned Active;
+		uint64 Generation;
+		bool Stop;
+	};
+
+	/// Pool used when parallel_options::executor is null, created on first use with one thread per hardware thread.
+	/// @see gtx_parallel
+	GLM_FUNC_DECL parallel_executor & parallelDefaultExecutor();
+
+	/// Settings of a parallel call.
+	struct parallel_options
+	{
+		GLM_FUNC_DECL parallel_options();
+
+		/// Executor running the tasks, null means parallelDefaultExecutor().
+		parallel_executor * executor;
+		/// Elements per chunk, rounded up to whole cache lines. 0 means chunks of 64 KiB, or of 4096 indices for parallelFor.
+		/// Smaller grains balance expensive or irregular work better, larger grains schedule less.
+		std::size_t grain;
+		/// Maximum number of threads, 0 means the concurrency of the executor.
+		unsigned threadCount;
+	};
+
+	/// Call Func(Begin, End) for each chunk of [0, Count). Func is called concurrently for disjoint chunks.
+	/// @see gtx_parallel
+	template <typename funcType>
+	GLM_FUNC_DECL void parallelFor(std::size_t Count, funcType const & Func, parallel_options const & Options = parallel_options());
+
+	/// Out[i] = Func(In[i]) for Count elements. In and Out may be the same array.
+	/// Any packing function can be used as Func, for example packSnorm3x10_1x2.
+	/// @see gtx_parallel
+	template <typename inType, typename outType, typename funcType>
+	GLM_FUNC_DECL void parallelTransform(std::size_t Count, inType const * In, outType * Out, funcType const & Func, parallel_options const & Options = parallel_options());
+
+	/// Combine(...Combine(Identity, Chunk0), Chunk1...) where each chunk result is Func(...Func(Identity, In[Begin])..., In[End - 1]).
+	/// @see gtx_parallel
+	template <typename inType, typename valType, typename funcType, typename combineType>
+	GLM_FUNC_DECL valType parallelReduce(std::size_t Count, inType const * In, valType const & Identity, funcType const & Func, combineType const & Combine, parallel_options const & Options = parallel_options());
+
+	/// Sum of Count vectors, added in chunks then chunk results added in order.
+	/// @see gtx_parallel
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<T, P> parallelSum(std::size_t Count, vecType<T, P> const * In, parallel_options const & Options = parallel_options());
+
+	/// Multithreaded transformPointBatch. In and Out may be the same array.
+	/// @see gtx_parallel
+	GLM_FUNC_DECL void parallelTransformPoint(std::size_t Count, mat4 const & Matrix, vec3 const * In, vec3 * Out, parallel_options const & Options = parallel_options());
+
+	/// Multithreaded transformVectorBatch. In and Out may be the same array.
+	/// @see gtx_parallel
+	GLM_FUNC_DECL void parallelTransformVector(std::size_t Count, mat4 const & Matrix, vec3 const * In, vec3 * Out, parallel_options const & Options = parallel_options());
+
+	/// Multithreaded transformBatch. In and Out may be the same array.
+	/// @see gtx_parallel
+	GLM_FUNC_DECL void parallelTransform(std::size_t Count, mat4 const & Matrix, vec4 const * In, vec4 * Out, parallel_options const & Options = parallel_options());
+
+	/// Multithreaded normalizeBatch. In and Out may be the same array.
+	/// @see gtx_parallel
+	GLM_FUNC_DECL void parallelNormalize(std::size_t Count, vec3 const * In, vec3 * Out, parallel_options const & Options = parallel_options());
+
+	/// Multithreaded boundsBatch: grow the box [Min, Max] to contain Count points.
+	/// @see gtx_parallel
+	GLM_FUNC_DECL void parallelBounds(std::size_t Count, vec3 const * Points, vec3 & Min, vec3 & Max, parallel_options const & Options = parallel_options());
+
+	/// Out[i] = packUnorm4x8(In[i]) for Count vectors.
+	/// @see gtx_parallel
+	GLM_FUNC_DECL void parallelPackUnorm4x8(std::size_t Count, vec4 const * In, uint32 * Out, parallel_options const & Options = parallel_options());
+
+	/// Out[i] = packSnorm4x8(In[i]) for Count vectors.
+	/// @see gtx_parallel
+	GLM_FUNC_DECL void parallelPackSnorm4x8(std::size_t Count, vec4 const * In, uint32 * Out, parallel_options const & Options = parallel_options());
+
+	/// Out[i] = packHalf4x16(In[i]) for Count vectors.
+	/// @see gtx_parallel
+	GLM_FUNC_DECL void parallelPackHalf4x16(std::size_t Count, vec4 const * In, uint64 * Out, parallel_options const & Options = parallel_options());
+
+	/// @}
+}//namespace glm
+
+#include "parallel.inl"
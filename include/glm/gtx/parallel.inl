@@ -0,0 +1,429 @@
+/// @ref gtx_parallel
+/// @file glm/gtx/parallel.inl
+
+#include <memory>
+
+namespace glm{
+namespace detail
+{
+	// Threads of the default pool. Never returns 0.
+	GLM_FUNC_QUALIFIER unsigned parallel_thread_count()
+	{
+		unsigned const Count = std::thread::hardware_concurrency();
+		return Count > 0 ? Count : 1;
+	}
+
+	// Chunks left to a task, [Begin, End) packed as End << 32 | Begin so that they change with a single
+	// compare and swap. The owner takes chunks from the front, thieves from the back.
+	struct parallel_range
+	{
+		std::atomic<uint64> Range;
+		char Padding[64 - sizeof(std::atomic<uint64>)];
+	};
+
+	GLM_FUNC_QUALIFIER uint64 parallel_range_pack(uint32 Begin, uint32 End)
+	{
+		return static_cast<uint64>(End) << 32 | Begin;
+	}
+
+	GLM_FUNC_QUALIFIER bool parallel_range_pop(parallel_range & Own, uint32 & Chunk)
+	{
+		uint64 Range = Own.Range.load(std::memory_order_relaxed);
+		for(;;)
+		{
+			uint32 const Begin = static_cast<uint32>(Range);
+			uint32 const End = static_cast<uint32>(Range >> 32);
+			if(Begin >= End)
+				return false;
+			if(Own.Range.compare_exchange_weak(Range, parallel_range_pack(Begin + 1, End), std::memory_order_relaxed))
+			{
+				Chunk = Begin;
+				return true;
+			}
+		}
+	}
+
+	// Move the second half of the chunks of Victim to Own, which is empty.
+	GLM_FUNC_QUALIFIER bool parallel_range_steal(parallel_range & Victim, parallel_range & Own)
+	{
+		uint64 Range = Victim.Range.load(std::memory_order_relaxed);
+		for(;;)
+		{
+			uint32 const Begin = static_cast<uint32>(Range);
+			uint32 const End = static_cast<uint32>(Range >> 32);
+			if(Begin >= End)
+				return false;
+			uint32 const Split = End - (End - Begin + 1) / 2;
+			if(Victim.Range.compare_exchange_weak(Range, parallel_range_pack(Begin, Split), std::memory_order_relaxed))
+			{
+				Own.Range.store(parallel_range_pack(Split, End), std::memory_order_relaxed);
+				return true;
+			}
+		}
+	}
+
+	// The vertex_batch functions process 4 vertices at a time and the last ones one by one, chunks of
+	// multiples of 4 vertices give the same results as a single call.
+	std::size_t const parallel_vertex_step = 4;
+
+	// Chunks of a parallel call and the tasks processing them. Chunk c covers
+	// [c * Grain - Offset, (c + 1) * Grain - Offset) clamped to [0, Count).
+	struct parallel_plan
+	{
+		// Chunk boundaries are multiples of Step elements from the start of the array
+		GLM_FUNC_QUALIFIER parallel_plan(std::size_t ElementCount, std::size_t ElementSize, std::size_t Step, void const * Output, parallel_options const & Options) :
+			Executor(Options.executor ? Options.executor : &parallelDefaultExecutor()),
+			Count(ElementCount),
+			Grain(0),
+			Offset(0),
+			ChunkCount(0),
+			TaskCount(0)
+		{
+			// Elements per cache line multiple: 16 vec3, 4 vec4. ElementSize == 0 for indices of parallelFor
+			std::size_t Line = Step;
+			while(ElementSize > 0 && (Line * ElementSize) % 64 != 0 && Line < 64 * Step)
+				Line += Step;
+
+			Grain = Options.grain > 0 ? Options.grain : (ElementSize > 0 ? (65536 + ElementSize - 1) / ElementSize : 4096);
+			Grain = (Grain + Line - 1) / Line * Line;
+			if(Count / Grain >= 0xFFFFFFFFu)
+				Grain = (Count / 0xFFFFFFFFu + Line) / Line * Line;
+
+			// The first boundary is the first cache line of the output
+			std::size_t const Address = reinterpret_cast<std::size_t>(Output);
+			for(std::size_t Head = Step; Head < Line && Head < Count; Head += Step)
+			{
+				if((Address + Head * ElementSize) % 64 == 0)
+				{
+					Offset = Grain - Head;
+					break;
+				}
+			}
+
+			ChunkCount = (Count + Offset + Grain - 1) / Grain;
+
+			unsigned const Concurrency = Executor->concurrency();
+			TaskCount = Options.threadCount > 0 && Options.threadCount < Concurrency ? Options.threadCount : Concurrency;
+			if(TaskCount > ChunkCount)
+				TaskCount = static_cast<unsigned>(ChunkCount);
+		}
+
+		GLM_FUNC_QUALIFIER std::size_t begin(std::size_t Chunk) const
+		{
+			return Chunk == 0 ? 0 : Chunk * Grain - Offset;
+		}
+
+		GLM_FUNC_QUALIFIER std::size_t end(std::size_t Chunk) const
+		{
+			std::size_t const End = (Chunk + 1) * Grain - Offset;
+			return End < Count ? End : Count;
+		}
+
+		parallel_executor * Executor;
+		std::size_t Count;
+		std::size_t Grain;
+		std::size_t Offset;
+		std::size_t ChunkCount;
+		unsigned TaskCount;
+	};
+
+	template <typename funcType>
+	struct parallel_job
+	{
+		static void run(void * Data, unsigned Task)
+		{
+			parallel_job const & Job = *static_cast<parallel_job const *>(Data);
+			parallel_range & Own = Job.Ranges[Task];
+
+			for(;;)
+			{
+				uint32 Chunk = 0;
+				while(parallel_range_pop(Own, Chunk))
+					(*Job.Func)(Job.Plan->begin(Chunk), Job.Plan->end(Chunk), static_cast<std::size_t>(Chunk));
+
+				bool Stolen = false;
+				for(unsigned i = 1; i < Job.Plan->TaskCount && !Stolen; ++i)
+					Stolen = parallel_range_steal(Job.Ranges[(Task + i) % Job.Plan->TaskCount], Own);
+				if(!Stolen)
+					return;
+			}
+		}
+
+		parallel_plan const * Plan;
+		funcType const * Func;
+		parallel_range * Ranges;
+	};
+
+	// Call Func(Begin, End, Chunk) for every chunk of Plan.
+	template <typename funcType>
+	GLM_FUNC_QUALIFIER void parallel_execute(parallel_plan const & Plan, funcType const & Func)
+	{
+		if(Plan.TaskCount <= 1)
+		{
+			for(std::size_t Chunk = 0; Chunk < Plan.ChunkCount; ++Chunk)
+				Func(Plan.begin(Chunk), Plan.end(Chunk), Chunk);
+			return;
+		}
+
+		std::unique_ptr<parallel_range[]> Ranges(new parallel_range[Plan.TaskCount]);
+		for(unsigned i = 0; i < Plan.TaskCount; ++i)
+		{
+			uint32 const Begin = static_cast<uint32>(static_cast<uint64>(Plan.ChunkCount) * i / Plan.TaskCount);
+			uint32 const End = static_cast<uint32>(static_cast<uint64>(Plan.ChunkCount) * (i + 1) / Plan.TaskCount);
+			Ranges[i].Range.store(parallel_range_pack(Begin, End), std::memory_order_relaxed);
+		}
+
+		parallel_job<funcType> Job;
+		Job.Plan = &Plan;
+		Job.Func = &Func;
+		Job.Ranges = Ranges.get();
+		Plan.Executor->run(Plan.TaskCount, &parallel_job<funcType>::run, &Job);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER parallel_pool::parallel_pool(unsigned ThreadCount) :
+		Task(0),
+		Data(0),
+		TaskCount(0),
+		Next(0),
+		Active(0),
+		Generation(0),
+		Stop(false)
+	{
+		unsigned const Count = ThreadCount > 0 ? ThreadCount : detail::parallel_thread_count();
+		Threads.reserve(Count - 1);
+		for(unsigned i = 1; i < Count; ++i)
+			Threads.push_back(std::thread(&parallel_pool::work, this));
+	}
+
+	GLM_FUNC_QUALIFIER parallel_pool::~parallel_pool()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Stop = true;
+		}
+		Wake.notify_all();
+		for(std::size_t i = 0; i < Threads.size(); ++i)
+			Threads[i].join();
+	}
+
+	GLM_FUNC_QUALIFIER unsigned parallel_pool::concurrency() const
+	{
+		return static_cast<unsigned>(Threads.size() + 1);
+	}
+
+	GLM_FUNC_QUALIFIER void parallel_pool::run(unsigned Count, task Func, void * UserData)
+	{
+		std::unique_lock<std::mutex> RunLock(RunMutex, std::try_to_lock);
+		if(!RunLock.owns_lock() || Threads.empty())
+		{
+			for(unsigned i = 0; i < Count; ++i)
+				Func(UserData, i);
+			return;
+		}
+
+		{
+			// Threads still leaving the previous call read the previous task
+			std::unique_lock<std::mutex> Lock(Mutex);
+			Done.wait(Lock, [this]{ return Active == 0; });
+			Task = Func;
+			Data = UserData;
+			TaskCount = Count;
+			Next.store(0, std::memory_order_relaxed);
+			++Generation;
+			++Active;
+		}
+		Wake.notify_all();
+
+		execute();
+
+		std::unique_lock<std::mutex> Lock(Mutex);
+		Done.wait(Lock, [this]{ return Active == 0; });
+	}
+
+	GLM_FUNC_QUALIFIER void parallel_pool::work()
+	{
+		uint64 Seen = 0;
+		for(;;)
+		{
+			{
+				std::unique_lock<std::mutex> Lock(Mutex);
+				Wake.wait(Lock, [&]{ return Stop || Generation != Seen; });
+				if(Stop)
+					return;
+				Seen = Generation;
+				++Active;
+			}
+			execute();
+		}
+	}
+
+	// Run tasks until none is left, then leave the call. Active was incremented by the caller.
+	GLM_FUNC_QUALIFIER void parallel_pool::execute()
+	{
+		for(unsigned i = Next.fetch_add(1, std::memory_order_relaxed); i < TaskCount; i = Next.fetch_add(1, std::memory_order_relaxed))
+			Task(Data, i);
+
+		bool Last = false;
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Last = --Active == 0;
+		}
+		if(Last)
+			Done.notify_all();
+	}
+
+	GLM_FUNC_QUALIFIER parallel_executor & parallelDefaultExecutor()
+	{
+		static parallel_pool Pool;
+		return Pool;
+	}
+
+	GLM_FUNC_QUALIFIER parallel_options::parallel_options() :
+		executor(0),
+		grain(0),
+		threadCount(0)
+	{}
+
+	template <typename funcType>
+	GLM_FUNC_QUALIFIER void parallelFor(std::size_t Count, funcType const & Func, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, 0, 1, 0, Options);
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t)
+		{
+			Func(Begin, End);
+		});
+	}
+
+	template <typename inType, typename outType, typename funcType>
+	GLM_FUNC_QUALIFIER void parallelTransform(std::size_t Count, inType const * In, outType * Out, funcType const & Func, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, sizeof(outType), 1, Out, Options);
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t)
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Out[i] = Func(In[i]);
+		});
+	}
+
+	template <typename inType, typename valType, typename funcType, typename combineType>
+	GLM_FUNC_QUALIFIER valType parallelReduce(std::size_t Count, inType const * In, valType const & Identity, funcType const & Func, combineType const & Combine, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, sizeof(inType), 1, In, Options);
+		std::vector<valType> Partials(Plan.ChunkCount, Identity);
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t Chunk)
+		{
+			valType Result(Identity);
+			for(std::size_t i = Begin; i < End; ++i)
+				Result = Func(Result, In[i]);
+			Partials[Chunk] = Result;
+		});
+
+		valType Result(Identity);
+		for(std::size_t i = 0; i < Partials.size(); ++i)
+			Result = Combine(Result, Partials[i]);
+		return Result;
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<T, P> parallelSum(std::size_t Count, vecType<T, P> const * In, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, sizeof(vecType<T, P>), 1, In, Options);
+		std::vector<vecType<T, P> > Partials(Plan.ChunkCount, vecType<T, P>(static_cast<T>(0)));
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t Chunk)
+		{
+			vecType<T, P> Result(static_cast<T>(0));
+			for(std::size_t i = Begin; i < End; ++i)
+				Result += In[i];
+			Partials[Chunk] = Result;
+		});
+
+		vecType<T, P> Result(static_cast<T>(0));
+		for(std::size_t i = 0; i < Partials.size(); ++i)
+			Result += Partials[i];
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER void parallelTransformPoint(std::size_t Count, mat4 const & Matrix, vec3 const * In, vec3 * Out, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, sizeof(vec3), detail::parallel_vertex_step, Out, Options);
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t)
+		{
+			transformPointBatch(End - Begin, Matrix, In + Begin, Out + Begin);
+		});
+	}
+
+	GLM_FUNC_QUALIFIER void parallelTransformVector(std::size_t Count, mat4 const & Matrix, vec3 const * In, vec3 * Out, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, sizeof(vec3), detail::parallel_vertex_step, Out, Options);
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t)
+		{
+			transformVectorBatch(End - Begin, Matrix, In + Begin, Out + Begin);
+		});
+	}
+
+	GLM_FUNC_QUALIFIER void parallelTransform(std::size_t Count, mat4 const & Matrix, vec4 const * In, vec4 * Out, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, sizeof(vec4), detail::parallel_vertex_step, Out, Options);
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t)
+		{
+			transformBatch(End - Begin, Matrix, In + Begin, Out + Begin);
+		});
+	}
+
+	GLM_FUNC_QUALIFIER void parallelNormalize(std::size_t Count, vec3 const * In, vec3 * Out, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, sizeof(vec3), detail::parallel_vertex_step, Out, Options);
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t)
+		{
+			normalizeBatch(End - Begin, In + Begin, Out + Begin);
+		});
+	}
+
+	GLM_FUNC_QUALIFIER void parallelBounds(std::size_t Count, vec3 const * Points, vec3 & Min, vec3 & Max, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, sizeof(vec3), detail::parallel_vertex_step, Points, Options);
+		std::vector<vec3> Mins(Plan.ChunkCount, Min);
+		std::vector<vec3> Maxs(Plan.ChunkCount, Max);
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t Chunk)
+		{
+			boundsBatch(End - Begin, Points + Begin, Mins[Chunk], Maxs[Chunk]);
+		});
+
+		for(std::size_t i = 0; i < Plan.ChunkCount; ++i)
+		{
+			Min = min(Min, Mins[i]);
+			Max = max(Max, Maxs[i]);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void parallelPackUnorm4x8(std::size_t Count, vec4 const * In, uint32 * Out, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, sizeof(uint32), 1, Out, Options);
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t)
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Out[i] = packUnorm4x8(In[i]);
+		});
+	}
+
+	GLM_FUNC_QUALIFIER void parallelPackSnorm4x8(std::size_t Count, vec4 const * In, uint32 * Out, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, sizeof(uint32), 1, Out, Options);
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t)
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Out[i] = packSnorm4x8(In[i]);
+		});
+	}
+
+	GLM_FUNC_QUALIFIER void parallelPackHalf4x16(std::size_t Count, vec4 const * In, uint64 * Out, parallel_options const & Options)
+	{
+		detail::parallel_plan const Plan(Count, sizeof(uint64), 1, Out, Options);
+		detail::parallel_execute(Plan, [&](std::size_t Begin, std::size_t End, std::size_t)
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Out[i] = packHalf4x16(In[i]);
+		});
+	}
+}//namespace glm
@@ -0,0 +1,71 @@
+/// @ref gtx_skinning
+/// @file glm/gtx/skinning.hpp
+///
+/// @see core (dependence)
+/// @see gtx_dual_quaternion (dependence)
+/// @see gtx_parallel (dependence)
+///
+/// @defgroup gtx_skinning GLM_GTX_skinning
+/// @ingroup gtx
+///
+/// @brief CPU vertex skinning from a palette of dual quaternions.
+///
+/// Each vertex references up to 4 bones: indices are packed in 4 bytes, the first bone in the
+/// least significant byte, and weights are packed with packUnorm4x8. Vertices are processed in
+/// chunks across threads, blending and normalization use SSE2 when available.
+///
+/// <glm/gtx/skinning.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/dual_quaternion.hpp"
+#include "../gtx/parallel.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_skinning is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_skinning extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_skinning
+	/// @{
+
+	enum skinning_mode
+	{
+		/// Blend the bone dual quaternions, preserves volume around joints.
+		SKINNING_DUAL_QUATERNION,
+		/// Blend the bone matrices, for comparison with the usual GPU path.
+		SKINNING_LINEAR_BLEND
+	};
+
+	/// Skin VertexCount vertices with a palette of PaletteSize bone transformations.
+	/// The 4 bone indices of every vertex must be lower than PaletteSize, including bones of zero weight.
+	/// Normals and SkinnedNormals may be null. Skinned normals are unit length.
+	/// The vertices are skinned by chunks of Options.grain vertices, 4096 by default.
+	/// @see gtx_skinning
+	GLM_FUNC_DECL void skin(
+		skinning_mode Mode,
+		fdualquat const * Palette, std::size_t PaletteSize,
+		std::size_t VertexCount,
+		uint const * BoneIndices, uint const * BoneWeights,
+		vec3 const * Positions, vec3 const * Normals,
+		vec3 * SkinnedPositions, vec3 * SkinnedNormals,
+		parallel_options const & Options = parallel_options());
+
+	/// Blend and normalize the dual quaternions of the bones of a single vertex, the scalar reference of skin.
+	/// The 4 bone indices must index Palette.
+	/// @see gtx_skinning
+	GLM_FUNC_DECL fdualquat blendDualQuaternions(
+		fdualquat const * Palette, uint BoneIndices, uint BoneWeights);
+
+	/// @}
+}//namespace glm
+
+#include "skinning.inl"
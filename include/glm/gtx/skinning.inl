@@ -0,0 +1,287 @@
+/// @ref gtx_skinning
+/// @file glm/gtx/skinning.inl
+
+#include "../simd/geometric.h"
+#include <cassert>
+#include <vector>
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER uint skinning_bone(uint BoneIndices, length_t i)
+	{
+		return (BoneIndices >> (i * 8)) & 0xFF;
+	}
+
+	// All 4 bones are read, even those of zero weight
+	GLM_FUNC_QUALIFIER bool skinning_bones_in_palette(uint BoneIndices, std::size_t PaletteSize)
+	{
+		for(length_t i = 0; i < 4; ++i)
+			if(skinning_bone(BoneIndices, i) >= PaletteSize)
+				return false;
+		return true;
+	}
+
+	// Rows of the affine bone matrices, used by linear blend skinning
+	struct skinning_matrix
+	{
+		vec4 rows[3];
+	};
+
+	GLM_FUNC_QUALIFIER void skin_linear_blend_scalar(
+		skinning_matrix const * Matrices, std::size_t Begin, std::size_t End,
+		uint const * BoneIndices, uint const * BoneWeights,
+		vec3 const * Positions, vec3 const * Normals,
+		vec3 * SkinnedPositions, vec3 * SkinnedNormals)
+	{
+		for(std::size_t v = Begin; v < End; ++v)
+		{
+			vec4 Weights = unpackUnorm4x8(BoneWeights[v]);
+			float const Sum = Weights.x + Weights.y + Weights.z + Weights.w;
+			Weights = Sum > 0.0f ? Weights / Sum : vec4(1.0f, 0.0f, 0.0f, 0.0f);
+
+			vec4 Rows[3] = {vec4(0.0f), vec4(0.0f), vec4(0.0f)};
+			for(length_t i = 0; i < 4; ++i)
+			{
+				skinning_matrix const & Matrix = Matrices[skinning_bone(BoneIndices[v], i)];
+				for(length_t r = 0; r < 3; ++r)
+					Rows[r] += Matrix.rows[r] * Weights[i];
+			}
+
+			vec4 const Position(Positions[v], 1.0f);
+			SkinnedPositions[v] = vec3(dot(Rows[0], Position), dot(Rows[1], Position), dot(Rows[2], Position));
+
+			if(Normals && SkinnedNormals)
+			{
+				vec4 const Normal(Normals[v], 0.0f);
+				SkinnedNormals[v] = normalize(vec3(dot(Rows[0], Normal), dot(Rows[1], Normal), dot(Rows[2], Normal)));
+			}
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void skin_dual_quaternion_scalar(
+		fdualquat const * Palette, std::size_t Begin, std::size_t End,
+		uint const * BoneIndices, uint const * BoneWeights,
+		vec3 const * Positions, vec3 const * Normals,
+		vec3 * SkinnedPositions, vec3 * SkinnedNormals)
+	{
+		for(std::size_t v = Begin; v < End; ++v)
+		{
+			fdualquat const Blend = blendDualQuaternions(Palette, BoneIndices[v], BoneWeights[v]);
+			SkinnedPositions[v] = Blend * Positions[v];
+			if(Normals && SkinnedNormals)
+				SkinnedNormals[v] = Blend.real * Normals[v];
+		}
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	GLM_FUNC_QUALIFIER glm_vec4 skinning_weights(uint BoneWeights)
+	{
+		glm_ivec4 const Zero = _mm_setzero_si128();
+		glm_ivec4 const Bytes = _mm_cvtsi32_si128(static_cast<int>(BoneWeights));
+		glm_ivec4 const Words = _mm_unpacklo_epi8(Bytes, Zero);
+		glm_ivec4 const Ints = _mm_unpacklo_epi16(Words, Zero);
+		return _mm_mul_ps(_mm_cvtepi32_ps(Ints), _mm_set1_ps(1.0f / 255.0f));
+	}
+
+	GLM_FUNC_QUALIFIER glm_vec4 skinning_load(vec3 const & v, float w)
+	{
+		return _mm_setr_ps(v.x, v.y, v.z, w);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 skinning_store(glm_vec4 v)
+	{
+		GLM_ALIGN(16) float Result[4];
+		_mm_store_ps(Result, v);
+		return vec3(Result[0], Result[1], Result[2]);
+	}
+
+	GLM_FUNC_QUALIFIER void skin_linear_blend_sse2(
+		skinning_matrix const * Matrices, std::size_t Begin, std::size_t End,
+		uint const * BoneIndices, uint const * BoneWeights,
+		vec3 const * Positions, vec3 const * Normals,
+		vec3 * SkinnedPositions, vec3 * SkinnedNormals)
+	{
+		bool const SkinNormals = Normals && SkinnedNormals;
+		glm_vec4 const Zero = _mm_setzero_ps();
+
+		for(std::size_t v = Begin; v < End; ++v)
+		{
+			glm_vec4 Weights = skinning_weights(BoneWeights[v]);
+			glm_vec4 const Sum = glm_vec4_dot(Weights, _mm_set1_ps(1.0f));
+			Weights = _mm_cvtss_f32(Sum) > 0.0f ? _mm_div_ps(Weights, Sum) : _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+			glm_vec4 Rows[4] = {Zero, Zero, Zero, Zero};
+			for(length_t i = 0; i < 4; ++i)
+			{
+				glm_vec4 const Weight = _mm_shuffle_ps(Weights, Weights, _MM_SHUFFLE(0, 0, 0, 0));
+				Weights = _mm_shuffle_ps(Weights, Weights, _MM_SHUFFLE(0, 3, 2, 1));
+
+				skinning_matrix const & Matrix = Matrices[skinning_bone(BoneIndices[v], i)];
+				for(length_t r = 0; r < 3; ++r)
+					Rows[r] = _mm_add_ps(Rows[r], _mm_mul_ps(_mm_loadu_ps(&Matrix.rows[r].x), Weight));
+			}
+
+			// Three dot products at once: transpose the products and sum the rows
+			glm_vec4 const Position = skinning_load(Positions[v], 1.0f);
+			glm_vec4 P0 = _mm_mul_ps(Rows[0], Position);
+			glm_vec4 P1 = _mm_mul_ps(Rows[1], Position);
+			glm_vec4 P2 = _mm_mul_ps(Rows[2], Position);
+			glm_vec4 P3 = Zero;
+			_MM_TRANSPOSE4_PS(P0, P1, P2, P3);
+			SkinnedPositions[v] = skinning_store(_mm_add_ps(_mm_add_ps(P0, P1), _mm_add_ps(P2, P3)));
+
+			if(SkinNormals)
+			{
+				glm_vec4 const Normal = skinning_load(Normals[v], 0.0f);
+				glm_vec4 N0 = _mm_mul_ps(Rows[0], Normal);
+				glm_vec4 N1 = _mm_mul_ps(Rows[1], Normal);
+				glm_vec4 N2 = _mm_mul_ps(Rows[2], Normal);
+				glm_vec4 N3 = Zero;
+				_MM_TRANSPOSE4_PS(N0, N1, N2, N3);
+				glm_vec4 const Skinned = _mm_add_ps(_mm_add_ps(N0, N1), _mm_add_ps(N2, N3));
+				SkinnedNormals[v] = skinning_store(_mm_div_ps(Skinned, _mm_sqrt_ps(glm_vec4_dot(Skinned, Skinned))));
+			}
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void skin_dual_quaternion_sse2(
+		fdualquat const * Palette, std::size_t Begin, std::size_t End,
+		uint const * BoneIndices, uint const * BoneWeights,
+		vec3 const * Positions, vec3 const * Normals,
+		vec3 * SkinnedPositions, vec3 * SkinnedNormals)
+	{
+		bool const SkinNormals = Normals && SkinnedNormals;
+		glm_vec4 const Zero = _mm_setzero_ps();
+		glm_vec4 const Two = _mm_set1_ps(2.0f);
+		glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+		glm_vec4 const Identity = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+		for(std::size_t v = Begin; v < End; ++v)
+		{
+			glm_vec4 Weights = skinning_weights(BoneWeights[v]);
+
+			fdualquat const & First = Palette[skinning_bone(BoneIndices[v], 0)];
+			glm_vec4 const FirstReal = _mm_loadu_ps(&First.real.x);
+			glm_vec4 const FirstWeight = _mm_shuffle_ps(Weights, Weights, _MM_SHUFFLE(0, 0, 0, 0));
+			glm_vec4 Real = _mm_mul_ps(FirstReal, FirstWeight);
+			glm_vec4 Dual = _mm_mul_ps(_mm_loadu_ps(&First.dual.x), FirstWeight);
+
+			for(length_t i = 1; i < 4; ++i)
+			{
+				Weights = _mm_shuffle_ps(Weights, Weights, _MM_SHUFFLE(0, 3, 2, 1));
+
+				fdualquat const & Bone = Palette[skinning_bone(BoneIndices[v], i)];
+				glm_vec4 const BoneReal = _mm_loadu_ps(&Bone.real.x);
+
+				// Blend along the shortest path: flip the weight of bones in the opposite hemisphere
+				glm_vec4 const Flip = _mm_and_ps(_mm_cmplt_ps(glm_vec4_dot(FirstReal, BoneReal), Zero), SignMask);
+				glm_vec4 const Weight = _mm_xor_ps(_mm_shuffle_ps(Weights, Weights, _MM_SHUFFLE(0, 0, 0, 0)), Flip);
+
+				Real = _mm_add_ps(Real, _mm_mul_ps(BoneReal, Weight));
+				Dual = _mm_add_ps(Dual, _mm_mul_ps(_mm_loadu_ps(&Bone.dual.x), Weight));
+			}
+
+			glm_vec4 const Length2 = glm_vec4_dot(Real, Real);
+			if(_mm_movemask_ps(_mm_cmpgt_ps(Length2, Zero)) == 0)
+			{
+				Real = Identity;
+				Dual = Zero;
+			}
+			else
+			{
+				glm_vec4 const InvLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(Length2));
+				Real = _mm_mul_ps(Real, InvLength);
+				Dual = _mm_mul_ps(Dual, InvLength);
+			}
+
+			glm_vec4 const RealW = _mm_shuffle_ps(Real, Real, _MM_SHUFFLE(3, 3, 3, 3));
+			glm_vec4 const DualW = _mm_shuffle_ps(Dual, Dual, _MM_SHUFFLE(3, 3, 3, 3));
+
+			// Same expression as tdualquat * tvec3
+			glm_vec4 const Position = skinning_load(Positions[v], 0.0f);
+			glm_vec4 const Inner = _mm_add_ps(_mm_add_ps(glm_vec4_cross(Real, Position), _mm_mul_ps(Position, RealW)), Dual);
+			glm_vec4 const Outer = _mm_sub_ps(_mm_add_ps(glm_vec4_cross(Real, Inner), _mm_mul_ps(Dual, RealW)), _mm_mul_ps(Real, DualW));
+			SkinnedPositions[v] = skinning_store(_mm_add_ps(_mm_mul_ps(Outer, Two), Position));
+
+			if(SkinNormals)
+			{
+				glm_vec4 const Normal = skinning_load(Normals[v], 0.0f);
+				glm_vec4 const Rotated = glm_vec4_cross(Real, _mm_add_ps(glm_vec4_cross(Real, Normal), _mm_mul_ps(Normal, RealW)));
+				SkinnedNormals[v] = skinning_store(_mm_add_ps(_mm_mul_ps(Rotated, Two), Normal));
+			}
+		}
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER fdualquat blendDualQuaternions(fdualquat const * Palette, uint BoneIndices, uint BoneWeights)
+	{
+		vec4 const Weights = unpackUnorm4x8(BoneWeights);
+		fdualquat const & First = Palette[detail::skinning_bone(BoneIndices, 0)];
+
+		fquat Real(First.real * Weights[0]);
+		fquat Dual(First.dual * Weights[0]);
+		for(length_t i = 1; i < 4; ++i)
+		{
+			fdualquat const & Bone = Palette[detail::skinning_bone(BoneIndices, i)];
+			float const Weight = dot(First.real, Bone.real) < 0.0f ? -Weights[i] : Weights[i];
+			Real = Real + Bone.real * Weight;
+			Dual = Dual + Bone.dual * Weight;
+		}
+
+		float const Length = length(Real);
+		if(Length <= 0.0f)
+			return fdualquat(fquat(1.0f, 0.0f, 0.0f, 0.0f), fquat(0.0f, 0.0f, 0.0f, 0.0f));
+		return fdualquat(Real / Length, Dual / Length);
+	}
+
+	GLM_FUNC_QUALIFIER void skin
+	(
+		skinning_mode Mode,
+		fdualquat const * Palette, std::size_t PaletteSize,
+		std::size_t VertexCount,
+		uint const * BoneIndices, uint const * BoneWeights,
+		vec3 const * Positions, vec3 const * Normals,
+		vec3 * SkinnedPositions, vec3 * SkinnedNormals,
+		parallel_options const & Options
+	)
+	{
+		assert(PaletteSize > 0);
+		for(std::size_t v = 0; v < VertexCount; ++v)
+			assert(detail::skinning_bones_in_palette(BoneIndices[v], PaletteSize));
+
+		if(Mode == SKINNING_LINEAR_BLEND)
+		{
+			std::vector<detail::skinning_matrix> Matrices(PaletteSize);
+			for(std::size_t i = 0; i < PaletteSize; ++i)
+			{
+				mat3 const Rotation = mat3_cast(Palette[i].real);
+				vec3 const Translation = Palette[i] * vec3(0.0f);
+				for(length_t r = 0; r < 3; ++r)
+					Matrices[i].rows[r] = vec4(Rotation[0][r], Rotation[1][r], Rotation[2][r], Translation[r]);
+			}
+
+			detail::skinning_matrix const * MatrixData = &Matrices[0];
+			parallelFor(VertexCount, [=](std::size_t Begin, std::size_t End)
+			{
+#				if GLM_ARCH & GLM_ARCH_SSE2_BIT
+					detail::skin_linear_blend_sse2(MatrixData, Begin, End, BoneIndices, BoneWeights, Positions, Normals, SkinnedPositions, SkinnedNormals);
+#				else
+					detail::skin_linear_blend_scalar(MatrixData, Begin, End, BoneIndices, BoneWeights, Positions, Normals, SkinnedPositions, SkinnedNormals);
+#				endif
+			}, Options);
+		}
+		else
+		{
+			parallelFor(VertexCount, [=](std::size_t Begin, std::size_t End)
+			{
+#				if GLM_ARCH & GLM_ARCH_SSE2_BIT
+					detail::skin_dual_quaternion_sse2(Palette, Begin, End, BoneIndices, BoneWeights, Positions, Normals, SkinnedPositions, SkinnedNormals);
+#				else
+					detail::skin_dual_quaternion_scalar(Palette, Begin, End, BoneIndices, BoneWeights, Positions, Normals, SkinnedPositions, SkinnedNormals);
+#				endif
+			}, Options);
+		}
+	}
+}//namespace glm
@@ -0,0 +1,121 @@
+/// @ref gtx_spline_curve
+/// @file glm/gtx/spline_curve.hpp
+///
+/// @see core (dependence)
+/// @see gtx_spline (dependence)
+///
+/// @defgroup gtx_spline_curve GLM_GTX_spline_curve
+/// @ingroup gtx
+///
+/// @brief Piecewise cubic curve with precomputed segment coefficients and an arc length table.
+///
+/// Each segment is stored as the coefficients of cubic() from GLM_GTX_spline, so sampling a curve does
+/// not re-derive the catmullRom or hermite weights. Moving a control point only refits the segments it
+/// influences. Batches of parameters are evaluated with SSE2 for float curves.
+///
+/// <glm/gtx/spline_curve.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/spline.hpp"
+#include <cstddef>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_spline_curve is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_spline_curve extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_spline_curve
+	/// @{
+
+	enum spline_type
+	{
+		/// Uniform Catmull-Rom through the control points, the end points are repeated.
+		SPLINE_CATMULL_ROM,
+		/// Hermite segments between consecutive control points, one tangent per control point.
+		SPLINE_HERMITE
+	};
+
+	/// Curve through N control points, made of N - 1 cubic segments.
+	/// The curve parameter u is in [0, segmentCount()], segment i covers [i, i + 1].
+	/// Call update() after editing the control points and before sampling.
+	template <typename T, precision P = defaultp>
+	class tspline_curve
+	{
+	public:
+		typedef T value_type;
+		typedef tvec3<T, P> point_type;
+
+		/// Coefficients of a segment, the point at s in [0, 1] is cubic(a, b, c, d, s).
+		struct segment
+		{
+			point_type a, b, c, d;
+		};
+
+		/// TableResolution is the number of arc length samples per segment.
+		GLM_FUNC_DECL explicit tspline_curve(spline_type Type = SPLINE_CATMULL_ROM, length_t TableResolution = 16);
+
+		/// Replace the control points. Tangents are only used by SPLINE_HERMITE curves and may be null otherwise.
+		GLM_FUNC_DECL void assign(point_type const * Points, std::size_t Count, point_type const * Tangents = NULL);
+
+		/// Move a control point, the segments it influences are refitted on the next update().
+		GLM_FUNC_DECL void setPoint(std::size_t Index, point_type const & Point);
+		GLM_FUNC_DECL void setTangent(std::size_t Index, point_type const & Tangent);
+
+		/// Refit the modified segments and their arc length tables. Returns the number of segments refitted.
+		GLM_FUNC_DECL std::size_t update();
+
+		GLM_FUNC_DECL std::size_t pointCount() const;
+		GLM_FUNC_DECL std::size_t segmentCount() const;
+		GLM_FUNC_DECL segment const & getSegment(std::size_t Index) const;
+
+		/// Total arc length of the curve.
+		GLM_FUNC_DECL T length() const;
+
+		/// Point at curve parameter u, clamped to [0, segmentCount()].
+		GLM_FUNC_DECL point_type evaluate(T u) const;
+
+		/// Points at Count curve parameters.
+		GLM_FUNC_DECL void evaluate(T const * Params, std::size_t Count, point_type * Points) const;
+
+		/// Curve parameter at an arc length distance from the start of the curve.
+		GLM_FUNC_DECL T parameterAt(T Distance) const;
+
+		/// Points at Count arc length distances from the start of the curve.
+		GLM_FUNC_DECL void evaluateAtDistance(T const * Distances, std::size_t Count, point_type * Points) const;
+
+		/// Count points equally spaced along the curve, including both ends.
+		GLM_FUNC_DECL void sampleUniform(std::size_t Count, point_type * Points) const;
+
+	private:
+		GLM_FUNC_DECL void invalidate(std::size_t FirstSegment, std::size_t LastSegment);
+		GLM_FUNC_DECL void fit(std::size_t Index);
+
+		spline_type Type;
+		length_t Resolution;
+		std::vector<point_type> Points;
+		std::vector<point_type> Tangents;
+		std::vector<segment> Segments;
+		std::vector<unsigned char> Dirty;
+		std::size_t DirtyCount;
+		// Arc length at the end of each sub-interval of each segment, relative to the start of the segment
+		std::vector<T> Table;
+		// Arc length at the start of each segment, with the total length as last element
+		std::vector<T> Offsets;
+	};
+
+	typedef tspline_curve<float, defaultp> spline_curve;
+	typedef tspline_curve<double, defaultp> dspline_curve;
+
+	/// @}
+}//namespace glm
+
+#include "spline_curve.inl"
@@ -0,0 +1,381 @@
+/// @ref gtx_spline_curve
+/// @file glm/gtx/spline_curve.inl
+
+#include <algorithm>
+#include <cassert>
+
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P>
+	struct compute_spline_evaluate
+	{
+		typedef typename tspline_curve<T, P>::segment segment;
+
+		GLM_FUNC_QUALIFIER static tvec3<T, P> single(segment const * Segments, std::size_t SegmentCount, T u)
+		{
+			T const Last = static_cast<T>(SegmentCount);
+			u = u < static_cast<T>(0) ? static_cast<T>(0) : (u > Last ? Last : u);
+			std::size_t Index = static_cast<std::size_t>(u);
+			if(Index >= SegmentCount)
+				Index = SegmentCount - 1;
+			segment const & Segment = Segments[Index];
+			return cubic(Segment.a, Segment.b, Segment.c, Segment.d, u - static_cast<T>(Index));
+		}
+
+		GLM_FUNC_QUALIFIER static void call(segment const * Segments, std::size_t SegmentCount, T const * Params, std::size_t Count, tvec3<T, P> * Points)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Points[i] = single(Segments, SegmentCount, Params[i]);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// The segment is 12 contiguous floats, each coefficient is loaded in a register with a single
+	// unaligned load and the Horner steps of the 3 components run together.
+	template <precision P>
+	struct compute_spline_evaluate<float, P>
+	{
+		typedef typename tspline_curve<float, P>::segment segment;
+
+		GLM_FUNC_QUALIFIER static glm_vec4 horner(segment const & Segment, glm_vec4 s)
+		{
+			float const * Data = &Segment.a.x;
+			glm_vec4 const a = _mm_loadu_ps(Data + 0);
+			glm_vec4 const b = _mm_loadu_ps(Data + 3);
+			glm_vec4 const c = _mm_loadu_ps(Data + 6);
+			// Load c.z d.x d.y d.z and rotate to stay inside the segment
+			glm_vec4 const d = _mm_shuffle_ps(_mm_loadu_ps(Data + 8), _mm_loadu_ps(Data + 8), _MM_SHUFFLE(0, 3, 2, 1));
+			return _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(a, s), b), s), c), s), d);
+		}
+
+		GLM_FUNC_QUALIFIER static tvec3<float, P> single(segment const * Segments, std::size_t SegmentCount, float u)
+		{
+			float const Last = static_cast<float>(SegmentCount);
+			u = u < 0.0f ? 0.0f : (u > Last ? Last : u);
+			std::size_t Index = static_cast<std::size_t>(u);
+			if(Index >= SegmentCount)
+				Index = SegmentCount - 1;
+			segment const & Segment = Segments[Index];
+			return cubic(Segment.a, Segment.b, Segment.c, Segment.d, u - static_cast<float>(Index));
+		}
+
+		GLM_FUNC_QUALIFIER static void call(segment const * Segments, std::size_t SegmentCount, float const * Params, std::size_t Count, tvec3<float, P> * Points)
+		{
+			if(sizeof(segment) != sizeof(float) * 12)
+			{
+				compute_spline_evaluate<float, P>::scalar(Segments, SegmentCount, Params, Count, Points);
+				return;
+			}
+
+			glm_vec4 const Zero = _mm_setzero_ps();
+			glm_vec4 const Last = _mm_set1_ps(static_cast<float>(SegmentCount));
+			glm_vec4 const LastIndex = _mm_set1_ps(static_cast<float>(SegmentCount - 1));
+
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				// Clamp and split 4 parameters at once, u == SegmentCount is the end of the last segment
+				glm_vec4 const u = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(Params + i), Zero), Last);
+				glm_vec4 const Index = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(u)), LastIndex);
+				glm_vec4 const s = _mm_sub_ps(u, Index);
+
+				GLM_ALIGN(16) int Indices[4];
+				_mm_store_si128(reinterpret_cast<__m128i*>(Indices), _mm_cvttps_epi32(Index));
+
+				// Every store but the last writes one float into the next point, which is overwritten after
+				float * Out = &Points[i].x;
+				_mm_storeu_ps(Out + 0, horner(Segments[Indices[0]], _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 0, 0, 0))));
+				_mm_storeu_ps(Out + 3, horner(Segments[Indices[1]], _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+				_mm_storeu_ps(Out + 6, horner(Segments[Indices[2]], _mm_shuffle_ps(s, s, _MM_SHUFFLE(2, 2, 2, 2))));
+				glm_vec4 const v = horner(Segments[Indices[3]], _mm_shuffle_ps(s, s, _MM_SHUFFLE(3, 3, 3, 3)));
+				_mm_storel_pi(reinterpret_cast<__m64*>(Out + 9), v);
+				_mm_store_ss(Out + 11, _mm_movehl_ps(v, v));
+			}
+
+			compute_spline_evaluate<float, P>::scalar(Segments, SegmentCount, Params + i, Count - i, Points + i);
+		}
+
+		GLM_FUNC_QUALIFIER static void scalar(segment const * Segments, std::size_t SegmentCount, float const * Params, std::size_t Count, tvec3<float, P> * Points)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Points[i] = single(Segments, SegmentCount, Params[i]);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	// Length of the curve between s0 and s1 with a 3 points Gauss-Legendre quadrature of the speed.
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER T spline_segment_length(typename tspline_curve<T, P>::segment const & Segment, T s0, T s1)
+	{
+		T const Half = (s1 - s0) * static_cast<T>(0.5);
+		T const Mid = s0 + Half;
+		T const Node = static_cast<T>(0.77459666924148337704) * Half;
+		T const Nodes[3] = {Mid - Node, Mid, Mid + Node};
+		T const Weights[3] = {static_cast<T>(5) / static_cast<T>(9), static_cast<T>(8) / static_cast<T>(9), static_cast<T>(5) / static_cast<T>(9)};
+
+		T Result(0);
+		for(length_t i = 0; i < 3; ++i)
+		{
+			T const s = Nodes[i];
+			tvec3<T, P> const Speed = (Segment.a * (static_cast<T>(3) * s) + Segment.b * static_cast<T>(2)) * s + Segment.c;
+			Result += Weights[i] * length(Speed);
+		}
+		return Result * Half;
+	}
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tspline_curve<T, P>::tspline_curve(spline_type Type, length_t TableResolution) :
+		Type(Type),
+		Resolution(TableResolution > 0 ? TableResolution : 1),
+		DirtyCount(0)
+	{}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void tspline_curve<T, P>::assign(point_type const * Points, std::size_t Count, point_type const * Tangents)
+	{
+		assert(Count >= 2);
+		assert(this->Type != SPLINE_HERMITE || Tangents);
+
+		this->Points.assign(Points, Points + Count);
+		if(this->Type == SPLINE_HERMITE)
+			this->Tangents.assign(Tangents, Tangents + Count);
+		else
+			this->Tangents.clear();
+
+		std::size_t const SegmentCount = Count - 1;
+		this->Segments.resize(SegmentCount);
+		this->Table.resize(SegmentCount * static_cast<std::size_t>(this->Resolution));
+		this->Offsets.resize(SegmentCount + 1);
+		this->Dirty.assign(SegmentCount, 1);
+		this->DirtyCount = SegmentCount;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void tspline_curve<T, P>::invalidate(std::size_t FirstSegment, std::size_t LastSegment)
+	{
+		std::size_t const SegmentCount = this->Segments.size();
+		for(std::size_t i = FirstSegment; i <= LastSegment && i < SegmentCount; ++i)
+		{
+			if(this->Dirty[i])
+				continue;
+			this->Dirty[i] = 1;
+			++this->DirtyCount;
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void tspline_curve<T, P>::setPoint(std::size_t Index, point_type const & Point)
+	{
+		assert(Index < this->Points.size());
+		this->Points[Index] = Point;
+
+		// A Catmull-Rom segment depends on 4 control points, a Hermite segment on 2.
+		if(this->Type == SPLINE_CATMULL_ROM)
+			this->invalidate(Index >= 2 ? Index - 2 : 0, Index + 1);
+		else
+			this->invalidate(Index >= 1 ? Index - 1 : 0, Index);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void tspline_curve<T, P>::setTangent(std::size_t Index, point_type const & Tangent)
+	{
+		assert(this->Type == SPLINE_HERMITE && Index < this->Tangents.size());
+		this->Tangents[Index] = Tangent;
+		this->invalidate(Index >= 1 ? Index - 1 : 0, Index);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void tspline_curve<T, P>::fit(std::size_t Index)
+	{
+		segment & Segment = this->Segments[Index];
+		T const Two(2);
+		T const Three(3);
+
+		if(this->Type == SPLINE_CATMULL_ROM)
+		{
+			std::size_t const Last = this->Points.size() - 1;
+			point_type const & v1 = this->Points[Index > 0 ? Index - 1 : 0];
+			point_type const & v2 = this->Points[Index];
+			point_type const & v3 = this->Points[Index + 1];
+			point_type const & v4 = this->Points[Index + 2 <= Last ? Index + 2 : Last];
+			T const Half(0.5);
+
+			Segment.a = (-v1 + v2 * Three - v3 * Three + v4) * Half;
+			Segment.b = (v1 * Two - v2 * T(5) + v3 * T(4) - v4) * Half;
+			Segment.c = (v3 - v1) * Half;
+			Segment.d = v2;
+		}
+		else
+		{
+			point_type const & v1 = this->Points[Index];
+			point_type const & v2 = this->Points[Index + 1];
+			point_type const & t1 = this->Tangents[Index];
+			point_type const & t2 = this->Tangents[Index + 1];
+
+			Segment.a = v1 * Two - v2 * Two + t1 + t2;
+			Segment.b = v2 * Three - v1 * Three - t1 * Two - t2;
+			Segment.c = t1;
+			Segment.d = v1;
+		}
+
+		T * Lengths = &this->Table[Index * static_cast<std::size_t>(this->Resolution)];
+		T const Step = static_cast<T>(1) / static_cast<T>(this->Resolution);
+		T Length(0);
+		for(length_t i = 0; i < this->Resolution; ++i)
+		{
+			Length += detail::spline_segment_length<T, P>(Segment, Step * static_cast<T>(i), Step * static_cast<T>(i + 1));
+			Lengths[i] = Length;
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER std::size_t tspline_curve<T, P>::update()
+	{
+		if(this->DirtyCount == 0)
+			return 0;
+
+		std::size_t const SegmentCount = this->Segments.size();
+		std::size_t const Resolution = static_cast<std::size_t>(this->Resolution);
+		std::size_t const Refitted = this->DirtyCount;
+		std::size_t First = SegmentCount;
+
+		for(std::size_t i = 0; i < SegmentCount; ++i)
+		{
+			if(!this->Dirty[i])
+				continue;
+			this->fit(i);
+			this->Dirty[i] = 0;
+			First = std::min(First, i);
+		}
+		this->DirtyCount = 0;
+
+		// Only the offsets after the first refitted segment change
+		for(std::size_t i = First; i < SegmentCount; ++i)
+			this->Offsets[i + 1] = this->Offsets[i] + this->Table[i * Resolution + Resolution - 1];
+
+		return Refitted;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER std::size_t tspline_curve<T, P>::pointCount() const
+	{
+		return this->Points.size();
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER std::size_t tspline_curve<T, P>::segmentCount() const
+	{
+		return this->Segments.size();
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER typename tspline_curve<T, P>::segment const & tspline_curve<T, P>::getSegment(std::size_t Index) const
+	{
+		assert(this->DirtyCount == 0 && Index < this->Segments.size());
+		return this->Segments[Index];
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER T tspline_curve<T, P>::length() const
+	{
+		assert(this->DirtyCount == 0);
+		return this->Offsets.empty() ? static_cast<T>(0) : this->Offsets.back();
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER typename tspline_curve<T, P>::point_type tspline_curve<T, P>::evaluate(T u) const
+	{
+		assert(this->DirtyCount == 0 && !this->Segments.empty());
+		return detail::compute_spline_evaluate<T, P>::single(&this->Segments[0], this->Segments.size(), u);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void tspline_curve<T, P>::evaluate(T const * Params, std::size_t Count, point_type * Points) const
+	{
+		assert(this->DirtyCount == 0 && !this->Segments.empty());
+		detail::compute_spline_evaluate<T, P>::call(&this->Segments[0], this->Segments.size(), Params, Count, Points);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER T tspline_curve<T, P>::parameterAt(T Distance) const
+	{
+		assert(this->DirtyCount == 0 && !this->Segments.empty());
+
+		std::size_t const SegmentCount = this->Segments.size();
+		std::size_t const Resolution = static_cast<std::size_t>(this->Resolution);
+
+		if(Distance <= static_cast<T>(0))
+			return static_cast<T>(0);
+		if(Distance >= this->Offsets.back())
+			return static_cast<T>(SegmentCount);
+
+		std::size_t const Segment = std::min<std::size_t>(
+			static_cast<std::size_t>(std::upper_bound(this->Offsets.begin() + 1, this->Offsets.end(), Distance) - (this->Offsets.begin() + 1)),
+			SegmentCount - 1);
+		T const Local = Distance - this->Offsets[Segment];
+
+		T const * Lengths = &this->Table[Segment * Resolution];
+		std::size_t const Step = std::min<std::size_t>(
+			static_cast<std::size_t>(std::upper_bound(Lengths, Lengths + Resolution, Local) - Lengths),
+			Resolution - 1);
+		T const Begin = Step > 0 ? Lengths[Step - 1] : static_cast<T>(0);
+		T const Range = Lengths[Step] - Begin;
+		T const Fraction = Range > static_cast<T>(0) ? (Local - Begin) / Range : static_cast<T>(0);
+
+		// One Newton step on the arc length corrects the linear interpolation of the table
+		segment const & Coefs = this->Segments[Segment];
+		T const Start = static_cast<T>(Step) / static_cast<T>(Resolution);
+		T s = (static_cast<T>(Step) + Fraction) / static_cast<T>(Resolution);
+		T const Speed = glm::length((Coefs.a * (static_cast<T>(3) * s) + Coefs.b * static_cast<T>(2)) * s + Coefs.c);
+		if(Speed > static_cast<T>(0))
+		{
+			T const Error = Begin + detail::spline_segment_length<T, P>(Coefs, Start, s) - Local;
+			T const End = static_cast<T>(Step + 1) / static_cast<T>(Resolution);
+			s = glm::clamp(s - Error / Speed, Start, End);
+		}
+
+		return static_cast<T>(Segment) + s;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void tspline_curve<T, P>::evaluateAtDistance(T const * Distances, std::size_t Count, point_type * Points) const
+	{
+		// Convert a block of distances at a time to let the batched evaluation run on full SIMD registers
+		std::size_t const BlockSize = 256;
+		T Params[BlockSize];
+
+		for(std::size_t Begin = 0; Begin < Count; Begin += BlockSize)
+		{
+			std::size_t const Size = std::min(BlockSize, Count - Begin);
+			for(std::size_t i = 0; i < Size; ++i)
+				Params[i] = this->parameterAt(Distances[Begin + i]);
+			this->evaluate(Params, Size, Points + Begin);
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void tspline_curve<T, P>::sampleUniform(std::size_t Count, point_type * Points) const
+	{
+		if(Count == 0)
+			return;
+		if(Count == 1)
+		{
+			Points[0] = this->evaluate(static_cast<T>(0));
+			return;
+		}
+
+		std::size_t const BlockSize = 256;
+		T const Spacing = this->length() / static_cast<T>(Count - 1);
+		T Distances[BlockSize];
+
+		for(std::size_t Begin = 0; Begin < Count; Begin += BlockSize)
+		{
+			std::size_t const Size = std::min(BlockSize, Count - Begin);
+			for(std::size_t i = 0; i < Size; ++i)
+				Distances[i] = Spacing * static_cast<T>(Begin + i);
+			this->evaluateAtDistance(Distances, Size, Points + Begin);
+		}
+	}
+}//namespace glm
@@ -0,0 +1,130 @@
+/// @ref gtx_transform_hierarchy
+/// @file glm/gtx/transform_hierarchy.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_matrix_decompose (dependence)
+/// @see gtx_parallel (dependence)
+///
+/// @defgroup gtx_transform_hierarchy GLM_GTX_transform_hierarchy
+/// @ingroup gtx
+///
+/// @brief Hierarchy of translation, rotation and scale transformations with lazy world matrix updates.
+///
+/// Local transformations are stored in structure of arrays, nodes sorted by depth and siblings next
+/// to each other. Changing a local transformation flags the node, update() then recomputes the world
+/// matrices of the flagged nodes and of their descendants only, one depth level after the other.
+/// Consecutive flagged nodes are composed 4 at a time with SSE2 and the levels with many nodes are
+/// split across threads.
+///
+/// Creating, destroying and reparenting nodes reorders the arrays on the next update().
+///
+/// <glm/gtx/transform_hierarchy.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/matrix_decompose.hpp"
+#include "../gtx/parallel.hpp"
+#include <cstddef>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_transform_hierarchy is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_transform_hierarchy extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transform_hierarchy
+	/// @{
+
+	/// What an update did.
+	struct transform_hierarchy_stats
+	{
+		/// Number of world matrices recomputed.
+		std::size_t recomputed;
+		/// Number of depth levels.
+		std::size_t levels;
+		/// Number of levels split across threads.
+		std::size_t parallelLevels;
+		/// True when the nodes were reordered after a creation, a destruction or a reparenting.
+		bool reordered;
+	};
+
+	/// Tree of nodes with a local transformation, translation * rotation * scale, and a world matrix.
+	class transform_hierarchy
+	{
+	public:
+		typedef uint32 node;
+		static node const invalid = 0xFFFFFFFFu;
+
+		GLM_FUNC_DECL transform_hierarchy();
+
+		/// Create a node with an identity local transformation, a root when Parent is invalid.
+		GLM_FUNC_DECL node create(node Parent = invalid);
+
+		/// Destroy a node and its descendants. Their handles are reused after the next update().
+		GLM_FUNC_DECL void destroy(node Node);
+
+		/// Move a node and its descendants under Parent, or make it a root when Parent is invalid.
+		/// Parent must not be a descendant of Node.
+		GLM_FUNC_DECL void setParent(node Node, node Parent);
+		GLM_FUNC_DECL node parent(node Node) const;
+
+		GLM_FUNC_DECL void setTranslation(node Node, vec3 const & Translation);
+		GLM_FUNC_DECL void setRotation(node Node, quat const & Rotation);
+		GLM_FUNC_DECL void setScale(node Node, vec3 const & Scale);
+		GLM_FUNC_DECL void setLocal(node Node, vec3 const & Translation, quat const & Rotation, vec3 const & Scale);
+
+		GLM_FUNC_DECL vec3 const & translation(node Node) const;
+		GLM_FUNC_DECL quat const & rotation(node Node) const;
+		GLM_FUNC_DECL vec3 const & scale(node Node) const;
+
+		/// World matrix of a node as of the last update().
+		GLM_FUNC_DECL mat4 const & world(node Node) const;
+
+		/// Recompute the world matrices of the flagged nodes and of their descendants.
+		/// Levels of more than two grains of nodes run in parallel, the grain defaults to 1024 nodes.
+		GLM_FUNC_DECL transform_hierarchy_stats update(parallel_options const & Options = parallel_options());
+
+		/// Number of live nodes, destroyed nodes are counted until the next update().
+		GLM_FUNC_DECL std::size_t size() const;
+
+		/// World matrices of the live nodes sorted by depth, as of the last update(). nodes() gives their handles.
+		GLM_FUNC_DECL std::vector<mat4> const & worldMatrices() const;
+		GLM_FUNC_DECL std::vector<node> const & nodes() const;
+
+	private:
+		GLM_FUNC_DECL void reorder();
+		GLM_FUNC_DECL void flag(node Node);
+
+		// Sorted by depth, indexed by slot
+		std::vector<vec3> Translations;
+		std::vector<quat> Rotations;
+		std::vector<vec3> Scales;
+		std::vector<mat4> Worlds;
+		std::vector<uint8> Dirty;
+		std::vector<uint32> ParentSlots;
+		std::vector<node> SlotNodes;
+		// First slot of each level, followed by the number of slots
+		std::vector<uint32> Levels;
+
+		// Indexed by node
+		std::vector<uint32> NodeSlots;
+		std::vector<node> NodeParents;
+		std::vector<uint8> NodeAlive;
+		std::vector<node> FreeNodes;
+		std::size_t LiveCount;
+		bool Reorder;
+	};
+
+	/// @}
+}//namespace glm
+
+#include "transform_hierarchy.inl"
@@ -0,0 +1,314 @@
+/// @ref gtx_transform_hierarchy
+/// @file glm/gtx/transform_hierarchy.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/matrix.h"
+#endif
+#include <algorithm>
+#include <cassert>
+
+namespace glm{
+namespace detail
+{
+	// Parent * Local, mat4 is not necessarily aligned
+	GLM_FUNC_QUALIFIER void transform_hierarchy_mul(mat4 const & Parent, mat4 & Local)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_vec4 const In1[4] = {_mm_loadu_ps(&Parent[0][0]), _mm_loadu_ps(&Parent[1][0]), _mm_loadu_ps(&Parent[2][0]), _mm_loadu_ps(&Parent[3][0])};
+			glm_vec4 const In2[4] = {_mm_loadu_ps(&Local[0][0]), _mm_loadu_ps(&Local[1][0]), _mm_loadu_ps(&Local[2][0]), _mm_loadu_ps(&Local[3][0])};
+			glm_vec4 Out[4];
+			glm_mat4_mul(In1, In2, Out);
+			for(length_t c = 0; c < 4; ++c)
+				_mm_storeu_ps(&Local[c][0], Out[c]);
+#		else
+			Local = Parent * Local;
+#		endif
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER transform_hierarchy::transform_hierarchy() :
+		LiveCount(0),
+		Reorder(false)
+	{}
+
+	GLM_FUNC_QUALIFIER transform_hierarchy::node transform_hierarchy::create(node Parent)
+	{
+		assert(Parent == invalid || (Parent < NodeAlive.size() && NodeAlive[Parent]));
+
+		node Node = 0;
+		if(FreeNodes.empty())
+		{
+			Node = static_cast<node>(NodeParents.size());
+			NodeSlots.push_back(0);
+			NodeParents.push_back(static_cast<node>(invalid));
+			NodeAlive.push_back(0);
+		}
+		else
+		{
+			Node = FreeNodes.back();
+			FreeNodes.pop_back();
+		}
+
+		// Appended until the next update sorts the slots
+		NodeSlots[Node] = static_cast<uint32>(SlotNodes.size());
+		NodeParents[Node] = Parent;
+		NodeAlive[Node] = 1;
+		Translations.push_back(vec3(0.0f));
+		Rotations.push_back(quat(1.0f, 0.0f, 0.0f, 0.0f));
+		Scales.push_back(vec3(1.0f));
+		Worlds.push_back(mat4(1.0f));
+		Dirty.push_back(1);
+		ParentSlots.push_back(static_cast<uint32>(invalid));
+		SlotNodes.push_back(Node);
+
+		++LiveCount;
+		Reorder = true;
+		return Node;
+	}
+
+	GLM_FUNC_QUALIFIER void transform_hierarchy::destroy(node Node)
+	{
+		assert(Node < NodeAlive.size() && NodeAlive[Node]);
+
+		NodeAlive[Node] = 0;
+		Reorder = true;
+	}
+
+	GLM_FUNC_QUALIFIER void transform_hierarchy::setParent(node Node, node Parent)
+	{
+		assert(Node < NodeAlive.size() && NodeAlive[Node]);
+		assert(Parent == invalid || (Parent < NodeAlive.size() && NodeAlive[Parent]));
+
+		for(node Ancestor = Parent; Ancestor != invalid; Ancestor = NodeParents[Ancestor])
+		{
+			assert(Ancestor != Node);
+			if(Ancestor == Node)
+				return;
+		}
+
+		NodeParents[Node] = Parent;
+		this->flag(Node);
+		Reorder = true;
+	}
+
+	GLM_FUNC_QUALIFIER transform_hierarchy::node transform_hierarchy::parent(node Node) const
+	{
+		return NodeParents[Node];
+	}
+
+	GLM_FUNC_QUALIFIER void transform_hierarchy::flag(node Node)
+	{
+		assert(Node < NodeAlive.size() && NodeAlive[Node]);
+		Dirty[NodeSlots[Node]] = 1;
+	}
+
+	GLM_FUNC_QUALIFIER void transform_hierarchy::setTranslation(node Node, vec3 const & Translation)
+	{
+		this->flag(Node);
+		Translations[NodeSlots[Node]] = Translation;
+	}
+
+	GLM_FUNC_QUALIFIER void transform_hierarchy::setRotation(node Node, quat const & Rotation)
+	{
+		this->flag(Node);
+		Rotations[NodeSlots[Node]] = Rotation;
+	}
+
+	GLM_FUNC_QUALIFIER void transform_hierarchy::setScale(node Node, vec3 const & Scale)
+	{
+		this->flag(Node);
+		Scales[NodeSlots[Node]] = Scale;
+	}
+
+	GLM_FUNC_QUALIFIER void transform_hierarchy::setLocal(node Node, vec3 const & Translation, quat const & Rotation, vec3 const & Scale)
+	{
+		this->flag(Node);
+		uint32 const Slot = NodeSlots[Node];
+		Translations[Slot] = Translation;
+		Rotations[Slot] = Rotation;
+		Scales[Slot] = Scale;
+	}
+
+	GLM_FUNC_QUALIFIER vec3 const & transform_hierarchy::translation(node Node) const
+	{
+		return Translations[NodeSlots[Node]];
+	}
+
+	GLM_FUNC_QUALIFIER quat const & transform_hierarchy::rotation(node Node) const
+	{
+		return Rotations[NodeSlots[Node]];
+	}
+
+	GLM_FUNC_QUALIFIER vec3 const & transform_hierarchy::scale(node Node) const
+	{
+		return Scales[NodeSlots[Node]];
+	}
+
+	GLM_FUNC_QUALIFIER mat4 const & transform_hierarchy::world(node Node) const
+	{
+		return Worlds[NodeSlots[Node]];
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t transform_hierarchy::size() const
+	{
+		return LiveCount;
+	}
+
+	GLM_FUNC_QUALIFIER std::vector<mat4> const & transform_hierarchy::worldMatrices() const
+	{
+		return Worlds;
+	}
+
+	GLM_FUNC_QUALIFIER std::vector<transform_hierarchy::node> const & transform_hierarchy::nodes() const
+	{
+		return SlotNodes;
+	}
+
+	// Sort the live nodes breadth first and release the destroyed ones
+	GLM_FUNC_QUALIFIER void transform_hierarchy::reorder()
+	{
+		std::size_t const NodeCount = NodeParents.size();
+
+		std::vector<uint32> ChildBegin(NodeCount + 1, 0);
+		for(std::size_t i = 0; i < NodeCount; ++i)
+			if(NodeAlive[i] && NodeParents[i] != invalid && NodeAlive[NodeParents[i]])
+				++ChildBegin[NodeParents[i] + 1];
+		for(std::size_t i = 0; i < NodeCount; ++i)
+			ChildBegin[i + 1] += ChildBegin[i];
+		std::vector<node> Children(ChildBegin[NodeCount]);
+		std::vector<uint32> ChildEnd(ChildBegin.begin(), ChildBegin.end() - 1);
+		for(std::size_t i = 0; i < NodeCount; ++i)
+			if(NodeAlive[i] && NodeParents[i] != invalid && NodeAlive[NodeParents[i]])
+				Children[ChildEnd[NodeParents[i]]++] = static_cast<node>(i);
+
+		std::vector<node> Order;
+		Order.reserve(NodeCount);
+		for(std::size_t i = 0; i < NodeCount; ++i)
+			if(NodeAlive[i] && NodeParents[i] == invalid)
+				Order.push_back(static_cast<node>(i));
+
+		Levels.clear();
+		for(std::size_t LevelBegin = 0; LevelBegin < Order.size();)
+		{
+			std::size_t const LevelEnd = Order.size();
+			Levels.push_back(static_cast<uint32>(LevelBegin));
+			for(std::size_t i = LevelBegin; i < LevelEnd; ++i)
+				Order.insert(Order.end(), Children.begin() + ChildBegin[Order[i]], Children.begin() + ChildBegin[Order[i] + 1]);
+			LevelBegin = LevelEnd;
+		}
+		Levels.push_back(static_cast<uint32>(Order.size()));
+
+		std::vector<uint32> Slots(NodeCount, static_cast<uint32>(invalid));
+		for(std::size_t i = 0; i < Order.size(); ++i)
+			Slots[Order[i]] = static_cast<uint32>(i);
+
+		// Nodes with a destroyed ancestor are not reached
+		for(std::size_t i = 0; i < NodeCount; ++i)
+		{
+			if(Slots[i] == invalid && NodeSlots[i] != invalid)
+			{
+				NodeAlive[i] = 0;
+				NodeParents[i] = invalid;
+				FreeNodes.push_back(static_cast<node>(i));
+			}
+		}
+
+		std::vector<vec3> NewTranslations(Order.size());
+		std::vector<quat> NewRotations(Order.size());
+		std::vector<vec3> NewScales(Order.size());
+		std::vector<mat4> NewWorlds(Order.size());
+		std::vector<uint8> NewDirty(Order.size());
+		std::vector<uint32> NewParentSlots(Order.size());
+		for(std::size_t i = 0; i < Order.size(); ++i)
+		{
+			uint32 const Slot = NodeSlots[Order[i]];
+			NewTranslations[i] = Translations[Slot];
+			NewRotations[i] = Rotations[Slot];
+			NewScales[i] = Scales[Slot];
+			NewWorlds[i] = Worlds[Slot];
+			NewDirty[i] = Dirty[Slot];
+			NewParentSlots[i] = NodeParents[Order[i]] == invalid ? invalid : Slots[NodeParents[Order[i]]];
+		}
+
+		Translations.swap(NewTranslations);
+		Rotations.swap(NewRotations);
+		Scales.swap(NewScales);
+		Worlds.swap(NewWorlds);
+		Dirty.swap(NewDirty);
+		ParentSlots.swap(NewParentSlots);
+		SlotNodes.swap(Order);
+		NodeSlots.swap(Slots);
+		LiveCount = SlotNodes.size();
+	}
+
+	GLM_FUNC_QUALIFIER transform_hierarchy_stats transform_hierarchy::update(parallel_options const & Options)
+	{
+		transform_hierarchy_stats Stats;
+		Stats.recomputed = 0;
+		Stats.parallelLevels = 0;
+		Stats.reordered = Reorder;
+
+		if(Reorder)
+		{
+			this->reorder();
+			Reorder = false;
+		}
+		Stats.levels = Levels.empty() ? 0 : Levels.size() - 1;
+
+		if(std::find(Dirty.begin(), Dirty.end(), static_cast<uint8>(1)) == Dirty.end())
+			return Stats;
+
+		parallel_options LevelOptions(Options);
+		if(LevelOptions.grain == 0)
+			LevelOptions.grain = 1024;
+
+		// Dirty flags the nodes whose world matrix changes, the parents are in the previous level
+		std::atomic<std::size_t> Recomputed(0);
+		for(std::size_t Level = 0; Level < Stats.levels; ++Level)
+		{
+			std::size_t const LevelBegin = Levels[Level];
+			std::size_t const LevelEnd = Levels[Level + 1];
+
+			auto Kernel = [&](std::size_t Begin, std::size_t End)
+			{
+				std::size_t Count = 0;
+				std::size_t i = LevelBegin + Begin;
+				std::size_t const Last = LevelBegin + End;
+				while(i < Last)
+				{
+					std::size_t j = i;
+					while(j < Last && (Dirty[j] || (ParentSlots[j] != invalid && Dirty[ParentSlots[j]])))
+						++j;
+					if(j == i)
+					{
+						++i;
+						continue;
+					}
+
+					recomposeBatch(j - i, &Scales[i], &Rotations[i], &Translations[i], &Worlds[i]);
+					for(std::size_t k = i; k < j; ++k)
+					{
+						if(ParentSlots[k] != invalid)
+							detail::transform_hierarchy_mul(Worlds[ParentSlots[k]], Worlds[k]);
+						Dirty[k] = 1;
+					}
+					Count += j - i;
+					i = j;
+				}
+				Recomputed.fetch_add(Count, std::memory_order_relaxed);
+			};
+
+			if(LevelEnd - LevelBegin >= LevelOptions.grain * 2)
+			{
+				++Stats.parallelLevels;
+				parallelFor(LevelEnd - LevelBegin, Kernel, LevelOptions);
+			}
+			else
+				Kernel(0, LevelEnd - LevelBegin);
+		}
+
+		std::fill(Dirty.begin(), Dirty.end(), static_cast<uint8>(0));
+		Stats.recomputed = Recomputed.load(std::memory_order_relaxed);
+		return Stats;
+	}
+}//namespace glm
@@ -0,0 +1,63 @@
+/// @ref gtx_vertex_batch
+/// @file glm/gtx/vertex_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_vertex_batch GLM_GTX_vertex_batch
+/// @ingroup gtx
+///
+/// @brief Transformation, normalization and bounds of large arrays of vertices.
+///
+/// Arrays of vec3 are processed 16 at a time with AVX-512, the tail uses masked loads and stores,
+/// and 4 at a time with SSE2. The AVX-512 path is used when GLM_ARCH includes GLM_ARCH_AVX512_BIT,
+/// for example with -march=skylake-avx512, and can be run under the Intel Software Development
+/// Emulator on other processors. Results may differ in the last bit between instruction sets.
+///
+/// <glm/gtx/vertex_batch.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_vertex_batch is an experimetal extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_vertex_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_vertex_batch
+	/// @{
+
+	/// Out[i] = vec3(Matrix * vec4(In[i], 1)) for Count points, without perspective division.
+	/// In and Out may be the same array.
+	/// @see gtx_vertex_batch
+	GLM_FUNC_DECL void transformPointBatch(std::size_t Count, mat4 const & Matrix, vec3 const * In, vec3 * Out);
+
+	/// Out[i] = vec3(Matrix * vec4(In[i], 0)) for Count directions. In and Out may be the same array.
+	/// @see gtx_vertex_batch
+	GLM_FUNC_DECL void transformVectorBatch(std::size_t Count, mat4 const & Matrix, vec3 const * In, vec3 * Out);
+
+	/// Out[i] = Matrix * In[i] for Count vectors. In and Out may be the same array.
+	/// @see gtx_vertex_batch
+	GLM_FUNC_DECL void transformBatch(std::size_t Count, mat4 const & Matrix, vec4 const * In, vec4 * Out);
+
+	/// Out[i] = normalize(In[i]) for Count vectors, with a relative error below 2^-21.
+	/// Null vectors give NaN like normalize. In and Out may be the same array.
+	/// @see gtx_vertex_batch
+	GLM_FUNC_DECL void normalizeBatch(std::size_t Count, vec3 const * In, vec3 * Out);
+
+	/// Grow the box [Min, Max] to contain Count points.
+	/// Initialize Min to vec3(std::numeric_limits<float>::max()) and Max to -Min for the bounds of an array.
+	/// @see gtx_vertex_batch
+	GLM_FUNC_DECL void boundsBatch(std::size_t Count, vec3 const * Points, vec3 & Min, vec3 & Max);
+
+	/// @}
+}//namespace glm
+
+#include "vertex_batch.inl"
@@ -0,0 +1,407 @@
+/// @ref gtx_vertex_batch
+/// @file glm/gtx/vertex_batch.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/matrix.h"
+#endif
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	// Permutations between 3 registers of 16 interleaved vec3 and 3 registers of 16 x, y and z.
+	// Each direction takes two _mm512_permutex2var_ps: the first one combines two registers, the
+	// second one inserts the elements of the third register.
+	struct vertex_avx512_shuffle
+	{
+		GLM_FUNC_QUALIFIER vertex_avx512_shuffle()
+		{
+			GLM_ALIGN(64) int32 First[16];
+			GLM_ALIGN(64) int32 Second[16];
+
+			for(int c = 0; c < 3; ++c)
+			{
+				for(int i = 0; i < 16; ++i)
+				{
+					int const g = i * 3 + c;
+					First[i] = g < 32 ? g : 0;
+					Second[i] = g < 32 ? i : 16 + g - 32;
+				}
+				this->Load[c][0] = _mm512_load_si512(First);
+				this->Load[c][1] = _mm512_load_si512(Second);
+			}
+
+			for(int r = 0; r < 3; ++r)
+			{
+				for(int j = 0; j < 16; ++j)
+				{
+					int const v = (r * 16 + j) / 3;
+					int const c = (r * 16 + j) % 3;
+					First[j] = c == 0 ? v : (c == 1 ? 16 + v : 0);
+					Second[j] = c == 2 ? 16 + v : j;
+				}
+				this->Store[r][0] = _mm512_load_si512(First);
+				this->Store[r][1] = _mm512_load_si512(Second);
+			}
+		}
+
+		__m512i Load[3][2];
+		__m512i Store[3][2];
+	};
+
+	GLM_FUNC_QUALIFIER __mmask16 vertex_avx512_mask(std::size_t Count)
+	{
+		return Count >= 16 ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>((1u << Count) - 1u);
+	}
+
+	// Kernel(X, Y, Z, Mask) receives 16 vertices, the lanes outside of Mask are zeros.
+	// Returns the number of vertices processed, 0 if vec3 is padded.
+	template <typename kernel>
+	GLM_FUNC_QUALIFIER std::size_t vertex_batch_avx512(std::size_t Count, vec3 const * In, vec3 * Out, kernel & Kernel)
+	{
+		if(sizeof(vec3) != sizeof(float) * 3)
+			return 0;
+
+		// Kept in registers, indexing the arrays in the loop goes through memory
+		vertex_avx512_shuffle const Shuffle;
+		__m512i const LoadX0 = Shuffle.Load[0][0], LoadX1 = Shuffle.Load[0][1];
+		__m512i const LoadY0 = Shuffle.Load[1][0], LoadY1 = Shuffle.Load[1][1];
+		__m512i const LoadZ0 = Shuffle.Load[2][0], LoadZ1 = Shuffle.Load[2][1];
+		__m512i const StoreA0 = Shuffle.Store[0][0], StoreA1 = Shuffle.Store[0][1];
+		__m512i const StoreB0 = Shuffle.Store[1][0], StoreB1 = Shuffle.Store[1][1];
+		__m512i const StoreC0 = Shuffle.Store[2][0], StoreC1 = Shuffle.Store[2][1];
+
+		float const * Src = reinterpret_cast<float const *>(In);
+		float * Dst = reinterpret_cast<float *>(Out);
+
+		for(std::size_t i = 0; i < Count; i += 16)
+		{
+			__mmask16 MaskA = 0xFFFF, MaskB = 0xFFFF, MaskC = 0xFFFF, Mask = 0xFFFF;
+			__m512 a, b, c;
+			if(Count - i >= 16)
+			{
+				a = _mm512_loadu_ps(Src + i * 3);
+				b = _mm512_loadu_ps(Src + i * 3 + 16);
+				c = _mm512_loadu_ps(Src + i * 3 + 32);
+			}
+			else
+			{
+				std::size_t const Floats = (Count - i) * 3;
+				MaskA = vertex_avx512_mask(Floats);
+				MaskB = vertex_avx512_mask(Floats > 16 ? Floats - 16 : 0);
+				MaskC = vertex_avx512_mask(Floats > 32 ? Floats - 32 : 0);
+				Mask = vertex_avx512_mask(Count - i);
+				a = _mm512_maskz_loadu_ps(MaskA, Src + i * 3);
+				b = _mm512_maskz_loadu_ps(MaskB, Src + i * 3 + 16);
+				c = _mm512_maskz_loadu_ps(MaskC, Src + i * 3 + 32);
+			}
+
+			__m512 X = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, LoadX0, b), LoadX1, c);
+			__m512 Y = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, LoadY0, b), LoadY1, c);
+			__m512 Z = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, LoadZ0, b), LoadZ1, c);
+
+			Kernel(X, Y, Z, Mask);
+
+			if(!Dst)
+				continue;
+			a = _mm512_permutex2var_ps(_mm512_permutex2var_ps(X, StoreA0, Y), StoreA1, Z);
+			b = _mm512_permutex2var_ps(_mm512_permutex2var_ps(X, StoreB0, Y), StoreB1, Z);
+			c = _mm512_permutex2var_ps(_mm512_permutex2var_ps(X, StoreC0, Y), StoreC1, Z);
+			_mm512_mask_storeu_ps(Dst + i * 3, MaskA, a);
+			_mm512_mask_storeu_ps(Dst + i * 3 + 16, MaskB, b);
+			_mm512_mask_storeu_ps(Dst + i * 3 + 32, MaskC, c);
+		}
+		return Count;
+	}
+
+	struct vertex_transform_avx512
+	{
+		GLM_FUNC_QUALIFIER vertex_transform_avx512(mat4 const & m, float w) :
+			XX(_mm512_set1_ps(m[0][0])), XY(_mm512_set1_ps(m[1][0])), XZ(_mm512_set1_ps(m[2][0])), XW(_mm512_set1_ps(m[3][0] * w)),
+			YX(_mm512_set1_ps(m[0][1])), YY(_mm512_set1_ps(m[1][1])), YZ(_mm512_set1_ps(m[2][1])), YW(_mm512_set1_ps(m[3][1] * w)),
+			ZX(_mm512_set1_ps(m[0][2])), ZY(_mm512_set1_ps(m[1][2])), ZZ(_mm512_set1_ps(m[2][2])), ZW(_mm512_set1_ps(m[3][2] * w))
+		{}
+
+		GLM_FUNC_QUALIFIER void operator()(__m512 & X, __m512 & Y, __m512 & Z, __mmask16) const
+		{
+			__m512 const x = _mm512_fmadd_ps(this->XX, X, _mm512_fmadd_ps(this->XY, Y, _mm512_fmadd_ps(this->XZ, Z, this->XW)));
+			__m512 const y = _mm512_fmadd_ps(this->YX, X, _mm512_fmadd_ps(this->YY, Y, _mm512_fmadd_ps(this->YZ, Z, this->YW)));
+			__m512 const z = _mm512_fmadd_ps(this->ZX, X, _mm512_fmadd_ps(this->ZY, Y, _mm512_fmadd_ps(this->ZZ, Z, this->ZW)));
+			X = x;
+			Y = y;
+			Z = z;
+		}
+
+		// Row then column of the matrix, the translation is scaled by w
+		__m512 XX, XY, XZ, XW;
+		__m512 YX, YY, YZ, YW;
+		__m512 ZX, ZY, ZZ, ZW;
+	};
+
+	struct vertex_normalize_avx512
+	{
+		GLM_FUNC_QUALIFIER void operator()(__m512 & X, __m512 & Y, __m512 & Z, __mmask16) const
+		{
+			__m512 const Dot = _mm512_fmadd_ps(X, X, _mm512_fmadd_ps(Y, Y, _mm512_mul_ps(Z, Z)));
+			__m512 Inv = _mm512_maskz_rsqrt14_ps(0xFFFF, Dot);
+			// One Newton-Raphson step: Inv * (1.5 - 0.5 * Dot * Inv^2)
+			Inv = _mm512_mul_ps(Inv, _mm512_fnmadd_ps(_mm512_mul_ps(_mm512_mul_ps(Dot, _mm512_set1_ps(0.5f)), Inv), Inv, _mm512_set1_ps(1.5f)));
+			X = _mm512_mul_ps(X, Inv);
+			Y = _mm512_mul_ps(Y, Inv);
+			Z = _mm512_mul_ps(Z, Inv);
+		}
+	};
+
+	struct vertex_bounds_avx512
+	{
+		GLM_FUNC_QUALIFIER vertex_bounds_avx512(vec3 const & Min, vec3 const & Max) :
+			MinX(_mm512_set1_ps(Min.x)), MinY(_mm512_set1_ps(Min.y)), MinZ(_mm512_set1_ps(Min.z)),
+			MaxX(_mm512_set1_ps(Max.x)), MaxY(_mm512_set1_ps(Max.y)), MaxZ(_mm512_set1_ps(Max.z))
+		{}
+
+		GLM_FUNC_QUALIFIER void operator()(__m512 & X, __m512 & Y, __m512 & Z, __mmask16 Mask)
+		{
+			// The second operand is returned for NaN, NaN coordinates are ignored like with min and max
+			this->MinX = _mm512_mask_min_ps(this->MinX, Mask, X, this->MinX);
+			this->MinY = _mm512_mask_min_ps(this->MinY, Mask, Y, this->MinY);
+			this->MinZ = _mm512_mask_min_ps(this->MinZ, Mask, Z, this->MinZ);
+			this->MaxX = _mm512_mask_max_ps(this->MaxX, Mask, X, this->MaxX);
+			this->MaxY = _mm512_mask_max_ps(this->MaxY, Mask, Y, this->MaxY);
+			this->MaxZ = _mm512_mask_max_ps(this->MaxZ, Mask, Z, this->MaxZ);
+		}
+
+		__m512 MinX, MinY, MinZ;
+		__m512 MaxX, MaxY, MaxZ;
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Kernel(X, Y, Z) receives 4 vertices, the tail is left to the caller.
+	// Returns the number of vertices processed, 0 if vec3 is padded.
+	template <typename kernel>
+	GLM_FUNC_QUALIFIER std::size_t vertex_batch_sse2(std::size_t Count, vec3 const * In, vec3 * Out, kernel & Kernel)
+	{
+		if(sizeof(vec3) != sizeof(float) * 3)
+			return 0;
+
+		float const * Src = reinterpret_cast<float const *>(In);
+		float * Dst = reinterpret_cast<float *>(Out);
+
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+			glm_vec4 const a = _mm_loadu_ps(Src + i * 3);
+			glm_vec4 const b = _mm_loadu_ps(Src + i * 3 + 4);
+			glm_vec4 const c = _mm_loadu_ps(Src + i * 3 + 8);
+
+			glm_vec4 const t0 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+			glm_vec4 const t1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+			glm_vec4 X = _mm_shuffle_ps(a, t0, _MM_SHUFFLE(2, 0, 3, 0));
+			glm_vec4 Y = _mm_shuffle_ps(t1, t0, _MM_SHUFFLE(3, 1, 2, 0));
+			glm_vec4 Z = _mm_shuffle_ps(t1, c, _MM_SHUFFLE(3, 0, 3, 1));
+
+			Kernel(X, Y, Z);
+
+			if(!Dst)
+				continue;
+			glm_vec4 const p = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(2, 0, 2, 0));
+			glm_vec4 const q = _mm_shuffle_ps(Z, X, _MM_SHUFFLE(3, 1, 2, 0));
+			glm_vec4 const r = _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 1, 3, 1));
+			_mm_storeu_ps(Dst + i * 3, _mm_shuffle_ps(p, q, _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(Dst + i * 3 + 4, _mm_shuffle_ps(r, p, _MM_SHUFFLE(3, 1, 2, 0)));
+			_mm_storeu_ps(Dst + i * 3 + 8, _mm_shuffle_ps(q, r, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+		return i;
+	}
+
+	struct vertex_transform_sse2
+	{
+		GLM_FUNC_QUALIFIER vertex_transform_sse2(mat4 const & m, float w) :
+			XX(_mm_set1_ps(m[0][0])), XY(_mm_set1_ps(m[1][0])), XZ(_mm_set1_ps(m[2][0])), XW(_mm_set1_ps(m[3][0] * w)),
+			YX(_mm_set1_ps(m[0][1])), YY(_mm_set1_ps(m[1][1])), YZ(_mm_set1_ps(m[2][1])), YW(_mm_set1_ps(m[3][1] * w)),
+			ZX(_mm_set1_ps(m[0][2])), ZY(_mm_set1_ps(m[1][2])), ZZ(_mm_set1_ps(m[2][2])), ZW(_mm_set1_ps(m[3][2] * w))
+		{}
+
+		GLM_FUNC_QUALIFIER void operator()(glm_vec4 & X, glm_vec4 & Y, glm_vec4 & Z) const
+		{
+			glm_vec4 const x = glm_vec4_fma(this->XX, X, glm_vec4_fma(this->XY, Y, glm_vec4_fma(this->XZ, Z, this->XW)));
+			glm_vec4 const y = glm_vec4_fma(this->YX, X, glm_vec4_fma(this->YY, Y, glm_vec4_fma(this->YZ, Z, this->YW)));
+			glm_vec4 const z = glm_vec4_fma(this->ZX, X, glm_vec4_fma(this->ZY, Y, glm_vec4_fma(this->ZZ, Z, this->ZW)));
+			X = x;
+			Y = y;
+			Z = z;
+		}
+
+		// Row then column of the matrix, the translation is scaled by w
+		glm_vec4 XX, XY, XZ, XW;
+		glm_vec4 YX, YY, YZ, YW;
+		glm_vec4 ZX, ZY, ZZ, ZW;
+	};
+
+	struct vertex_normalize_sse2
+	{
+		GLM_FUNC_QUALIFIER void operator()(glm_vec4 & X, glm_vec4 & Y, glm_vec4 & Z) const
+		{
+			glm_vec4 const Dot = glm_vec4_fma(X, X, glm_vec4_fma(Y, Y, _mm_mul_ps(Z, Z)));
+			glm_vec4 Inv = _mm_rsqrt_ps(Dot);
+			// One Newton-Raphson step: Inv * (1.5 - 0.5 * Dot * Inv^2)
+			Inv = _mm_mul_ps(Inv, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(Dot, _mm_set1_ps(0.5f)), Inv), Inv)));
+			X = _mm_mul_ps(X, Inv);
+			Y = _mm_mul_ps(Y, Inv);
+			Z = _mm_mul_ps(Z, Inv);
+		}
+	};
+
+	struct vertex_bounds_sse2
+	{
+		GLM_FUNC_QUALIFIER vertex_bounds_sse2(vec3 const & Min, vec3 const & Max) :
+			MinX(_mm_set1_ps(Min.x)), MinY(_mm_set1_ps(Min.y)), MinZ(_mm_set1_ps(Min.z)),
+			MaxX(_mm_set1_ps(Max.x)), MaxY(_mm_set1_ps(Max.y)), MaxZ(_mm_set1_ps(Max.z))
+		{}
+
+		GLM_FUNC_QUALIFIER void operator()(glm_vec4 & X, glm_vec4 & Y, glm_vec4 & Z)
+		{
+			// The second operand is returned for NaN, NaN coordinates are ignored like with min and max
+			this->MinX = _mm_min_ps(X, this->MinX);
+			this->MinY = _mm_min_ps(Y, this->MinY);
+			this->MinZ = _mm_min_ps(Z, this->MinZ);
+			this->MaxX = _mm_max_ps(X, this->MaxX);
+			this->MaxY = _mm_max_ps(Y, this->MaxY);
+			this->MaxZ = _mm_max_ps(Z, this->MaxZ);
+		}
+
+		glm_vec4 MinX, MinY, MinZ;
+		glm_vec4 MaxX, MaxY, MaxZ;
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	GLM_FUNC_QUALIFIER void vertex_transform(std::size_t Count, mat4 const & Transform, float w, vec3 const * In, vec3 * Out)
+	{
+		// Copy, Out may alias the matrix as far as the compiler knows
+		mat4 const Matrix(Transform);
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			vertex_transform_avx512 Kernel(Matrix, w);
+			i = vertex_batch_avx512(Count, In, Out, Kernel);
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			vertex_transform_sse2 Kernel(Matrix, w);
+			i = vertex_batch_sse2(Count, In, Out, Kernel);
+#		endif
+
+		// Without the fourth row, much faster than the generic mat4 product without SIMD
+		vec3 const Col0(Matrix[0]), Col1(Matrix[1]), Col2(Matrix[2]), Col3(vec3(Matrix[3]) * w);
+		for(; i < Count; ++i)
+		{
+			vec3 const v(In[i]);
+			Out[i] = Col0 * v.x + Col1 * v.y + Col2 * v.z + Col3;
+		}
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void transformPointBatch(std::size_t Count, mat4 const & Matrix, vec3 const * In, vec3 * Out)
+	{
+		detail::vertex_transform(Count, Matrix, 1.0f, In, Out);
+	}
+
+	GLM_FUNC_QUALIFIER void transformVectorBatch(std::size_t Count, mat4 const & Matrix, vec3 const * In, vec3 * Out)
+	{
+		detail::vertex_transform(Count, Matrix, 0.0f, In, Out);
+	}
+
+	GLM_FUNC_QUALIFIER void transformBatch(std::size_t Count, mat4 const & Matrix, vec4 const * In, vec4 * Out)
+	{
+		std::size_t i = 0;
+
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			// 4 vectors per register, each 128 bits lane multiplies a copy of the matrix.
+			// The maskz forms with a full mask avoid the undefined source of the unmasked intrinsics.
+			__m512 const Col0 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(&Matrix[0].x));
+			__m512 const Col1 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(&Matrix[1].x));
+			__m512 const Col2 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(&Matrix[2].x));
+			__m512 const Col3 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(&Matrix[3].x));
+
+			float const * Src = reinterpret_cast<float const *>(In);
+			float * Dst = reinterpret_cast<float *>(Out);
+			for(; i < Count; i += 4)
+			{
+				__mmask16 const Mask = detail::vertex_avx512_mask((Count - i < 4 ? Count - i : 4) * 4);
+				__m512 const v = _mm512_maskz_loadu_ps(Mask, Src + i * 4);
+				__m512 const a0 = _mm512_mul_ps(Col0, _mm512_maskz_permute_ps(0xFFFF, v, _MM_SHUFFLE(0, 0, 0, 0)));
+				__m512 const a1 = _mm512_mul_ps(Col2, _mm512_maskz_permute_ps(0xFFFF, v, _MM_SHUFFLE(2, 2, 2, 2)));
+				__m512 const b0 = _mm512_fmadd_ps(Col1, _mm512_maskz_permute_ps(0xFFFF, v, _MM_SHUFFLE(1, 1, 1, 1)), a0);
+				__m512 const b1 = _mm512_fmadd_ps(Col3, _mm512_maskz_permute_ps(0xFFFF, v, _MM_SHUFFLE(3, 3, 3, 3)), a1);
+				_mm512_mask_storeu_ps(Dst + i * 4, Mask, _mm512_add_ps(b0, b1));
+			}
+			i = Count;
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_vec4 Col[4];
+			for(length_t c = 0; c < 4; ++c)
+				Col[c] = _mm_loadu_ps(&Matrix[c].x);
+
+			for(; i < Count; ++i)
+				_mm_storeu_ps(&Out[i].x, glm_mat4_mul_vec4(Col, _mm_loadu_ps(&In[i].x)));
+#		endif
+
+		for(; i < Count; ++i)
+			Out[i] = Matrix * In[i];
+	}
+
+	GLM_FUNC_QUALIFIER void normalizeBatch(std::size_t Count, vec3 const * In, vec3 * Out)
+	{
+		std::size_t i = 0;
+
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			detail::vertex_normalize_avx512 Kernel;
+			i = detail::vertex_batch_avx512(Count, In, Out, Kernel);
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			detail::vertex_normalize_sse2 Kernel;
+			i = detail::vertex_batch_sse2(Count, In, Out, Kernel);
+#		endif
+
+		for(; i < Count; ++i)
+			Out[i] = normalize(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void boundsBatch(std::size_t Count, vec3 const * Points, vec3 & Min, vec3 & Max)
+	{
+		std::size_t i = 0;
+
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			detail::vertex_bounds_avx512 Kernel(Min, Max);
+			i = detail::vertex_batch_avx512(Count, Points, static_cast<vec3 *>(NULL), Kernel);
+			__m512 const Lower[3] = {Kernel.MinX, Kernel.MinY, Kernel.MinZ};
+			__m512 const Upper[3] = {Kernel.MaxX, Kernel.MaxY, Kernel.MaxZ};
+			GLM_ALIGN(64) float Lanes[2][16];
+			for(length_t c = 0; c < 3; ++c)
+			{
+				_mm512_store_ps(Lanes[0], Lower[c]);
+				_mm512_store_ps(Lanes[1], Upper[c]);
+				for(int l = 0; l < 16; ++l)
+				{
+					Min[c] = glm::min(Min[c], Lanes[0][l]);
+					Max[c] = glm::max(Max[c], Lanes[1][l]);
+				}
+			}
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			detail::vertex_bounds_sse2 Kernel(Min, Max);
+			i = detail::vertex_batch_sse2(Count, Points, static_cast<vec3 *>(NULL), Kernel);
+			glm_vec4 const Lower[3] = {Kernel.MinX, Kernel.MinY, Kernel.MinZ};
+			glm_vec4 const Upper[3] = {Kernel.MaxX, Kernel.MaxY, Kernel.MaxZ};
+			GLM_ALIGN(16) float Lanes[4];
+			for(length_t c = 0; c < 3; ++c)
+			{
+				_mm_store_ps(Lanes, Lower[c]);
+				Min[c] = glm::min(glm::min(Lanes[0], Lanes[1]), glm::min(Lanes[2], Lanes[3]));
+				_mm_store_ps(Lanes, Upper[c]);
+				Max[c] = glm::max(glm::max(Lanes[0], Lanes[1]), glm::max(Lanes[2], Lanes[3]));
+			}
+#		endif
+
+		for(; i < Count; ++i)
+		{
+			Min = glm::min(Min, Points[i]);
+			Max = glm::max(Max, Points[i]);
+		}
+	}
+}//namespace glm
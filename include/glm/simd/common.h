@@ -63,7 +63,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_swizzle_xyzw(glm_vec4 a)
 
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
 {
-#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#	if GLM_HAS_FMA
 		return _mm_fmadd_ss(a, b, c);
 #	else
 		return _mm_add_ss(_mm_mul_ss(a, b), c);
@@ -72,13 +72,33 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
 
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
 {
-#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#	if GLM_HAS_FMA
 		return _mm_fmadd_ps(a, b, c);
 #	else
 		return glm_vec4_add(glm_vec4_mul(a, b), c);
 #	endif
 }
 
+// a * b - c
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fms(glm_vec4 a, glm_vec4 b, glm_vec4 c)
+{
+#	if GLM_HAS_FMA
+		return _mm_fmsub_ps(a, b, c);
+#	else
+		return glm_vec4_sub(glm_vec4_mul(a, b), c);
+#	endif
+}
+
+// c - a * b
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fnma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
+{
+#	if GLM_HAS_FMA
+		return _mm_fnmadd_ps(a, b, c);
+#	else
+		return glm_vec4_sub(c, glm_vec4_mul(a, b));
+#	endif
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_abs(glm_vec4 x)
 {
 	return _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
@@ -237,4 +257,44 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inf(glm_vec4 x)
 	return _mm_castsi128_ps(_mm_cmpeq_epi32(t2, _mm_set1_epi32(0xFF000000)));		// exponent is all 1s, fraction is 0
 }
 
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_fma(glm_dvec4 a, glm_dvec4 b, glm_dvec4 c)
+{
+#	if GLM_HAS_FMA
+		return _mm256_fmadd_pd(a, b, c);
+#	else
+		return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_abs(glm_dvec4 x)
+{
+	return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_floor(glm_dvec4 x)
+{
+	return _mm256_floor_pd(x);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_min(glm_dvec4 a, glm_dvec4 b)
+{
+	return _mm256_min_pd(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_max(glm_dvec4 a, glm_dvec4 b)
+{
+	return _mm256_max_pd(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_clamp(glm_dvec4 v, glm_dvec4 minVal, glm_dvec4 maxVal)
+{
+	glm_dvec4 const max0 = _mm256_max_pd(v, minVal);
+	glm_dvec4 const min0 = _mm256_min_pd(max0, maxVal);
+	return min0;
+}
+
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include "platform.h"
+#include "common.h"
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -17,4 +17,112 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sqrt_lowp(glm_vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+// Reciprocal square root estimate refined by one Newton-Raphson step, error below 4 ulp.
+// 0 and denormals give +inf, infinity gives 0.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inversesqrt(glm_vec4 x)
+{
+	glm_vec4 const isr0 = _mm_rsqrt_ps(x);
+	glm_vec4 const mul0 = _mm_mul_ps(_mm_mul_ps(x, _mm_set1_ps(0.5f)), _mm_mul_ps(isr0, isr0));
+	glm_vec4 const nwt0 = _mm_mul_ps(isr0, _mm_sub_ps(_mm_set1_ps(1.5f), mul0));
+	// The Newton-Raphson step gives NaN when the estimate is 0 or infinity
+	glm_vec4 const spc0 = _mm_or_ps(_mm_cmpeq_ps(isr0, _mm_setzero_ps()), _mm_cmpeq_ps(isr0, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000))));
+	return _mm_or_ps(_mm_and_ps(spc0, isr0), _mm_andnot_ps(spc0, nwt0));
+}
+
+// log2(x) = e + t * P(t^2) with m = x / 2^e in [sqrt(0.5), sqrt(2)) and t = (m - 1) / (m + 1), using the
+// minimax polynomial of GTX_image_color_space. The error is below 5 ulp, log2(2^n) is exact.
+// log2(0) = -inf, log2(inf) = inf and negative values give NaN.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2(glm_vec4 x)
+{
+	// Denormals are scaled by 2^23 first
+	glm_vec4 const den0 = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+	glm_vec4 const scl0 = _mm_or_ps(_mm_and_ps(den0, _mm_mul_ps(x, _mm_set1_ps(8388608.0f))), _mm_andnot_ps(den0, x));
+	__m128i const bit0 = _mm_castps_si128(scl0);
+	glm_vec4 const man0 = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bit0, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+	glm_vec4 const ept0 = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bit0, 23), _mm_set1_epi32(127)));
+	glm_vec4 const ept1 = _mm_sub_ps(ept0, _mm_and_ps(den0, _mm_set1_ps(23.0f)));
+
+	// Move the mantissa from [1, 2) to [sqrt(0.5), sqrt(2))
+	glm_vec4 const ovr0 = _mm_cmpge_ps(man0, _mm_set1_ps(1.41421356f));
+	glm_vec4 const man1 = _mm_sub_ps(man0, _mm_and_ps(ovr0, _mm_mul_ps(man0, _mm_set1_ps(0.5f))));
+	glm_vec4 const ept2 = _mm_add_ps(ept1, _mm_and_ps(ovr0, _mm_set1_ps(1.0f)));
+
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+	glm_vec4 const t = _mm_div_ps(_mm_sub_ps(man1, one0), _mm_add_ps(man1, one0));
+	glm_vec4 const u = _mm_mul_ps(t, t);
+	glm_vec4 const pol0 = glm_vec4_fma(u, _mm_set1_ps(0.5957965146f), _mm_set1_ps(0.9615878611f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, u, _mm_set1_ps(2.8853904259f));
+	glm_vec4 const res0 = glm_vec4_fma(pol1, t, ept2);
+
+	glm_vec4 const zer0 = _mm_cmpeq_ps(x, _mm_setzero_ps());
+	glm_vec4 const inf0 = _mm_cmpeq_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000)));
+	glm_vec4 const nan0 = _mm_cmpnge_ps(x, _mm_setzero_ps());
+	glm_vec4 const res1 = _mm_or_ps(_mm_andnot_ps(zer0, res0), _mm_and_ps(zer0, _mm_castsi128_ps(_mm_set1_epi32(0xFF800000))));
+	glm_vec4 const res2 = _mm_or_ps(_mm_andnot_ps(inf0, res1), _mm_and_ps(inf0, x));
+	return _mm_or_ps(res2, nan0);
+}
+
+// 2^n * 2^f with n = round(x) and f in [-0.5, 0.5]
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_reduced(__m128i n, glm_vec4 f)
+{
+	// Degree 5 minimax polynomial with the constant term fixed to 1, relative error 9.2e-8
+	glm_vec4 const pol0 = glm_vec4_fma(f, _mm_set1_ps(0.0013264729f), _mm_set1_ps(0.0096715132f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, f, _mm_set1_ps(0.0555073374f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, f, _mm_set1_ps(0.2402224208f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, f, _mm_set1_ps(0.6931469776f));
+	glm_vec4 const pol4 = glm_vec4_fma(pol3, f, _mm_set1_ps(1.0f));
+
+	// Two scales so that results in the denormal range are rounded once
+	__m128i const n1 = _mm_srai_epi32(n, 1);
+	__m128i const n2 = _mm_sub_epi32(n, n1);
+	glm_vec4 const scl1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(127)), 23));
+	glm_vec4 const scl2 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n2, _mm_set1_epi32(127)), 23));
+	return _mm_mul_ps(_mm_mul_ps(pol4, scl1), scl2);
+}
+
+// Error below 2.5 ulp, exp2 of integers is exact. Overflows to inf and underflows to 0.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2(glm_vec4 x)
+{
+	// The second operand is returned for NaN, NaN is kept
+	glm_vec4 const clp0 = _mm_min_ps(_mm_set1_ps(160.0f), _mm_max_ps(_mm_set1_ps(-160.0f), x));
+	__m128i const n = _mm_cvtps_epi32(clp0);
+	glm_vec4 const f = _mm_sub_ps(clp0, _mm_cvtepi32_ps(n));
+	return glm_vec4_exp2_reduced(n, f);
+}
+
+// x = n * ln(2) + r with the Cody and Waite reduction, then e^r = 2^(r / ln(2)). Error below 2.5 ulp.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp(glm_vec4 x)
+{
+	glm_vec4 const clp0 = _mm_min_ps(_mm_set1_ps(112.0f), _mm_max_ps(_mm_set1_ps(-112.0f), x));
+	__m128i const n = _mm_cvtps_epi32(_mm_mul_ps(clp0, _mm_set1_ps(1.44269504f)));
+	glm_vec4 const flt0 = _mm_cvtepi32_ps(n);
+	glm_vec4 const r0 = _mm_sub_ps(clp0, _mm_mul_ps(flt0, _mm_set1_ps(0.693359375f)));
+	glm_vec4 const r1 = _mm_sub_ps(r0, _mm_mul_ps(flt0, _mm_set1_ps(-2.12194440e-4f)));
+	return glm_vec4_exp2_reduced(n, _mm_mul_ps(r1, _mm_set1_ps(1.44269504f)));
+}
+
+// Error below 6 ulp, same special values as glm_vec4_log2.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log(glm_vec4 x)
+{
+	return _mm_mul_ps(glm_vec4_log2(x), _mm_set1_ps(0.693147181f));
+}
+
+// 2^(y * log2(x)), the error of log2 is scaled by y: about 40 ulp for y = 2.4 and 230 ulp for y = 128.
+// x < 0 gives NaN, pow(x, 0) is 1 like std::pow.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const mul0 = _mm_mul_ps(y, glm_vec4_log2(x));
+	glm_vec4 const mul1 = _mm_and_ps(_mm_cmpneq_ps(y, _mm_setzero_ps()), mul0);
+	return glm_vec4_exp2(mul1);
+}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_sqrt(glm_dvec4 x)
+{
+	return _mm256_sqrt_pd(x);
+}
+
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
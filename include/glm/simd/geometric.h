@@ -62,6 +62,19 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_dot(glm_vec4 v1, glm_vec4 v2)
 #	endif
 }
 
+// The dot product of the first three components in all components, summed in the same order as
+// the scalar code. The fourth components are ignored. _mm_dp_ps is slower here, even with AVX.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec3_dot(glm_vec4 v1, glm_vec4 v2)
+{
+	glm_vec4 const mul0 = _mm_mul_ps(v1, v2);
+	glm_vec4 const swp0 = _mm_shuffle_ps(mul0, mul0, _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const swp1 = _mm_movehl_ps(mul0, mul0);
+	glm_vec4 const add0 = _mm_add_ss(mul0, swp0);
+	glm_vec4 const add1 = _mm_add_ss(add0, swp1);
+	glm_vec4 const swp2 = _mm_shuffle_ps(add1, add1, _MM_SHUFFLE(0, 0, 0, 0));
+	return swp2;
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
 {
 	glm_vec4 const swp0 = _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 0, 2, 1));
@@ -82,6 +95,16 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize(glm_vec4 v)
 	return mul0;
 }
 
+// Like normalize of tvec3, v * (1 / length(v)) in the first three components
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec3_normalize(glm_vec4 v)
+{
+	glm_vec4 const dot0 = glm_vec3_dot(v, v);
+	glm_vec4 const sqt0 = _mm_sqrt_ps(dot0);
+	glm_vec4 const div0 = _mm_div_ps(_mm_set1_ps(1.0f), sqt0);
+	glm_vec4 const mul0 = _mm_mul_ps(v, div0);
+	return mul0;
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_faceforward(glm_vec4 N, glm_vec4 I, glm_vec4 Nref)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(Nref, I);
@@ -121,4 +144,51 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 	return sub2;
 }
 
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// The dot product in the four components
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_dot(glm_dvec4 v1, glm_dvec4 v2)
+{
+	glm_dvec4 const mul0 = _mm256_mul_pd(v1, v2);
+	glm_dvec4 const hadd0 = _mm256_hadd_pd(mul0, mul0);
+	glm_dvec4 const swp0 = _mm256_permute2f128_pd(hadd0, hadd0, 0x01);
+	glm_dvec4 const add0 = _mm256_add_pd(hadd0, swp0);
+	return add0;
+}
+
+// The dot product in the first component only, without crossing the 128 bits lanes back
+GLM_FUNC_QUALIFIER double glm_dvec1_dot(glm_dvec4 v1, glm_dvec4 v2)
+{
+	glm_dvec4 const mul0 = _mm256_mul_pd(v1, v2);
+	__m128d const add0 = _mm_add_pd(_mm256_castpd256_pd128(mul0), _mm256_extractf128_pd(mul0, 1));
+	__m128d const add1 = _mm_add_sd(add0, _mm_unpackhi_pd(add0, add0));
+	return _mm_cvtsd_f64(add1);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_length(glm_dvec4 x)
+{
+	glm_dvec4 const dot0 = glm_dvec4_dot(x, x);
+	glm_dvec4 const sqt0 = _mm256_sqrt_pd(dot0);
+	return sqt0;
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_distance(glm_dvec4 p0, glm_dvec4 p1)
+{
+	glm_dvec4 const sub0 = _mm256_sub_pd(p0, p1);
+	glm_dvec4 const len0 = glm_dvec4_length(sub0);
+	return len0;
+}
+
+// Like inversesqrt, the scalar square root and division are shorter than the 256 bits ones
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_normalize(glm_dvec4 v)
+{
+	__m128d const dot0 = _mm_set_sd(glm_dvec1_dot(v, v));
+	__m128d const isr0 = _mm_div_sd(_mm_set_sd(1.0), _mm_sqrt_sd(dot0, dot0));
+	glm_dvec4 const isr1 = _mm256_set1_pd(_mm_cvtsd_f64(isr0));
+	glm_dvec4 const mul0 = _mm256_mul_pd(v, isr1);
+	return mul0;
+}
+
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -112,4 +112,131 @@ GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave2(glm_uvec4 x, glm_uvec4 y)
 	return Reg1;
 }
 
+#if GLM_ARCH & GLM_ARCH_SSSE3_BIT
+GLM_FUNC_QUALIFIER glm_ivec4 glm_uvec4_bitCount(glm_uvec4 x)
+{
+	glm_uvec4 const Mask = _mm_set1_epi8(0x0F);
+	glm_uvec4 const Table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+
+	// Bit count of each nibble looked up in a table, then the bytes of each component summed
+	glm_uvec4 const lo0 = _mm_shuffle_epi8(Table, _mm_and_si128(x, Mask));
+	glm_uvec4 const hi0 = _mm_shuffle_epi8(Table, _mm_and_si128(_mm_srli_epi16(x, 4), Mask));
+	glm_uvec4 const add0 = _mm_maddubs_epi16(_mm_add_epi8(lo0, hi0), _mm_set1_epi8(1));
+	return _mm_madd_epi16(add0, _mm_set1_epi16(1));
+}
+#endif//GLM_ARCH & GLM_ARCH_SSSE3_BIT
+
+// Index of the most significant bit set of each component, -1 for 0
+GLM_FUNC_QUALIFIER glm_ivec4 glm_uvec4_findMSB(glm_uvec4 x)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		return _mm_sub_epi32(_mm_set1_epi32(31), _mm_lzcnt_epi32(x));
+#	else
+		// Keeping only the set bits whose upper neighbour is clear prevents the conversion to float
+		// from rounding up to the next power of two, the exponent is the index of the most significant bit.
+		glm_uvec4 const and0 = _mm_andnot_si128(_mm_srli_epi32(x, 1), x);
+		glm_ivec4 const cvt0 = _mm_castps_si128(_mm_cvtepi32_ps(and0));
+		glm_ivec4 const sub0 = _mm_sub_epi32(_mm_srli_epi32(cvt0, 23), _mm_set1_epi32(127));
+
+		// 0 has a null exponent: -127 becomes -1
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			glm_ivec4 const max0 = _mm_max_epi32(sub0, _mm_set1_epi32(-1));
+#		else
+			glm_ivec4 const max0 = _mm_or_si128(sub0, _mm_srai_epi32(sub0, 31));
+#		endif
+
+		// The conversion is signed, components with the sign bit set are handled separately
+		glm_ivec4 const sgn0 = _mm_srai_epi32(x, 31);
+		return _mm_or_si128(_mm_andnot_si128(sgn0, max0), _mm_and_si128(sgn0, _mm_set1_epi32(31)));
+#	endif
+}
+
+// Index of the least significant bit set of each component, -1 for 0
+GLM_FUNC_QUALIFIER glm_ivec4 glm_uvec4_findLSB(glm_uvec4 x)
+{
+	glm_uvec4 const lsb0 = _mm_and_si128(x, _mm_sub_epi32(_mm_setzero_si128(), x));
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		return _mm_sub_epi32(_mm_set1_epi32(31), _mm_lzcnt_epi32(lsb0));
+#	else
+		// A single bit set converts exactly, 0x80000000 converts to -2^31 which has the same exponent
+		glm_ivec4 const cvt0 = _mm_castps_si128(_mm_cvtepi32_ps(lsb0));
+		glm_ivec4 const exp0 = _mm_and_si128(_mm_srli_epi32(cvt0, 23), _mm_set1_epi32(0xFF));
+		glm_ivec4 const sub0 = _mm_sub_epi32(exp0, _mm_set1_epi32(127));
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			return _mm_max_epi32(sub0, _mm_set1_epi32(-1));
+#		else
+			return _mm_or_si128(sub0, _mm_srai_epi32(sub0, 31));
+#		endif
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_uvec4 glm_uvec4_uaddCarry(glm_uvec4 x, glm_uvec4 y, glm_uvec4 & Carry)
+{
+	glm_uvec4 const Sign = _mm_set1_epi32(static_cast<int>(0x80000000));
+
+	// The sum wrapped around if it is lower than x, compared as signed after flipping the sign bits
+	glm_uvec4 const add0 = _mm_add_epi32(x, y);
+	glm_uvec4 const cmp0 = _mm_cmpgt_epi32(_mm_xor_si128(x, Sign), _mm_xor_si128(add0, Sign));
+	Carry = _mm_srli_epi32(cmp0, 31);
+	return add0;
+}
+
+// Returns y - x like the scalar version of usubBorrow
+GLM_FUNC_QUALIFIER glm_uvec4 glm_uvec4_usubBorrow(glm_uvec4 x, glm_uvec4 y, glm_uvec4 & Borrow)
+{
+	glm_uvec4 const Sign = _mm_set1_epi32(static_cast<int>(0x80000000));
+
+	glm_uvec4 const cmp0 = _mm_cmpgt_epi32(_mm_xor_si128(y, Sign), _mm_xor_si128(x, Sign));
+	Borrow = _mm_srli_epi32(cmp0, 31);
+	return _mm_sub_epi32(y, x);
+}
+
+GLM_FUNC_QUALIFIER void glm_uvec4_umulExtended(glm_uvec4 x, glm_uvec4 y, glm_uvec4 & msb, glm_uvec4 & lsb)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		// The four 64 bits products in one register, then the low words gathered in the low half
+		__m256i const mul0 = _mm256_mul_epu32(_mm256_cvtepu32_epi64(x), _mm256_cvtepu32_epi64(y));
+		__m256i const prm0 = _mm256_permutevar8x32_epi32(mul0, _mm256_set_epi32(7, 5, 3, 1, 6, 4, 2, 0));
+
+		lsb = _mm256_castsi256_si128(prm0);
+		msb = _mm256_extracti128_si256(prm0, 1);
+#	else
+		glm_uvec4 const Low = _mm_set_epi32(0, -1, 0, -1);
+
+		// 64 bits products of the even and of the odd components
+		glm_uvec4 const mul0 = _mm_mul_epu32(x, y);
+		glm_uvec4 const mul1 = _mm_mul_epu32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32));
+
+		lsb = _mm_or_si128(_mm_and_si128(mul0, Low), _mm_slli_epi64(mul1, 32));
+		msb = _mm_or_si128(_mm_srli_epi64(mul0, 32), _mm_andnot_si128(Low, mul1));
+#	endif
+}
+
+GLM_FUNC_QUALIFIER void glm_ivec4_imulExtended(glm_ivec4 x, glm_ivec4 y, glm_ivec4 & msb, glm_ivec4 & lsb)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		__m256i const mul0 = _mm256_mul_epi32(_mm256_cvtepi32_epi64(x), _mm256_cvtepi32_epi64(y));
+		__m256i const prm0 = _mm256_permutevar8x32_epi32(mul0, _mm256_set_epi32(7, 5, 3, 1, 6, 4, 2, 0));
+
+		lsb = _mm256_castsi256_si128(prm0);
+		msb = _mm256_extracti128_si256(prm0, 1);
+#	elif GLM_ARCH & GLM_ARCH_SSE41_BIT
+		glm_ivec4 const Low = _mm_set_epi32(0, -1, 0, -1);
+
+		glm_ivec4 const mul0 = _mm_mul_epi32(x, y);
+		glm_ivec4 const mul1 = _mm_mul_epi32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32));
+
+		lsb = _mm_or_si128(_mm_and_si128(mul0, Low), _mm_slli_epi64(mul1, 32));
+		msb = _mm_or_si128(_mm_srli_epi64(mul0, 32), _mm_andnot_si128(Low, mul1));
+#	else
+		// The signed high word is the unsigned one minus y when x < 0 and minus x when y < 0
+		glm_uvec4 msb0;
+		glm_uvec4_umulExtended(x, y, msb0, lsb);
+		glm_ivec4 const cor0 = _mm_and_si128(_mm_srai_epi32(x, 31), y);
+		glm_ivec4 const cor1 = _mm_and_si128(_mm_srai_epi32(y, 31), x);
+		msb = _mm_sub_epi32(msb0, _mm_add_epi32(cor0, cor1));
+#	endif
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
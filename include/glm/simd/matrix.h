@@ -38,13 +38,19 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
 	__m128 v2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
 	__m128 v3 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
 
-	__m128 m0 = _mm_mul_ps(m[0], v0);
-	__m128 m1 = _mm_mul_ps(m[1], v1);
-	__m128 m2 = _mm_mul_ps(m[2], v2);
-	__m128 m3 = _mm_mul_ps(m[3], v3);
+#	if GLM_HAS_FMA
+		// Two independent chains to hide the latency of the fused multiply-adds
+		__m128 a0 = _mm_fmadd_ps(m[1], v1, _mm_mul_ps(m[0], v0));
+		__m128 a1 = _mm_fmadd_ps(m[3], v3, _mm_mul_ps(m[2], v2));
+#	else
+		__m128 m0 = _mm_mul_ps(m[0], v0);
+		__m128 m1 = _mm_mul_ps(m[1], v1);
+		__m128 m2 = _mm_mul_ps(m[2], v2);
+		__m128 m3 = _mm_mul_ps(m[3], v3);
 
-	__m128 a0 = _mm_add_ps(m0, m1);
-	__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a0 = _mm_add_ps(m0, m1);
+		__m128 a1 = _mm_add_ps(m2, m3);
+#	endif
 	__m128 a2 = _mm_add_ps(a0, a1);
 
 	return a2;
@@ -79,78 +85,52 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
 
 GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
 {
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[0] = a2;
-	}
-
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[1] = a2;
-	}
-
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[2] = a2;
-	}
-
-	{
-		//(__m128&)_mm_shuffle_epi32(__m128i&)in2[0], _MM_SHUFFLE(3, 3, 3, 3))
-		__m128 e0 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[3] = a2;
-	}
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		// Two columns of the result per iteration: the columns of in1 are duplicated in both 128 bits
+		// lanes and each lane broadcasts the components of one column of in2.
+		__m256 const a0 = _mm256_broadcast_ps(&in1[0]);
+		__m256 const a1 = _mm256_broadcast_ps(&in1[1]);
+		__m256 const a2 = _mm256_broadcast_ps(&in1[2]);
+		__m256 const a3 = _mm256_broadcast_ps(&in1[3]);
+
+		__m256 const b01 = _mm256_insertf128_ps(_mm256_castps128_ps256(in2[0]), in2[1], 1);
+		__m256 const b23 = _mm256_insertf128_ps(_mm256_castps128_ps256(in2[2]), in2[3], 1);
+
+		__m256 r[2];
+		for(int i = 0; i < 2; ++i)
+		{
+			__m256 const b = i == 0 ? b01 : b23;
+			__m256 const e0 = _mm256_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0));
+			__m256 const e1 = _mm256_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1));
+			__m256 const e2 = _mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2));
+			__m256 const e3 = _mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3));
+
+#			if GLM_HAS_FMA
+				__m256 const s0 = _mm256_fmadd_ps(a1, e1, _mm256_mul_ps(a0, e0));
+				__m256 const s1 = _mm256_fmadd_ps(a3, e3, _mm256_mul_ps(a2, e2));
+#			else
+				__m256 const s0 = _mm256_add_ps(_mm256_mul_ps(a0, e0), _mm256_mul_ps(a1, e1));
+				__m256 const s1 = _mm256_add_ps(_mm256_mul_ps(a2, e2), _mm256_mul_ps(a3, e3));
+#			endif
+			r[i] = _mm256_add_ps(s0, s1);
+		}
+
+		out[0] = _mm256_castps256_ps128(r[0]);
+		out[1] = _mm256_extractf128_ps(r[0], 1);
+		out[2] = _mm256_castps256_ps128(r[1]);
+		out[3] = _mm256_extractf128_ps(r[1], 1);
+#	else
+		// Each column is computed before any store, out may alias in1 or in2
+		glm_vec4 const c0 = glm_mat4_mul_vec4(in1, in2[0]);
+		glm_vec4 const c1 = glm_mat4_mul_vec4(in1, in2[1]);
+		glm_vec4 const c2 = glm_mat4_mul_vec4(in1, in2[2]);
+		glm_vec4 const c3 = glm_mat4_mul_vec4(in1, in2[3]);
+
+		out[0] = c0;
+		out[1] = c1;
+		out[2] = c2;
+		out[3] = c3;
+#	endif
 }
 
 GLM_FUNC_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4])
@@ -1025,4 +1005,163 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const & c, __m128 const & r
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+
+// The mat3 functions take the columns of a matrix with padded columns like an aligned tmat3x3. The
+// fourth component of each column is ignored and the fourth component of the results is unspecified.
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_mul_vec3(glm_vec4 const m[3], glm_vec4 v)
+{
+	glm_vec4 const v0 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const v1 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const v2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+
+#	if GLM_HAS_FMA
+		glm_vec4 const mad0 = _mm_fmadd_ps(m[1], v1, _mm_mul_ps(m[0], v0));
+		glm_vec4 const mad1 = _mm_fmadd_ps(m[2], v2, mad0);
+		return mad1;
+#	else
+		glm_vec4 const mul0 = _mm_mul_ps(m[0], v0);
+		glm_vec4 const mul1 = _mm_mul_ps(m[1], v1);
+		glm_vec4 const mul2 = _mm_mul_ps(m[2], v2);
+		glm_vec4 const add0 = _mm_add_ps(mul0, mul1);
+		glm_vec4 const add1 = _mm_add_ps(add0, mul2);
+		return add1;
+#	endif
+}
+
+GLM_FUNC_QUALIFIER void glm_mat3_mul(glm_vec4 const in1[3], glm_vec4 const in2[3], glm_vec4 out[3])
+{
+	// Each column is computed before any store, out may alias in1 or in2
+	glm_vec4 const c0 = glm_mat3_mul_vec3(in1, in2[0]);
+	glm_vec4 const c1 = glm_mat3_mul_vec3(in1, in2[1]);
+	glm_vec4 const c2 = glm_mat3_mul_vec3(in1, in2[2]);
+
+	out[0] = c0;
+	out[1] = c1;
+	out[2] = c2;
+}
+
+// The fourth component of the result columns repeats the third one
+GLM_FUNC_QUALIFIER void glm_mat3_transpose(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	glm_vec4 const unp0 = _mm_unpacklo_ps(in[0], in[1]);
+	glm_vec4 const unp1 = _mm_unpackhi_ps(in[0], in[1]);
+	glm_vec4 const in2 = in[2];
+
+	out[0] = _mm_movelh_ps(unp0, _mm_shuffle_ps(in2, in2, _MM_SHUFFLE(0, 0, 0, 0)));
+	out[1] = _mm_shuffle_ps(unp0, in2, _MM_SHUFFLE(1, 1, 3, 2));
+	out[2] = _mm_shuffle_ps(unp1, in2, _MM_SHUFFLE(2, 2, 1, 0));
+}
+
+// The columns of the cofactor matrix, the inverse transpose times the determinant
+GLM_FUNC_QUALIFIER void glm_mat3_cofactor(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	glm_vec4 const xpd0 = glm_vec4_cross(in[1], in[2]);
+	glm_vec4 const xpd1 = glm_vec4_cross(in[2], in[0]);
+	glm_vec4 const xpd2 = glm_vec4_cross(in[0], in[1]);
+
+	out[0] = xpd0;
+	out[1] = xpd1;
+	out[2] = xpd2;
+}
+
+// The determinant in all components, dot(in[0], cross(in[1], in[2]))
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_determinant(glm_vec4 const in[3])
+{
+	glm_vec4 const xpd0 = glm_vec4_cross(in[1], in[2]);
+	glm_vec4 const dot0 = glm_vec3_dot(in[0], xpd0);
+	return dot0;
+}
+
+// Same operations as the scalar inverseTranspose: the cofactors divided by the determinant
+GLM_FUNC_QUALIFIER void glm_mat3_inverseTranspose(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	glm_vec4 cof[3];
+	glm_mat3_cofactor(in, cof);
+
+	glm_vec4 const det0 = glm_vec3_dot(in[0], cof[0]);
+
+	out[0] = _mm_div_ps(cof[0], det0);
+	out[1] = _mm_div_ps(cof[1], det0);
+	out[2] = _mm_div_ps(cof[2], det0);
+}
+
+// Same operations as the scalar inverse: the transposed cofactors multiplied by one over the
+// determinant, expanded along the first row like the scalar code.
+GLM_FUNC_QUALIFIER void glm_mat3_inverse(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	glm_vec4 cof[3];
+	glm_mat3_cofactor(in, cof);
+
+	glm_vec4 const mul0 = _mm_mul_ps(in[0], cof[0]);
+	glm_vec4 const mul1 = _mm_mul_ps(in[1], cof[1]);
+	glm_vec4 const mul2 = _mm_mul_ps(in[2], cof[2]);
+	glm_vec4 const add0 = _mm_add_ps(mul0, mul1);
+	glm_vec4 const add1 = _mm_add_ps(add0, mul2);
+	glm_vec4 const det0 = _mm_shuffle_ps(add1, add1, _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const rcp0 = _mm_div_ps(_mm_set1_ps(1.0f), det0);
+
+	glm_vec4 tra[3];
+	glm_mat3_transpose(cof, tra);
+
+	out[0] = _mm_mul_ps(tra[0], rcp0);
+	out[1] = _mm_mul_ps(tra[1], rcp0);
+	out[2] = _mm_mul_ps(tra[2], rcp0);
+}
+
+// The mat2 functions take the four components of a tmat2x2 in a single register, column after column
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat2_mul(glm_vec4 m1, glm_vec4 m2)
+{
+	glm_vec4 const swp0 = _mm_movelh_ps(m1, m1);
+	glm_vec4 const swp1 = _mm_movehl_ps(m1, m1);
+	glm_vec4 const swp2 = _mm_shuffle_ps(m2, m2, _MM_SHUFFLE(2, 2, 0, 0));
+	glm_vec4 const swp3 = _mm_shuffle_ps(m2, m2, _MM_SHUFFLE(3, 3, 1, 1));
+	glm_vec4 const mul0 = _mm_mul_ps(swp0, swp2);
+	glm_vec4 const mul1 = _mm_mul_ps(swp1, swp3);
+	glm_vec4 const add0 = _mm_add_ps(mul0, mul1);
+	return add0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat2_transpose(glm_vec4 m)
+{
+	return _mm_shuffle_ps(m, m, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+// The determinant in the first component, m[0][0] * m[1][1] - m[1][0] * m[0][1]
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat2_determinant(glm_vec4 m)
+{
+	glm_vec4 const swp0 = _mm_shuffle_ps(m, m, _MM_SHUFFLE(0, 1, 2, 3));
+	glm_vec4 const mul0 = _mm_mul_ps(m, swp0);
+	glm_vec4 const swp1 = _mm_movehl_ps(mul0, mul0);
+	glm_vec4 const sub0 = _mm_sub_ss(mul0, swp1);
+	return sub0;
+}
+
+// The transposed cofactors, (m[1][1], -m[0][1], -m[1][0], m[0][0])
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat2_adjugate(glm_vec4 m)
+{
+	glm_vec4 const swp0 = _mm_shuffle_ps(m, m, _MM_SHUFFLE(0, 2, 1, 3));
+	glm_vec4 const neg0 = _mm_xor_ps(swp0, _mm_set_ps(0.0f, -0.0f, -0.0f, 0.0f));
+	return neg0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat2_inverse(glm_vec4 m)
+{
+	glm_vec4 const det0 = glm_mat2_determinant(m);
+	glm_vec4 const rcp0 = _mm_div_ss(_mm_set_ss(1.0f), det0);
+	glm_vec4 const rcp1 = _mm_shuffle_ps(rcp0, rcp0, _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const mul0 = _mm_mul_ps(glm_mat2_adjugate(m), rcp1);
+	return mul0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat2_inverseTranspose(glm_vec4 m)
+{
+	glm_vec4 const det0 = glm_mat2_determinant(m);
+	glm_vec4 const det1 = _mm_shuffle_ps(det0, det0, _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const tra0 = glm_mat2_transpose(glm_mat2_adjugate(m));
+	glm_vec4 const div0 = _mm_div_ps(tra0, det1);
+	return div0;
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
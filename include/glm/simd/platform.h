@@ -300,7 +300,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 // Instruction sets
 
-// User defines: GLM_FORCE_PURE GLM_FORCE_SSE2 GLM_FORCE_SSE3 GLM_FORCE_AVX GLM_FORCE_AVX2 GLM_FORCE_AVX2
+// User defines: GLM_FORCE_PURE GLM_FORCE_SSE2 GLM_FORCE_SSE3 GLM_FORCE_AVX GLM_FORCE_AVX2 GLM_FORCE_AVX512 GLM_FORCE_FMA
 
 #define GLM_ARCH_X86_BIT		0x00000001
 #define GLM_ARCH_SSE2_BIT		0x00000002
@@ -311,8 +311,8 @@
 #define GLM_ARCH_AVX_BIT		0x00000040
 #define GLM_ARCH_AVX2_BIT		0x00000080
 #define GLM_ARCH_AVX512_BIT		0x00000100 // Skylake subset
-#define GLM_ARCH_ARM_BIT		0x00000100
-#define GLM_ARCH_NEON_BIT		0x00000200
+#define GLM_ARCH_ARM_BIT		0x00001000
+#define GLM_ARCH_NEON_BIT		0x00002000
 #define GLM_ARCH_MIPS_BIT		0x00010000
 #define GLM_ARCH_PPC_BIT		0x01000000
 
@@ -410,6 +410,13 @@
 #	define GLM_ARCH GLM_ARCH_PURE
 #endif
 
+// FMA3 has its own CPUID flag: GCC and Clang only accept its intrinsics with -mfma or a -march that includes it
+#if (GLM_ARCH & GLM_ARCH_AVX_BIT) && (defined(GLM_FORCE_FMA) || defined(__FMA__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT)))
+#	define GLM_HAS_FMA 1
+#else
+#	define GLM_HAS_FMA 0
+#endif
+
 // With MinGW-W64, including intrinsic headers before intrin.h will produce some errors. The problem is
 // that windows.h (and maybe other headers) will silently include intrin.h, which of course causes problems.
 // To fix, we just explicitly include intrin.h here.
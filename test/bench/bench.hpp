@@ -0,0 +1,31 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench
+{
+	// Best of Repeat runs of Func in milliseconds, the first run warms the caches and the thread pools up
+	template <typename funcType>
+	double time(funcType const & Func, int Repeat = 5)
+	{
+		Func();
+
+		double Best = 0.0;
+		for(int i = 0; i < Repeat; ++i)
+		{
+			std::chrono::steady_clock::time_point const Begin = std::chrono::steady_clock::now();
+			Func();
+			std::chrono::duration<double, std::milli> const Duration = std::chrono::steady_clock::now() - Begin;
+			Best = i == 0 || Duration.count() < Best ? Duration.count() : Best;
+		}
+		return Best;
+	}
+
+	// Milliseconds and millions of elements per second
+	inline void report(char const * Name, double Milliseconds, std::size_t Count)
+	{
+		std::printf("\t%-48s %10.3f ms %10.1f M/s\n", Name, Milliseconds, static_cast<double>(Count) / (Milliseconds * 1000.0));
+	}
+}//namespace bench
@@ -0,0 +1,154 @@
+#include <JobSystem.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include "bench.hpp"
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Scaling of the JobSystem of Common on a frame of 3 dependent stages, culling, skinning and
+// command building, from 1 thread to the number of hardware threads, and the cost of a job.
+namespace
+{
+	glm::uint32 const Count = 1 << 20;
+	glm::uint32 const Grain = 1024;
+	glm::uint32 const BoneCount = 64;
+
+	struct frame
+	{
+		std::vector<glm::vec4> Positions;
+		std::vector<glm::uint32> Bones;
+		std::vector<glm::mat4> Palette;
+		glm::vec4 Plane;
+
+		std::vector<glm::uint32> Visible;
+		std::vector<glm::vec4> Skinned;
+		std::vector<glm::uint32> Commands;
+		// Incremented by the main thread job that submits the commands
+		unsigned Submitted;
+	};
+
+	void cull(void * Data, glm::uint32 Begin, glm::uint32 End)
+	{
+		frame & Frame = *static_cast<frame *>(Data);
+		for(glm::uint32 i = Begin; i < End; ++i)
+			Frame.Visible[i] = glm::dot(Frame.Plane, Frame.Positions[i]) >= 0.0f ? 1u : 0u;
+	}
+
+	void skin(void * Data, glm::uint32 Begin, glm::uint32 End)
+	{
+		frame & Frame = *static_cast<frame *>(Data);
+		for(glm::uint32 i = Begin; i < End; ++i)
+			Frame.Skinned[i] = Frame.Visible[i] ? Frame.Palette[Frame.Bones[i]] * Frame.Positions[i] : glm::vec4(0.0f);
+	}
+
+	void build(void * Data, glm::uint32 Begin, glm::uint32 End)
+	{
+		frame & Frame = *static_cast<frame *>(Data);
+		for(glm::uint32 i = Begin; i < End; ++i)
+			Frame.Commands[i] = Frame.Visible[i] ? glm::packUnorm4x8(glm::fract(Frame.Skinned[i])) : 0u;
+	}
+
+	void submit(void * Data, glm::uint32, glm::uint32)
+	{
+		++static_cast<frame *>(Data)->Submitted;
+	}
+
+	// The stages of a frame wait for each other through counters, the submission runs on the main thread
+	void run_frame(JobSystem & Jobs, frame & Frame)
+	{
+		JobCounter Culled, Skinned, Built, Submitted;
+		Jobs.parallel_for(cull, &Frame, Count, Grain, &Culled, nullptr, "cull");
+		Jobs.parallel_for(skin, &Frame, Count, Grain, &Skinned, &Culled, "skin");
+		Jobs.parallel_for(build, &Frame, Count, Grain, &Built, &Skinned, "build");
+		Jobs.run(submit, &Frame, &Submitted, &Built, JOB_AFFINITY::MAIN_THREAD, "submit");
+		Jobs.wait(Submitted);
+	}
+
+	void empty(void *, glm::uint32, glm::uint32)
+	{}
+
+	int bench_frame(unsigned ThreadCount, frame & Frame)
+	{
+		JobSystem Jobs(ThreadCount);
+
+		Frame.Submitted = 0;
+		char Name[64];
+		std::snprintf(Name, sizeof(Name), "frame, %u thread(s)", ThreadCount);
+		bench::report(Name, bench::time([&]
+		{
+			run_frame(Jobs, Frame);
+		}), Count);
+
+		// 1 warm up and 5 timed frames
+		int Error = Frame.Submitted == 6 ? 0 : 1;
+
+		Jobs.begin_timeline();
+		run_frame(Jobs, Frame);
+		Jobs.end_timeline();
+		for(unsigned t = 0; t < Jobs.thread_count(); ++t)
+			std::printf("\t\tthread %u utilization %.0f%%\n", t, Jobs.utilization(t) * 100.0);
+
+		// Cost of a job: spawning, running and signalling jobs without work, in batches that fit the
+		// job pool so that no job is allocated on the heap
+		glm::uint32 const BatchCount = 25;
+		glm::uint32 const BatchSize = JobSystem::JOB_POOL_SIZE;
+		std::snprintf(Name, sizeof(Name), "empty jobs, %u thread(s)", ThreadCount);
+		bench::report(Name, bench::time([&]
+		{
+			for(glm::uint32 b = 0; b < BatchCount; ++b)
+			{
+				JobCounter Counter;
+				for(glm::uint32 i = 0; i < BatchSize; ++i)
+					Jobs.run(empty, nullptr, &Counter);
+				Jobs.wait(Counter);
+			}
+		}), BatchCount * BatchSize);
+
+		return Error;
+	}
+}//namespace
+
+int bench_common_job_system()
+{
+	int Error = 0;
+
+	frame Frame;
+	std::mt19937 Generator(1);
+	std::uniform_real_distribution<float> Value(-10.0f, 10.0f);
+	std::uniform_int_distribution<glm::uint32> Bone(0, BoneCount - 1);
+	Frame.Positions.resize(Count);
+	Frame.Bones.resize(Count);
+	for(glm::uint32 i = 0; i < Count; ++i)
+	{
+		Frame.Positions[i] = glm::vec4(Value(Generator), Value(Generator), Value(Generator), 1.0f);
+		Frame.Bones[i] = Bone(Generator);
+	}
+	Frame.Palette.resize(BoneCount);
+	for(glm::uint32 i = 0; i < BoneCount; ++i)
+		Frame.Palette[i] = glm::mat4(glm::vec4(1, 0, 0, 0), glm::vec4(0, 1, 0, 0), glm::vec4(0, 0, 1, 0), glm::vec4(Value(Generator), Value(Generator), Value(Generator), 1.0f));
+	Frame.Plane = glm::vec4(glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)), 1.0f);
+	Frame.Visible.resize(Count);
+	Frame.Skinned.resize(Count);
+	Frame.Commands.resize(Count);
+
+	Error += bench_frame(1, Frame);
+	std::vector<glm::uint32> const Expected(Frame.Commands);
+
+	// Powers of two then the number of hardware threads, at least 2 to compare with a single thread
+	unsigned const HardwareThreads = std::max(std::thread::hardware_concurrency(), 2u);
+	std::vector<unsigned> ThreadCounts;
+	for(unsigned ThreadCount = 2; ThreadCount < HardwareThreads; ThreadCount *= 2)
+		ThreadCounts.push_back(ThreadCount);
+	ThreadCounts.push_back(HardwareThreads);
+
+	for(std::size_t t = 0; t < ThreadCounts.size(); ++t)
+	{
+		std::fill(Frame.Commands.begin(), Frame.Commands.end(), 0u);
+		Error += bench_frame(ThreadCounts[t], Frame);
+		Error += Frame.Commands == Expected ? 0 : 1;
+	}
+
+	return Error;
+}
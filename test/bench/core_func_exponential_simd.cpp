@@ -0,0 +1,131 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/gtx/exponential_batch.hpp>
+#include <glm/gtx/fast_square_root.hpp>
+#include "bench.hpp"
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// The exponential functions of aligned_mediump vec4 and the batch functions against the standard library
+// on 4M floats, and inversesqrt against fastInverseSqrt.
+namespace
+{
+	std::size_t const Count = 1 << 22;
+
+	typedef std::vector<glm::aligned_mediump_vec4> aligned_vector;
+
+	std::vector<float> random_floats(float Min, float Max, unsigned Seed)
+	{
+		std::mt19937 Generator(Seed);
+		std::uniform_real_distribution<float> Value(Min, Max);
+		std::vector<float> Result(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = Value(Generator);
+		return Result;
+	}
+
+	// The batch and the aligned_mediump vec4 functions share their kernels, results are bit identical
+	int same(std::vector<float> const & Batch, aligned_vector const & Vector)
+	{
+		return std::memcmp(&Batch[0], &Vector[0], Count * sizeof(float)) == 0 ? 0 : 1;
+	}
+
+	template <typename scalarType, typename vectorType, typename batchType>
+	int compare(char const * Name, std::vector<float> const & In, scalarType const & Scalar, vectorType const & Vector, batchType const & Batch)
+	{
+		std::vector<float> Expected(Count);
+		std::vector<float> BatchResult(Count);
+		aligned_vector const AlignedIn(reinterpret_cast<glm::vec4 const *>(&In[0]), reinterpret_cast<glm::vec4 const *>(&In[0]) + Count / 4);
+		aligned_vector VectorResult(Count / 4);
+
+		char Label[64];
+		std::snprintf(Label, sizeof(Label), "%s float", Name);
+		bench::report(Label, bench::time([&]
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Expected[i] = Scalar(In[i]);
+		}), Count);
+		std::snprintf(Label, sizeof(Label), "%s aligned_mediump_vec4", Name);
+		bench::report(Label, bench::time([&]
+		{
+			for(std::size_t i = 0; i < Count / 4; ++i)
+				VectorResult[i] = Vector(AlignedIn[i]);
+		}), Count);
+		std::snprintf(Label, sizeof(Label), "%sBatch", Name);
+		bench::report(Label, bench::time([&]
+		{
+			Batch(Count, &In[0], &BatchResult[0]);
+		}), Count);
+
+		double MaxError = 0.0;
+		for(std::size_t i = 0; i < Count; ++i)
+			MaxError = glm::max(MaxError, std::abs(static_cast<double>(BatchResult[i]) - Expected[i]) / std::abs(static_cast<double>(Expected[i])));
+		std::printf("\t%-48s %10.3g\n", "maximum relative error", MaxError);
+
+		return same(BatchResult, VectorResult);
+	}
+}//namespace
+
+int bench_core_func_exponential_simd()
+{
+	int Error = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		std::printf("\tAVX2 kernels\n");
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+		std::printf("\tSSE2 kernels\n");
+#	else
+		std::printf("\tStandard library\n");
+#	endif
+
+	std::vector<float> const Exponents = random_floats(-80.0f, 80.0f, 1);
+	std::vector<float> const Positives = random_floats(1e-3f, 1e6f, 2);
+	std::vector<float> const Colors = random_floats(0.0f, 1.0f, 3);
+
+	Error += compare("exp", Exponents,
+		[](float x) { return std::exp(x); },
+		[](glm::aligned_mediump_vec4 const & x) { return glm::exp(x); },
+		[](std::size_t n, float const * x, float * y) { glm::expBatch(n, x, y); });
+	Error += compare("exp2", Exponents,
+		[](float x) { return std::exp2(x); },
+		[](glm::aligned_mediump_vec4 const & x) { return glm::exp2(x); },
+		[](std::size_t n, float const * x, float * y) { glm::exp2Batch(n, x, y); });
+	Error += compare("log", Positives,
+		[](float x) { return std::log(x); },
+		[](glm::aligned_mediump_vec4 const & x) { return glm::log(x); },
+		[](std::size_t n, float const * x, float * y) { glm::logBatch(n, x, y); });
+	Error += compare("log2", Positives,
+		[](float x) { return std::log2(x); },
+		[](glm::aligned_mediump_vec4 const & x) { return glm::log2(x); },
+		[](std::size_t n, float const * x, float * y) { glm::log2Batch(n, x, y); });
+	// The gamma of sRGB
+	Error += compare("pow", Colors,
+		[](float x) { return std::pow(x, 1.0f / 2.4f); },
+		[](glm::aligned_mediump_vec4 const & x) { return glm::pow(x, glm::aligned_mediump_vec4(1.0f / 2.4f)); },
+		[](std::size_t n, float const * x, float * y) { glm::powBatch(n, x, 1.0f / 2.4f, y); });
+	Error += compare("inversesqrt", Positives,
+		[](float x) { return 1.0f / std::sqrt(x); },
+		[](glm::aligned_mediump_vec4 const & x) { return glm::inversesqrt(x); },
+		[](std::size_t n, float const * x, float * y) { glm::inversesqrtBatch(n, x, y); });
+
+	std::vector<glm::vec4> Fast(Count / 4);
+	glm::vec4 const * const Packed = reinterpret_cast<glm::vec4 const *>(&Positives[0]);
+	bench::report("fastInverseSqrt vec4", bench::time([&]
+	{
+		for(std::size_t i = 0; i < Count / 4; ++i)
+			Fast[i] = glm::fastInverseSqrt(Packed[i]);
+	}), Count);
+
+	double MaxError = 0.0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		double const Exact = 1.0 / std::sqrt(static_cast<double>(Positives[i]));
+		MaxError = glm::max(MaxError, std::abs(static_cast<double>(Fast[i / 4][i % 4]) - Exact) / Exact);
+	}
+	std::printf("\t%-48s %10.3g\n", "maximum relative error", MaxError);
+
+	return Error;
+}
@@ -0,0 +1,230 @@
+#include <glm/glm.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include "bench.hpp"
+#include <random>
+#include <vector>
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	if GLM_COMPILER & GLM_COMPILER_VC
+#		include <intrin.h>
+#	else
+#		include <x86intrin.h>
+#	endif
+#endif
+
+// Cycles per operation of mat4 * mat4, mat4 * vec4, mix and dot: the generic code of packed types, the
+// SSE2 kernels of multiply and add the FMA3 and AVX kernels replaced, and the kernels of the aligned types.
+// 256 passes over 1024 operands that stay in the caches, each pass takes the results of the previous one
+// so that the passes can't be merged. Cycles are counted with the time stamp counter.
+// Build with GLM_TEST_ENABLE_SIMD_AVX2 for the FMA3 and AVX kernels.
+namespace
+{
+	std::size_t const Count = 1 << 10;
+	int const Passes = 256;
+
+	typedef glm::tmat4x4<float, glm::aligned_highp> aligned_mat4;
+
+	// Best of 5 runs in time stamp counter cycles per operation
+	template <typename funcType>
+	void report(char const * Name, funcType const & Func)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			Func();
+			unsigned long long Best = 0;
+			for(int i = 0; i < 5; ++i)
+			{
+				unsigned long long const Begin = __rdtsc();
+				Func();
+				unsigned long long const Cycles = __rdtsc() - Begin;
+				Best = i == 0 || Cycles < Best ? Cycles : Best;
+			}
+			std::printf("\t%-48s %10.2f cycles\n", Name, static_cast<double>(Best) / static_cast<double>(Count * Passes));
+#		else
+			bench::report(Name, bench::time(Func), Count * Passes);
+#		endif
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		// glm_mat4_mul_vec4 before FMA3: 4 broadcasts, 4 multiplies and 3 adds
+		glm_vec4 sse2_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
+		{
+			__m128 const m0 = _mm_mul_ps(m[0], _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+			__m128 const m1 = _mm_mul_ps(m[1], _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+			__m128 const m2 = _mm_mul_ps(m[2], _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)));
+			__m128 const m3 = _mm_mul_ps(m[3], _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+			return _mm_add_ps(_mm_add_ps(m0, m1), _mm_add_ps(m2, m3));
+		}
+
+		// glm_mat4_mul before AVX: one column of the result at a time
+		void sse2_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+		{
+			for(int i = 0; i < 4; ++i)
+				out[i] = sse2_mat4_mul_vec4(in1, in2[i]);
+		}
+
+		glm_vec4 const (&columns(aligned_mat4 const & m))[4]
+		{
+			return *reinterpret_cast<glm_vec4 const(*)[4]>(&m[0].data);
+		}
+#	endif
+
+	// Rotations, so that the chained products neither overflow nor underflow
+	std::vector<glm::mat4> random_rotations(std::mt19937 & Generator)
+	{
+		std::uniform_real_distribution<float> Value(-1.0f, 1.0f);
+		std::vector<glm::mat4> Result(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = glm::mat4_cast(glm::normalize(glm::quat(Value(Generator), Value(Generator), Value(Generator), Value(Generator))));
+		return Result;
+	}
+
+	template <typename vecType>
+	std::vector<vecType> random_vec4(std::mt19937 & Generator)
+	{
+		std::uniform_real_distribution<float> Value(-1.0f, 1.0f);
+		std::vector<vecType> Result(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = vecType(Value(Generator), Value(Generator), Value(Generator), Value(Generator));
+		return Result;
+	}
+
+	// Results may differ by the roundings of the fused and unfused sums
+	bool close(glm::vec4 const & a, glm::vec4 const & b)
+	{
+		return glm::all(glm::lessThanEqual(glm::abs(a - b), glm::vec4(1e-4f)));
+	}
+}//namespace
+
+int bench_core_func_matrix_simd()
+{
+	int Error = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT && GLM_HAS_FMA
+		std::printf("\tAVX and FMA3 kernels\n");
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+		std::printf("\tAVX kernels\n");
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+		std::printf("\tSSE2 kernels\n");
+#	else
+		std::printf("\tGeneric code only\n");
+#	endif
+
+	std::mt19937 Generator(1);
+	std::vector<glm::mat4> const A = random_rotations(Generator);
+	std::vector<glm::mat4> const B = random_rotations(Generator);
+	std::vector<aligned_mat4> const AlignedA(A.begin(), A.end());
+	std::vector<glm::vec4> const V = random_vec4<glm::vec4>(Generator);
+	std::vector<glm::vec4> const W = random_vec4<glm::vec4>(Generator);
+	std::vector<glm::aligned_vec4> const AlignedV(V.begin(), V.end());
+	std::vector<glm::aligned_vec4> const AlignedW(W.begin(), W.end());
+
+	std::vector<glm::mat4> Matrices;
+	std::vector<aligned_mat4> AlignedMatrices;
+	report("mat4 * mat4, generic", [&]
+	{
+		Matrices = B;
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			Matrices[i] = A[i] * Matrices[i];
+	});
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		report("mat4 * mat4, SSE2 multiply and add", [&]
+		{
+			AlignedMatrices.assign(B.begin(), B.end());
+			for(int p = 0; p < Passes; ++p)
+			for(std::size_t i = 0; i < Count; ++i)
+				sse2_mat4_mul(columns(AlignedA[i]), columns(AlignedMatrices[i]), *reinterpret_cast<glm_vec4(*)[4]>(&AlignedMatrices[i][0].data));
+		});
+		for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t c = 0; c < 4; ++c)
+			Error += close(AlignedMatrices[i][c], Matrices[i][c]) ? 0 : 1;
+#	endif
+	report("mat4 * mat4, aligned", [&]
+	{
+		AlignedMatrices.assign(B.begin(), B.end());
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedMatrices[i] = AlignedA[i] * AlignedMatrices[i];
+	});
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < 4; ++c)
+		Error += close(AlignedMatrices[i][c], Matrices[i][c]) ? 0 : 1;
+
+	std::vector<glm::vec4> Vectors;
+	std::vector<glm::aligned_vec4> AlignedVectors;
+	report("mat4 * vec4, generic", [&]
+	{
+		Vectors = V;
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			Vectors[i] = A[i] * Vectors[i];
+	});
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		report("mat4 * vec4, SSE2 multiply and add", [&]
+		{
+			AlignedVectors = AlignedV;
+			for(int p = 0; p < Passes; ++p)
+			for(std::size_t i = 0; i < Count; ++i)
+				AlignedVectors[i].data = sse2_mat4_mul_vec4(columns(AlignedA[i]), AlignedVectors[i].data);
+		});
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += close(AlignedVectors[i], Vectors[i]) ? 0 : 1;
+#	endif
+	report("mat4 * vec4, aligned", [&]
+	{
+		AlignedVectors = AlignedV;
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedVectors[i] = AlignedA[i] * AlignedVectors[i];
+	});
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += close(AlignedVectors[i], Vectors[i]) ? 0 : 1;
+
+	report("mix, generic", [&]
+	{
+		Vectors = V;
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			Vectors[i] = glm::mix(Vectors[i], W[i], glm::abs(V[i]));
+	});
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		report("mix, glm_vec4_mix", [&]
+		{
+			AlignedVectors = AlignedV;
+			for(int p = 0; p < Passes; ++p)
+			for(std::size_t i = 0; i < Count; ++i)
+				AlignedVectors[i].data = glm_vec4_mix(AlignedVectors[i].data, AlignedW[i].data, glm_vec4_abs(AlignedV[i].data));
+		});
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += close(AlignedVectors[i], Vectors[i]) ? 0 : 1;
+#	endif
+	report("mix, aligned", [&]
+	{
+		AlignedVectors = AlignedV;
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedVectors[i] = glm::mix(AlignedVectors[i], AlignedW[i], glm::abs(AlignedV[i]));
+	});
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += close(AlignedVectors[i], Vectors[i]) ? 0 : 1;
+
+	// A horizontal sum, the same kernel before and after FMA3. Each pass pairs other vectors.
+	std::vector<float> Dots(Count);
+	std::vector<float> AlignedDots(Count);
+	report("dot, generic", [&]
+	{
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			Dots[i] = glm::dot(V[(i + p) % Count], W[i]);
+	});
+	report("dot, aligned", [&]
+	{
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedDots[i] = glm::dot(AlignedV[(i + p) % Count], AlignedW[i]);
+	});
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::abs(AlignedDots[i] - Dots[i]) <= 1e-5f ? 0 : 1;
+
+	return Error;
+}
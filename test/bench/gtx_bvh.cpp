@@ -0,0 +1,187 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/bvh.hpp>
+#include <glm/gtx/intersect.hpp>
+#include "bench.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Rays per second of a hierarchy over a 262K triangles terrain: coherent primary rays of a 512x512 camera
+// and incoherent ambient occlusion rays, one at a time and in packets of 4 and 8.
+// Build with GLM_TEST_ENABLE_SIMD_AVX2 for the 8 wide packet traversal.
+namespace
+{
+	int const GridSize = 362;
+	int const Resolution = 512;
+	std::size_t const RayCount = Resolution * Resolution;
+
+	struct rays
+	{
+		std::vector<glm::vec3> Origins;
+		std::vector<glm::vec3> Directions;
+	};
+
+	// Closest hits of each ray by traversing one ray at a time, returns the number of rays hitting a triangle
+	std::size_t trace_single(glm::bvh const & Bvh, rays const & Rays, std::vector<glm::uint32> & Triangles)
+	{
+		std::size_t Hits = 0;
+		for(std::size_t r = 0; r < Rays.Origins.size(); ++r)
+		{
+			glm::bvh_hit Hit;
+			Hits += Bvh.intersect(Rays.Origins[r], Rays.Directions[r], 1e30f, Hit) ? 1 : 0;
+			Triangles[r] = Hit.triangle;
+		}
+		return Hits;
+	}
+
+	template <glm::length_t L>
+	void trace_packets(glm::bvh const & Bvh, rays const & Rays, std::vector<glm::uint32> & Triangles)
+	{
+		for(std::size_t r = 0; r < Rays.Origins.size(); r += L)
+		{
+			glm::bvh_ray_packet<L> Packet;
+			for(glm::length_t l = 0; l < L; ++l)
+			{
+				Packet.origX[l] = Rays.Origins[r + l].x;
+				Packet.origY[l] = Rays.Origins[r + l].y;
+				Packet.origZ[l] = Rays.Origins[r + l].z;
+				Packet.dirX[l] = Rays.Directions[r + l].x;
+				Packet.dirY[l] = Rays.Directions[r + l].y;
+				Packet.dirZ[l] = Rays.Directions[r + l].z;
+				Packet.tmax[l] = 1e30f;
+			}
+
+			glm::bvh_hit_packet<L> Hits;
+			Bvh.intersect(Packet, Hits);
+			for(glm::length_t l = 0; l < L; ++l)
+				Triangles[r + l] = Hits.triangle[l];
+		}
+	}
+
+	// Ties between triangles hit at the same distance are rare enough to ignore
+	std::size_t mismatches(std::vector<glm::uint32> const & a, std::vector<glm::uint32> const & b)
+	{
+		std::size_t Count = 0;
+		for(std::size_t i = 0; i < a.size(); ++i)
+			Count += a[i] == b[i] ? 0 : 1;
+		return Count;
+	}
+
+	int bench_rays(char const * Name, glm::bvh const & Bvh, rays const & Rays)
+	{
+		std::vector<glm::uint32> Single(Rays.Origins.size());
+		std::vector<glm::uint32> Packet4(Rays.Origins.size());
+		std::vector<glm::uint32> Packet8(Rays.Origins.size());
+
+		std::size_t Hits = 0;
+		char Label[64];
+		std::snprintf(Label, sizeof(Label), "%s, single rays", Name);
+		bench::report(Label, bench::time([&]
+		{
+			Hits = trace_single(Bvh, Rays, Single);
+		}), Rays.Origins.size());
+		std::snprintf(Label, sizeof(Label), "%s, 4 ray packets", Name);
+		bench::report(Label, bench::time([&]
+		{
+			trace_packets<4>(Bvh, Rays, Packet4);
+		}), Rays.Origins.size());
+		std::snprintf(Label, sizeof(Label), "%s, 8 ray packets", Name);
+		bench::report(Label, bench::time([&]
+		{
+			trace_packets<8>(Bvh, Rays, Packet8);
+		}), Rays.Origins.size());
+		std::printf("\t\t%.1f%% of the rays hit a triangle\n", 100.0 * static_cast<double>(Hits) / static_cast<double>(Rays.Origins.size()));
+
+		return mismatches(Single, Packet4) + mismatches(Single, Packet8) < Rays.Origins.size() / 1000 ? 0 : 1;
+	}
+}//namespace
+
+int bench_gtx_bvh()
+{
+	int Error = 0;
+
+	// Rolling terrain, each cell of the grid split in two triangles
+	std::vector<glm::vec3> Positions;
+	for(int y = 0; y <= GridSize; ++y)
+	for(int x = 0; x <= GridSize; ++x)
+	{
+		glm::vec2 const Coord = glm::vec2(x, y) / static_cast<float>(GridSize) * 20.0f - 10.0f;
+		Positions.push_back(glm::vec3(Coord, std::sin(Coord.x * 1.3f) * std::cos(Coord.y * 0.7f) + 0.3f * std::sin(Coord.x * Coord.y)));
+	}
+	std::vector<glm::uint32> Indices;
+	for(int y = 0; y < GridSize; ++y)
+	for(int x = 0; x < GridSize; ++x)
+	{
+		glm::uint32 const i = static_cast<glm::uint32>(y * (GridSize + 1) + x);
+		glm::uint32 const Quad[6] = {i, i + 1, i + GridSize + 2, i, i + GridSize + 2, i + GridSize + 1};
+		Indices.insert(Indices.end(), Quad, Quad + 6);
+	}
+	std::size_t const TriangleCount = Indices.size() / 3;
+
+	glm::bvh Bvh;
+	std::printf("\t%-48s %10.3f ms\n", "build", bench::time([&]
+	{
+		Bvh.build(&Positions[0], &Indices[0], TriangleCount);
+	}, 1));
+	std::printf("\t\t%u triangles, %u nodes, depth %u\n", static_cast<unsigned>(TriangleCount), static_cast<unsigned>(Bvh.nodes().size()), static_cast<unsigned>(Bvh.depth()));
+
+	// Camera looking down at the terrain, neighbour pixels go to the same packet
+	rays Primary;
+	for(int y = 0; y < Resolution; ++y)
+	for(int x = 0; x < Resolution; ++x)
+	{
+		glm::vec2 const Pixel = (glm::vec2(x, y) + 0.5f) / static_cast<float>(Resolution) * 2.0f - 1.0f;
+		Primary.Origins.push_back(glm::vec3(0.0f, -14.0f, 8.0f));
+		Primary.Directions.push_back(glm::normalize(glm::vec3(Pixel.x * 0.6f, 1.0f, Pixel.y * 0.6f - 0.6f)));
+	}
+	Error += bench_rays("primary", Bvh, Primary);
+
+	// Ambient occlusion rays from points on the terrain, in random directions of the upper hemisphere
+	std::mt19937 Generator(1);
+	std::uniform_real_distribution<float> Coord(-10.0f, 10.0f);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	rays Incoherent;
+	for(std::size_t r = 0; r < RayCount; ++r)
+	{
+		glm::vec3 Orig(Coord(Generator), Coord(Generator), 5.0f);
+		glm::bvh_hit Hit;
+		Bvh.intersect(Orig, glm::vec3(0.0f, 0.0f, -1.0f), 1e30f, Hit);
+		Orig.z -= Hit.distance - 1e-3f;
+		glm::vec3 const Dir = glm::normalize(glm::vec3(Unit(Generator), Unit(Generator), glm::abs(Unit(Generator)) + 0.01f));
+		Incoherent.Origins.push_back(Orig);
+		Incoherent.Directions.push_back(Dir);
+	}
+	Error += bench_rays("ambient occlusion", Bvh, Incoherent);
+
+	// Testing every triangle with intersectRayTriangle, on a few rays only
+	std::size_t const BruteCount = 64;
+	std::vector<glm::uint32> Brute(BruteCount);
+	double const BruteTime = bench::time([&]
+	{
+		for(std::size_t r = 0; r < BruteCount; ++r)
+		{
+			float Closest = 1e30f;
+			Brute[r] = glm::bvh::invalid;
+			for(std::size_t t = 0; t < TriangleCount; ++t)
+			{
+				glm::vec2 Barycentric;
+				float Distance = 0.0f;
+				if(glm::intersectRayTriangle(Incoherent.Origins[r], Incoherent.Directions[r], Positions[Indices[t * 3 + 0]], Positions[Indices[t * 3 + 1]], Positions[Indices[t * 3 + 2]], Barycentric, Distance) && Distance > 0.0f && Distance < Closest)
+				{
+					Closest = Distance;
+					Brute[r] = static_cast<glm::uint32>(t);
+				}
+			}
+		}
+	}, 1);
+	std::printf("\t%-48s %10.3f ms per ray\n", "ambient occlusion, intersectRayTriangle", BruteTime / static_cast<double>(BruteCount));
+
+	for(std::size_t r = 0; r < BruteCount; ++r)
+	{
+		glm::bvh_hit Hit;
+		Bvh.intersect(Incoherent.Origins[r], Incoherent.Directions[r], 1e30f, Hit);
+		Error += Hit.triangle == Brute[r] ? 0 : 1;
+	}
+
+	return Error;
+}
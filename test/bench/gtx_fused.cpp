@@ -0,0 +1,145 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/fused.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include "bench.hpp"
+#include <random>
+#include <vector>
+
+// fused() expressions against the regular operators of packed and aligned vec4: Euler integration,
+// a cubic polynomial evaluated with Horner's scheme and a sum of two products, 256 passes over 4096
+// vectors that stay in the caches. The integration takes the results of the previous pass, the other
+// functions pair other vectors at each pass, so that the passes can't be merged.
+// Build with GLM_TEST_ENABLE_SIMD_AVX2 for the FMA instructions.
+namespace
+{
+	std::size_t const Count = 1 << 12;
+	std::size_t const Mask = Count - 1;
+	int const Passes = 256;
+	float const DeltaTime = 1.0f / 1024.0f;
+
+	template <typename vecType>
+	std::vector<vecType> random_vec4(std::mt19937 & Generator)
+	{
+		std::uniform_real_distribution<float> Value(-1.0f, 1.0f);
+		std::vector<vecType> Result(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = vecType(Value(Generator), Value(Generator), Value(Generator), Value(Generator));
+		return Result;
+	}
+
+	// Fused and unfused results differ by the rounding of the products
+	template <typename vecType>
+	int mismatches(std::vector<glm::vec4> const & Expected, std::vector<vecType> const & Result)
+	{
+		int Error = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::lessThanEqual(glm::abs(glm::vec4(Result[i]) - Expected[i]), glm::vec4(1e-4f))) ? 0 : 1;
+		return Error;
+	}
+}//namespace
+
+int bench_gtx_fused()
+{
+	int Error = 0;
+
+#	if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_FMA
+		std::printf("\tFMA3 kernels\n");
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+		std::printf("\tSSE2 multiply and add\n");
+#	else
+		std::printf("\tGeneric code only\n");
+#	endif
+
+	std::mt19937 Generator(1);
+	std::vector<glm::vec4> const P = random_vec4<glm::vec4>(Generator);
+	std::vector<glm::vec4> const V = random_vec4<glm::vec4>(Generator);
+	std::vector<glm::vec4> const W = random_vec4<glm::vec4>(Generator);
+	std::vector<glm::aligned_vec4> const AlignedP(P.begin(), P.end());
+	std::vector<glm::aligned_vec4> const AlignedV(V.begin(), V.end());
+	std::vector<glm::aligned_vec4> const AlignedW(W.begin(), W.end());
+
+	// Each pass integrates the positions of the previous one
+	std::vector<glm::vec4> Positions;
+	std::vector<glm::aligned_vec4> AlignedPositions;
+	bench::report("p + v * dt, vec4", bench::time([&]
+	{
+		Positions = P;
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			Positions[i] = Positions[i] + V[i] * DeltaTime;
+	}), Count * Passes);
+	bench::report("p + v * dt, aligned_vec4", bench::time([&]
+	{
+		AlignedPositions = AlignedP;
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedPositions[i] = AlignedPositions[i] + AlignedV[i] * DeltaTime;
+	}), Count * Passes);
+	Error += mismatches(Positions, AlignedPositions);
+	bench::report("p + v * dt, fused() aligned_vec4", bench::time([&]
+	{
+		AlignedPositions = AlignedP;
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedPositions[i] = glm::fused(AlignedPositions[i]) + glm::fused(AlignedV[i]) * DeltaTime;
+	}), Count * Passes);
+	Error += mismatches(Positions, AlignedPositions);
+	bench::report("p + v * dt, fusedBatch aligned_vec4", bench::time([&]
+	{
+		AlignedPositions = AlignedP;
+		for(int p = 0; p < Passes; ++p)
+			glm::fusedBatch(Count, glm::fused(&AlignedPositions[0]) + glm::fused(&AlignedV[0]) * DeltaTime, &AlignedPositions[0]);
+	}), Count * Passes);
+	Error += mismatches(Positions, AlignedPositions);
+
+	// ((c3 * x + c2) * x + c1) * x + c0, 3 multiply-adds of which each depends on the previous one
+	float const C[4] = {0.5f, -0.25f, 0.125f, 1.0f};
+	std::vector<glm::vec4> Polynomial(Count);
+	std::vector<glm::aligned_vec4> AlignedPolynomial(Count);
+	bench::report("cubic polynomial, vec4", bench::time([&]
+	{
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			Polynomial[i] = ((V[(i + p) & Mask] * C[0] + C[1]) * V[(i + p) & Mask] + C[2]) * V[(i + p) & Mask] + C[3];
+	}), Count * Passes);
+	bench::report("cubic polynomial, aligned_vec4", bench::time([&]
+	{
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedPolynomial[i] = ((AlignedV[(i + p) & Mask] * C[0] + C[1]) * AlignedV[(i + p) & Mask] + C[2]) * AlignedV[(i + p) & Mask] + C[3];
+	}), Count * Passes);
+	Error += mismatches(Polynomial, AlignedPolynomial);
+	bench::report("cubic polynomial, fused() aligned_vec4", bench::time([&]
+	{
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedPolynomial[i] = ((glm::fused(AlignedV[(i + p) & Mask]) * C[0] + C[1]) * AlignedV[(i + p) & Mask] + C[2]) * AlignedV[(i + p) & Mask] + C[3];
+	}), Count * Passes);
+	Error += mismatches(Polynomial, AlignedPolynomial);
+
+	// v * w + p * dt, one multiply-add and a multiply
+	std::vector<glm::vec4> Sums(Count);
+	std::vector<glm::aligned_vec4> AlignedSums(Count);
+	bench::report("v * w + p * dt, vec4", bench::time([&]
+	{
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			Sums[i] = V[(i + p) & Mask] * W[i] + P[i] * DeltaTime;
+	}), Count * Passes);
+	bench::report("v * w + p * dt, aligned_vec4", bench::time([&]
+	{
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedSums[i] = AlignedV[(i + p) & Mask] * AlignedW[i] + AlignedP[i] * DeltaTime;
+	}), Count * Passes);
+	Error += mismatches(Sums, AlignedSums);
+	bench::report("v * w + p * dt, fused() aligned_vec4", bench::time([&]
+	{
+		for(int p = 0; p < Passes; ++p)
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedSums[i] = glm::fused(AlignedV[(i + p) & Mask]) * AlignedW[i] + glm::fused(AlignedP[i]) * DeltaTime;
+	}), Count * Passes);
+	Error += mismatches(Sums, AlignedSums);
+
+	return Error;
+}
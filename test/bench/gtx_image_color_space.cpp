@@ -0,0 +1,129 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/image_color_space.hpp>
+#include "bench.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+// The batch conversions against gtc_color_space, which calls pow per component, on a 2048 x 2048 image
+namespace
+{
+	std::size_t const Width = 2048;
+	std::size_t const Height = 2048;
+	std::size_t const Count = Width * Height;
+
+	glm::parallel_options serial_options()
+	{
+		glm::parallel_options Options;
+		Options.threadCount = 1;
+		return Options;
+	}
+
+	glm::parallel_options const Serial = serial_options();
+
+	// gtc_color_space uses 0.41666 for 1 / 2.4
+	bool close(glm::vec4 const & a, glm::vec4 const & b)
+	{
+		return glm::all(glm::lessThanEqual(glm::abs(a - b), glm::vec4(1e-4f)));
+	}
+
+	int bench_srgb_to_linear(std::vector<glm::u8vec4> const & SRGB8)
+	{
+		int Error = 0;
+
+		std::vector<glm::vec4> SRGB(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			SRGB[i] = glm::vec4(SRGB8[i]) / 255.0f;
+
+		std::vector<glm::vec4> Expected(Count);
+		std::vector<glm::vec4> Float(Count);
+		std::vector<glm::vec4> Table(Count);
+		std::vector<glm::vec4> Image(Count);
+
+		bench::report("convertSRGBToLinear per pixel", bench::time([&]
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Expected[i] = glm::convertSRGBToLinear(SRGB[i]);
+		}), Count);
+		bench::report("convertSRGBToLinearBatch vec4", bench::time([&]
+		{
+			glm::convertSRGBToLinearBatch(Count, &SRGB[0], &Float[0]);
+		}), Count);
+		bench::report("convertSRGBToLinearBatch u8vec4", bench::time([&]
+		{
+			glm::convertSRGBToLinearBatch(Count, &SRGB8[0], &Table[0]);
+		}), Count);
+		bench::report("convertImageSRGBToLinear RGBA8, 1 thread", bench::time([&]
+		{
+			glm::convertImageSRGBToLinear(Width, Height, glm::IMAGE_FORMAT_RGBA8, &SRGB8[0], Width * 4, glm::IMAGE_FORMAT_RGBA32F, &Image[0], Width * 16, Serial);
+		}), Count);
+		bench::report("convertImageSRGBToLinear RGBA8, all threads", bench::time([&]
+		{
+			glm::convertImageSRGBToLinear(Width, Height, glm::IMAGE_FORMAT_RGBA8, &SRGB8[0], Width * 4, glm::IMAGE_FORMAT_RGBA32F, &Image[0], Width * 16);
+		}), Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += close(Float[i], Expected[i]) ? 0 : 1;
+			Error += close(Table[i], Expected[i]) ? 0 : 1;
+			Error += Image[i] == Table[i] ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int bench_linear_to_srgb(std::vector<glm::u8vec4> const & SRGB8)
+	{
+		int Error = 0;
+
+		std::vector<glm::vec4> Linear(Count);
+		glm::convertSRGBToLinearBatch(Count, &SRGB8[0], &Linear[0]);
+
+		std::vector<glm::vec4> Expected(Count);
+		std::vector<glm::vec4> Float(Count);
+		std::vector<glm::u8vec4> Image(Count);
+
+		bench::report("convertLinearToSRGB per pixel", bench::time([&]
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Expected[i] = glm::convertLinearToSRGB(Linear[i]);
+		}), Count);
+		bench::report("convertLinearToSRGBBatch vec4", bench::time([&]
+		{
+			glm::convertLinearToSRGBBatch(Count, &Linear[0], &Float[0]);
+		}), Count);
+		bench::report("convertImageLinearToSRGB RGBA8, 1 thread", bench::time([&]
+		{
+			glm::convertImageLinearToSRGB(Width, Height, glm::IMAGE_FORMAT_RGBA32F, &Linear[0], Width * 16, glm::IMAGE_FORMAT_RGBA8, &Image[0], Width * 4, Serial);
+		}), Count);
+		bench::report("convertImageLinearToSRGB RGBA8, all threads", bench::time([&]
+		{
+			glm::convertImageLinearToSRGB(Width, Height, glm::IMAGE_FORMAT_RGBA32F, &Linear[0], Width * 16, glm::IMAGE_FORMAT_RGBA8, &Image[0], Width * 4);
+		}), Count);
+
+		// Decoding then encoding sRGB8 is lossless
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += close(Float[i], Expected[i]) ? 0 : 1;
+			Error += Image[i] == SRGB8[i] ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace
+
+int bench_gtx_image_color_space()
+{
+	int Error = 0;
+
+	std::mt19937 Generator(1);
+	std::uniform_int_distribution<int> Value(0, 255);
+	std::vector<glm::u8vec4> SRGB8(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		SRGB8[i] = glm::u8vec4(Value(Generator), Value(Generator), Value(Generator), Value(Generator));
+
+	Error += bench_srgb_to_linear(SRGB8);
+	Error += bench_linear_to_srgb(SRGB8);
+
+	return Error;
+}
@@ -0,0 +1,118 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/mesh_indexing.hpp>
+#include <glm/gtx/hash.hpp>
+#include "bench.hpp"
+#include <cstring>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// Indexing and welding of the V3F_T2F triangle list of a 1024x1024 quads grid, 6M vertices of which 1M
+// are unique, against a std::unordered_map deduplication hashing the vertices with GLM_GTX_hash.
+namespace
+{
+	int const GridSize = 1024;
+
+	// Interleaved layout of Test003
+	struct vertex
+	{
+		glm::vec3 Position;
+		glm::vec2 TexCoord;
+
+		bool operator==(vertex const & v) const
+		{
+			return Position == v.Position && TexCoord == v.TexCoord;
+		}
+	};
+
+	struct vertex_hash
+	{
+		std::size_t operator()(vertex const & v) const
+		{
+			std::size_t Seed = std::hash<glm::vec3>()(v.Position);
+			glm::detail::hash_combine(Seed, std::hash<glm::vec2>()(v.TexCoord));
+			return Seed;
+		}
+	};
+
+	// Two triangles per quad, the vertices shared by neighbour quads are repeated
+	std::vector<vertex> make_grid(float Jitter)
+	{
+		std::mt19937 Generator(1);
+		std::uniform_real_distribution<float> Offset(-Jitter, Jitter);
+
+		std::vector<vertex> Vertices;
+		Vertices.reserve(GridSize * GridSize * 6);
+		for(int y = 0; y < GridSize; ++y)
+		for(int x = 0; x < GridSize; ++x)
+		{
+			glm::ivec2 const Corners[6] = {glm::ivec2(0, 0), glm::ivec2(1, 0), glm::ivec2(1, 1), glm::ivec2(0, 0), glm::ivec2(1, 1), glm::ivec2(0, 1)};
+			for(int c = 0; c < 6; ++c)
+			{
+				glm::vec2 const Coord = glm::vec2(glm::ivec2(x, y) + Corners[c]) / static_cast<float>(GridSize);
+				vertex Vertex;
+				Vertex.Position = glm::vec3(Coord * 100.0f, 0.0f) + glm::vec3(Offset(Generator), Offset(Generator), Offset(Generator));
+				Vertex.TexCoord = Coord;
+				Vertices.push_back(Vertex);
+			}
+		}
+		return Vertices;
+	}
+
+	std::size_t baseline_remap(std::vector<vertex> const & Vertices, std::vector<glm::uint32> & Remap)
+	{
+		std::unordered_map<vertex, glm::uint32, vertex_hash> Table;
+		for(std::size_t i = 0; i < Vertices.size(); ++i)
+			Remap[i] = Table.insert(std::make_pair(Vertices[i], static_cast<glm::uint32>(Table.size()))).first->second;
+		return Table.size();
+	}
+}//namespace
+
+int bench_gtx_mesh_indexing()
+{
+	int Error = 0;
+
+	std::vector<vertex> const Vertices = make_grid(0.0f);
+	std::size_t const Count = Vertices.size();
+	std::size_t const UniqueCount = (GridSize + 1) * (GridSize + 1);
+
+	std::vector<glm::uint32> Expected(Count);
+	std::vector<glm::uint32> Remap(Count);
+	std::size_t BaselineCount = 0;
+	std::size_t RemapCount = 0;
+
+	bench::report("std::unordered_map, GLM_GTX_hash", bench::time([&]
+	{
+		BaselineCount = baseline_remap(Vertices, Expected);
+	}, 3), Count);
+	bench::report("generateVertexRemap", bench::time([&]
+	{
+		RemapCount = glm::generateVertexRemap(Count, &Vertices[0], sizeof(vertex), &Remap[0]);
+	}), Count);
+	Error += BaselineCount == UniqueCount && RemapCount == UniqueCount ? 0 : 1;
+	Error += Remap == Expected ? 0 : 1;
+
+	glm::indexed_mesh Mesh;
+	bench::report("indexVertices", bench::time([&]
+	{
+		glm::indexVertices(Count, &Vertices[0], sizeof(vertex), Mesh);
+	}), Count);
+	Error += Mesh.vertexCount == UniqueCount && Mesh.indexCount == Count && Mesh.indexSize == 4 ? 0 : 1;
+	Error += std::memcmp(&Mesh.indices[0], &Remap[0], Count * sizeof(glm::uint32)) == 0 ? 0 : 1;
+
+	// Shared corners moved by less than the epsilon are only merged by welding
+	float const Epsilon = 1e-3f;
+	std::vector<vertex> const Jittered = make_grid(Epsilon * 0.25f);
+	bench::report("std::unordered_map, jittered vertices", bench::time([&]
+	{
+		BaselineCount = baseline_remap(Jittered, Expected);
+	}, 1), Count);
+	bench::report("generateVertexRemapWeld", bench::time([&]
+	{
+		RemapCount = glm::generateVertexRemapWeld(Count, &Jittered[0], sizeof(vertex), 0, Epsilon, &Remap[0]);
+	}), Count);
+	std::printf("\t\t%u unique vertices without welding, %u with\n", static_cast<unsigned>(BaselineCount), static_cast<unsigned>(RemapCount));
+	Error += BaselineCount == Count && RemapCount == UniqueCount ? 0 : 1;
+
+	return Error;
+}
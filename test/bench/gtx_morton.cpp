@@ -0,0 +1,194 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/morton.hpp>
+#include <glm/gtc/bitfield.hpp>
+#include "bench.hpp"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Bulk Morton codes against bitfieldInterleave, mortonSort against std::sort, and the cost of a
+// vertex normal pass over a shuffled grid mesh before and after reordering its vertices by Morton code.
+namespace
+{
+	std::size_t const Count = 1 << 22;
+
+	int bench_encode()
+	{
+		int Error = 0;
+
+		std::mt19937 Generator(1);
+		std::uniform_int_distribution<glm::uint32> Value(0, (1u << 21) - 1u);
+		std::vector<glm::u32vec3> Coords(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Coords[i] = glm::u32vec3(Value(Generator), Value(Generator), Value(Generator));
+
+		std::vector<glm::uint64> Expected(Count);
+		std::vector<glm::uint64> Codes(Count);
+		std::vector<glm::u32vec3> Decoded(Count);
+
+		bench::report("bitfieldInterleave 3D", bench::time([&]
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Expected[i] = glm::bitfieldInterleave(Coords[i].x, Coords[i].y, Coords[i].z);
+		}), Count);
+		bench::report("mortonEncode 3D", bench::time([&]
+		{
+			glm::mortonEncode(Count, &Coords[0], &Codes[0]);
+		}), Count);
+		bench::report("mortonDecode 3D", bench::time([&]
+		{
+			glm::mortonDecode(Count, &Codes[0], &Decoded[0]);
+		}), Count);
+
+		Error += Codes == Expected ? 0 : 1;
+		Error += Decoded == Coords ? 0 : 1;
+
+		return Error;
+	}
+
+	int bench_sort()
+	{
+		int Error = 0;
+
+		std::mt19937 Generator(2);
+		std::uniform_int_distribution<glm::uint64> Value(0, (static_cast<glm::uint64>(1) << 63) - 1u);
+		std::vector<glm::uint64> Keys(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Keys[i] = Value(Generator);
+
+		std::vector<std::pair<glm::uint64, glm::uint32> > Expected(Count);
+		bench::report("std::stable_sort", bench::time([&]
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Expected[i] = std::make_pair(Keys[i], static_cast<glm::uint32>(i));
+			std::stable_sort(Expected.begin(), Expected.end());
+		}, 3), Count);
+
+		std::vector<glm::uint64> Codes(Count);
+		std::vector<glm::uint32> Order(Count);
+		for(unsigned ThreadCount = 1; ThreadCount <= 4; ThreadCount *= 2)
+		{
+			char Name[64];
+			glm::parallel_pool Pool(ThreadCount);
+			glm::parallel_options Options;
+			Options.executor = &Pool;
+			std::snprintf(Name, sizeof(Name), "mortonSort 63 bits, %u thread(s)", ThreadCount);
+			bench::report(Name, bench::time([&]
+			{
+				Codes = Keys;
+				glm::mortonSort(Count, &Codes[0], &Order[0], 63, Options);
+			}, 3), Count);
+		}
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Codes[i] == Expected[i].first ? 0 : 1;
+			Error += Order[i] == Expected[i].second ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Accumulate the face normals of each triangle in its vertices, reads and writes follow the index buffer
+	void vertex_normals(std::vector<glm::vec3> const & Positions, std::vector<glm::uint32> const & Indices, std::vector<glm::vec3> & Normals)
+	{
+		std::fill(Normals.begin(), Normals.end(), glm::vec3(0.0f));
+		for(std::size_t i = 0; i < Indices.size(); i += 3)
+		{
+			glm::vec3 const & a = Positions[Indices[i + 0]];
+			glm::vec3 const & b = Positions[Indices[i + 1]];
+			glm::vec3 const & c = Positions[Indices[i + 2]];
+			glm::vec3 const Normal = glm::cross(b - a, c - a);
+			Normals[Indices[i + 0]] += Normal;
+			Normals[Indices[i + 1]] += Normal;
+			Normals[Indices[i + 2]] += Normal;
+		}
+	}
+
+	// Replace each vertex V by Remap[V] in the index buffer and move Positions[V] to Positions[Remap[V]]
+	void remap(std::vector<glm::uint32> const & Remap, std::vector<glm::vec3> & Positions, std::vector<glm::uint32> & Indices)
+	{
+		std::vector<glm::vec3> Moved(Positions.size());
+		for(std::size_t v = 0; v < Positions.size(); ++v)
+			Moved[Remap[v]] = Positions[v];
+		Positions.swap(Moved);
+		for(std::size_t i = 0; i < Indices.size(); ++i)
+			Indices[i] = Remap[Indices[i]];
+	}
+
+	int bench_locality()
+	{
+		int Error = 0;
+
+		// A Side x Side grid mesh, triangles in row order
+		std::size_t const Side = 2048;
+		std::vector<glm::vec3> Positions(Side * Side);
+		for(std::size_t y = 0; y < Side; ++y)
+		for(std::size_t x = 0; x < Side; ++x)
+			Positions[y * Side + x] = glm::vec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>((x ^ y) & 7) * 0.125f);
+
+		std::vector<glm::uint32> Indices;
+		Indices.reserve((Side - 1) * (Side - 1) * 6);
+		for(std::size_t y = 0; y + 1 < Side; ++y)
+		for(std::size_t x = 0; x + 1 < Side; ++x)
+		{
+			glm::uint32 const v = static_cast<glm::uint32>(y * Side + x);
+			glm::uint32 const Quad[] = {v, v + 1, v + static_cast<glm::uint32>(Side), v + 1, v + 1 + static_cast<glm::uint32>(Side), v + static_cast<glm::uint32>(Side)};
+			Indices.insert(Indices.end(), Quad, Quad + 6);
+		}
+
+		// Vertices in random order, as after a careless import
+		std::vector<glm::uint32> Shuffle(Positions.size());
+		std::iota(Shuffle.begin(), Shuffle.end(), 0u);
+		std::shuffle(Shuffle.begin(), Shuffle.end(), std::mt19937(3));
+		remap(Shuffle, Positions, Indices);
+
+		std::vector<glm::vec3> Normals(Positions.size());
+		bench::report("vertex normals, shuffled vertices", bench::time([&]
+		{
+			vertex_normals(Positions, Indices, Normals);
+		}), Indices.size() / 3);
+		std::vector<glm::vec3> ShuffledNormals(Normals);
+
+		std::vector<glm::uint64> Codes(Positions.size());
+		std::vector<glm::uint32> Order(Positions.size());
+		std::vector<glm::vec3> Sorted(Positions.size());
+		bench::report("mortonEncode, mortonSort, mortonReorder", bench::time([&]
+		{
+			glm::mortonEncode(Positions.size(), &Positions[0], glm::vec3(0.0f), glm::vec3(static_cast<float>(Side), static_cast<float>(Side), 1.0f), &Codes[0]);
+			glm::mortonSort(Codes.size(), &Codes[0], &Order[0], 63);
+			glm::mortonReorder(Positions.size(), &Order[0], &Positions[0], &Sorted[0]);
+		}, 3), Positions.size());
+
+		// Order[i] is the vertex moved to i
+		std::vector<glm::uint32> Remap(Positions.size());
+		for(std::size_t i = 0; i < Order.size(); ++i)
+			Remap[Order[i]] = static_cast<glm::uint32>(i);
+		remap(Remap, Positions, Indices);
+		Error += Positions == Sorted ? 0 : 1;
+
+		bench::report("vertex normals, Morton ordered vertices", bench::time([&]
+		{
+			vertex_normals(Positions, Indices, Normals);
+		}), Indices.size() / 3);
+
+		// Same sums in the same order
+		for(std::size_t v = 0; v < Remap.size(); ++v)
+			Error += Normals[Remap[v]] == ShuffledNormals[v] ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+int bench_gtx_morton()
+{
+	int Error = 0;
+
+	Error += bench_encode();
+	Error += bench_sort();
+	Error += bench_locality();
+
+	return Error;
+}
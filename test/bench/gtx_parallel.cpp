@@ -0,0 +1,108 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/parallel.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include "bench.hpp"
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Scaling of the parallel functions on 4M vertices, from 1 thread to the number of hardware threads.
+// Chunks don't depend on the thread count so every thread count gives the same results.
+namespace
+{
+	std::size_t const Count = 1 << 22;
+
+	struct results
+	{
+		std::vector<glm::vec3> Points;
+		std::vector<glm::vec3> Normals;
+		std::vector<glm::uint32> Colors;
+		glm::vec3 Min, Max;
+		glm::dvec3 Sum;
+	};
+
+	void run(unsigned ThreadCount, std::vector<glm::vec3> const & In, std::vector<glm::dvec3> const & Doubles, std::vector<glm::vec4> const & Colors, results & Out)
+	{
+		glm::parallel_pool Pool(ThreadCount);
+		glm::parallel_options Options;
+		Options.executor = &Pool;
+
+		glm::mat4 const Matrix = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, -2.0f, 3.0f)), 0.5f, glm::vec3(0.0f, 1.0f, 0.0f));
+
+		Out.Points.resize(Count);
+		Out.Normals.resize(Count);
+		Out.Colors.resize(Count);
+
+		char Name[64];
+		std::snprintf(Name, sizeof(Name), "parallelTransformPoint, %u thread(s)", ThreadCount);
+		bench::report(Name, bench::time([&]
+		{
+			glm::parallelTransformPoint(Count, Matrix, &In[0], &Out.Points[0], Options);
+		}), Count);
+		std::snprintf(Name, sizeof(Name), "parallelNormalize, %u thread(s)", ThreadCount);
+		bench::report(Name, bench::time([&]
+		{
+			glm::parallelNormalize(Count, &In[0], &Out.Normals[0], Options);
+		}), Count);
+		std::snprintf(Name, sizeof(Name), "parallelBounds, %u thread(s)", ThreadCount);
+		bench::report(Name, bench::time([&]
+		{
+			Out.Min = glm::vec3(std::numeric_limits<float>::max());
+			Out.Max = -Out.Min;
+			glm::parallelBounds(Count, &In[0], Out.Min, Out.Max, Options);
+		}), Count);
+		std::snprintf(Name, sizeof(Name), "parallelSum dvec3, %u thread(s)", ThreadCount);
+		bench::report(Name, bench::time([&]
+		{
+			Out.Sum = glm::parallelSum(Count, &Doubles[0], Options);
+		}), Count);
+		std::snprintf(Name, sizeof(Name), "parallelPackUnorm4x8, %u thread(s)", ThreadCount);
+		bench::report(Name, bench::time([&]
+		{
+			glm::parallelPackUnorm4x8(Count, &Colors[0], &Out.Colors[0], Options);
+		}), Count);
+	}
+}//namespace
+
+int bench_gtx_parallel()
+{
+	int Error = 0;
+
+	std::mt19937 Generator(1);
+	std::uniform_real_distribution<float> Value(-100.0f, 100.0f);
+	std::vector<glm::vec3> In(Count);
+	std::vector<glm::dvec3> Doubles(Count);
+	std::vector<glm::vec4> Colors(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		In[i] = glm::vec3(Value(Generator), Value(Generator), Value(Generator));
+		Doubles[i] = glm::dvec3(In[i]);
+		Colors[i] = glm::vec4(In[i], 50.0f) / 100.0f;
+	}
+
+	results Single;
+	run(1, In, Doubles, Colors, Single);
+
+	// Powers of two then the number of hardware threads, at least 2 to compare with a single thread
+	unsigned const HardwareThreads = std::max(std::thread::hardware_concurrency(), 2u);
+	std::vector<unsigned> ThreadCounts;
+	for(unsigned ThreadCount = 2; ThreadCount < HardwareThreads; ThreadCount *= 2)
+		ThreadCounts.push_back(ThreadCount);
+	ThreadCounts.push_back(HardwareThreads);
+
+	for(std::size_t t = 0; t < ThreadCounts.size(); ++t)
+	{
+		results Multi;
+		run(ThreadCounts[t], In, Doubles, Colors, Multi);
+
+		Error += Multi.Points == Single.Points ? 0 : 1;
+		Error += Multi.Normals == Single.Normals ? 0 : 1;
+		Error += Multi.Colors == Single.Colors ? 0 : 1;
+		Error += Multi.Min == Single.Min && Multi.Max == Single.Max ? 0 : 1;
+		Error += Multi.Sum == Single.Sum ? 0 : 1;
+	}
+
+	return Error;
+}
@@ -0,0 +1,136 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/vertex_batch.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include "bench.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+// The batch kernels against loops of single vector operations on 4M vertices.
+// Build with GLM_TEST_ENABLE_SIMD_AVX512 for the AVX-512 kernels.
+namespace
+{
+	// One more than a multiple of 16 to run the tails
+	std::size_t const Count = (1 << 22) + 1;
+
+	// Results may differ in the last bit between the kernels and the loops
+	bool close(glm::vec3 const & a, glm::vec3 const & b)
+	{
+		return glm::all(glm::lessThanEqual(glm::abs(a - b), glm::max(glm::abs(a), glm::abs(b)) * 1e-5f + 1e-5f));
+	}
+
+	int bench_transform(std::vector<glm::vec3> const & Points, glm::mat4 const & Matrix)
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> Expected(Count);
+		std::vector<glm::vec3> Result(Count);
+
+		bench::report("loop of vec3(Matrix * vec4(p, 1))", bench::time([&]
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Expected[i] = glm::vec3(Matrix * glm::vec4(Points[i], 1.0f));
+		}), Count);
+		bench::report("transformPointBatch", bench::time([&]
+		{
+			glm::transformPointBatch(Count, Matrix, &Points[0], &Result[0]);
+		}), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += close(Result[i], Expected[i]) ? 0 : 1;
+
+		bench::report("loop of vec3(Matrix * vec4(v, 0))", bench::time([&]
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Expected[i] = glm::vec3(Matrix * glm::vec4(Points[i], 0.0f));
+		}), Count);
+		bench::report("transformVectorBatch", bench::time([&]
+		{
+			glm::transformVectorBatch(Count, Matrix, &Points[0], &Result[0]);
+		}), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += close(Result[i], Expected[i]) ? 0 : 1;
+
+		return Error;
+	}
+
+	int bench_normalize(std::vector<glm::vec3> const & Points)
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> Expected(Count);
+		std::vector<glm::vec3> Result(Count);
+
+		bench::report("loop of normalize", bench::time([&]
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Expected[i] = glm::normalize(Points[i]);
+		}), Count);
+		bench::report("normalizeBatch", bench::time([&]
+		{
+			glm::normalizeBatch(Count, &Points[0], &Result[0]);
+		}), Count);
+
+		// Relative error below 2^-21
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::lessThanEqual(glm::abs(Result[i] - Expected[i]), glm::vec3(1e-6f))) ? 0 : 1;
+
+		return Error;
+	}
+
+	int bench_bounds(std::vector<glm::vec3> const & Points)
+	{
+		int Error = 0;
+
+		glm::vec3 ExpectedMin, ExpectedMax, Min, Max;
+		bench::report("loop of min and max", bench::time([&]
+		{
+			ExpectedMin = glm::vec3(std::numeric_limits<float>::max());
+			ExpectedMax = -ExpectedMin;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				ExpectedMin = glm::min(ExpectedMin, Points[i]);
+				ExpectedMax = glm::max(ExpectedMax, Points[i]);
+			}
+		}), Count);
+		bench::report("boundsBatch", bench::time([&]
+		{
+			Min = glm::vec3(std::numeric_limits<float>::max());
+			Max = -Min;
+			glm::boundsBatch(Count, &Points[0], Min, Max);
+		}), Count);
+
+		Error += Min == ExpectedMin ? 0 : 1;
+		Error += Max == ExpectedMax ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+int bench_gtx_vertex_batch()
+{
+	int Error = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		std::printf("\tAVX-512 kernels\n");
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+		std::printf("\tSSE2 kernels\n");
+#	else
+		std::printf("\tScalar kernels\n");
+#	endif
+
+	std::mt19937 Generator(1);
+	std::uniform_real_distribution<float> Value(-100.0f, 100.0f);
+	std::vector<glm::vec3> Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Points[i] = glm::vec3(Value(Generator), Value(Generator), Value(Generator));
+
+	glm::mat4 const Matrix = glm::scale(glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, -2.0f, 3.0f)), 0.5f, glm::vec3(0.0f, 1.0f, 0.0f)), glm::vec3(2.0f));
+
+	Error += bench_transform(Points, Matrix);
+	Error += bench_normalize(Points);
+	Error += bench_bounds(Points);
+
+	return Error;
+}
@@ -0,0 +1,73 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+int bench_common_job_system();
+int bench_core_func_dvec4_simd();
+int bench_core_func_exponential_simd();
+int bench_core_func_integer_simd();
+int bench_core_func_matrix_simd();
+int bench_gtx_bvh();
+int bench_gtx_fused();
+int bench_gtx_image_color_space();
+int bench_gtx_mesh_indexing();
+int bench_gtx_morton();
+int bench_gtx_parallel();
+int bench_gtx_vertex_batch();
+
+namespace
+{
+	struct suite
+	{
+		char const * name;
+		int (*run)();
+	};
+
+	suite const Suites[] =
+	{
+		{"common_job_system", bench_common_job_system},
+		{"core_func_dvec4_simd", bench_core_func_dvec4_simd},
+		{"core_func_exponential_simd", bench_core_func_exponential_simd},
+		{"core_func_integer_simd", bench_core_func_integer_simd},
+		{"core_func_matrix_simd", bench_core_func_matrix_simd},
+		{"gtx_bvh", bench_gtx_bvh},
+		{"gtx_fused", bench_gtx_fused},
+		{"gtx_image_color_space", bench_gtx_image_color_space},
+		{"gtx_mesh_indexing", bench_gtx_mesh_indexing},
+		{"gtx_morton", bench_gtx_morton},
+		{"gtx_parallel", bench_gtx_parallel},
+		{"gtx_vertex_batch", bench_gtx_vertex_batch}
+	};
+}//namespace
+
+// bench-glm runs every benchmark, bench-glm <suite>... runs the named ones.
+// Each benchmark prints its timings and returns the number of results its variants disagree on.
+int main(int argc, char * argv[])
+{
+	int Error = 0;
+	int Selected = 0;
+
+	for(std::size_t i = 0; i < sizeof(Suites) / sizeof(Suites[0]); ++i)
+	{
+		bool Run = argc < 2;
+		for(int a = 1; a < argc; ++a)
+			Run = Run || std::strcmp(argv[a], Suites[i].name) == 0;
+		if(!Run)
+			continue;
+
+		std::printf("%s:\n", Suites[i].name);
+		int const SuiteError = Suites[i].run();
+		std::printf("%s: %d error(s)\n", Suites[i].name, SuiteError);
+		Error += SuiteError;
+		++Selected;
+	}
+
+	if(Selected == 0)
+	{
+		std::printf("Unknown suite\n");
+		return 1;
+	}
+
+	// Exit codes are truncated to 8 bits
+	return Error > 0 ? 1 : 0;
+}
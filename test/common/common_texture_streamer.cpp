@@ -0,0 +1,209 @@
+#include <GL/glew.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <TextureStreamer.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+// TextureStreamer on a surfaceless EGL context, Mesa llvmpipe without a display: the levels read back
+// from the textures match the DDS files, BGRA files are swizzled, mip counts past 1x1 are clamped and
+// headers larger than their file fail the load. Built with GLM_TEST_ENABLE_GL.
+namespace
+{
+	typedef std::vector<std::vector<uint8_t> > levels;
+
+	class gl_context
+	{
+	public:
+		gl_context() :
+			Display(EGL_NO_DISPLAY),
+			Context(EGL_NO_CONTEXT)
+		{}
+
+		~gl_context()
+		{
+			if(Context != EGL_NO_CONTEXT)
+			{
+				eglMakeCurrent(Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+				eglDestroyContext(Display, Context);
+			}
+			if(Display != EGL_NO_DISPLAY)
+				eglTerminate(Display);
+		}
+
+		// GL 4.0 context without a surface, EGL_MESA_platform_surfaceless and EGL_KHR_surfaceless_context
+		bool create()
+		{
+			PFNEGLGETPLATFORMDISPLAYEXTPROC GetPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+			if(GetPlatformDisplay == nullptr)
+				return false;
+			Display = GetPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+			EGLint Major = 0, Minor = 0;
+			if(Display == EGL_NO_DISPLAY || !eglInitialize(Display, &Major, &Minor) || !eglBindAPI(EGL_OPENGL_API))
+				return false;
+
+			EGLint const Attribs[] = {EGL_CONTEXT_MAJOR_VERSION, 4, EGL_CONTEXT_MINOR_VERSION, 0, EGL_NONE};
+			Context = eglCreateContext(Display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, Attribs);
+			if(Context == EGL_NO_CONTEXT || !eglMakeCurrent(Display, EGL_NO_SURFACE, EGL_NO_SURFACE, Context))
+				return false;
+
+			// GLEW built for GLX fails glewInit without an X display, after loading the GL functions
+			glewExperimental = GL_TRUE;
+			glewInit();
+			return glMapBufferRange != nullptr && glFenceSync != nullptr && glClientWaitSync != nullptr;
+		}
+
+	private:
+		EGLDisplay Display;
+		EGLContext Context;
+	};
+
+	// Write LevelCount levels of a 32 bits DDS file with MipMapCount in its header, returns the RGBA pixels of each level
+	levels write_dds(char const * Path, uint32_t Width, uint32_t Height, uint32_t LevelCount, uint32_t MipMapCount, bool Bgra)
+	{
+		texture_streamer_detail::DdsHeader Header;
+		std::memset(&Header, 0, sizeof(Header));
+		Header.size = sizeof(Header);
+		Header.flags = 0x2100F;
+		Header.width = Width;
+		Header.height = Height;
+		Header.pitchOrLinearSize = Width * 4;
+		Header.mipMapCount = MipMapCount;
+		Header.pfSize = 32;
+		Header.pfFlags = texture_streamer_detail::DDPF_RGB | 0x1;
+		Header.pfRGBBitCount = 32;
+		Header.pfRBitMask = Bgra ? 0x00FF0000u : 0x000000FFu;
+		Header.pfGBitMask = 0x0000FF00u;
+		Header.pfBBitMask = Bgra ? 0x000000FFu : 0x00FF0000u;
+		Header.pfABitMask = 0xFF000000u;
+		Header.caps = 0x401008;
+
+		FILE * File = std::fopen(Path, "wb");
+		std::fwrite("DDS ", 4, 1, File);
+		std::fwrite(&Header, sizeof(Header), 1, File);
+
+		levels Levels(LevelCount);
+		for(uint32_t Level = 0; Level < LevelCount; ++Level)
+		{
+			std::size_t const Size = std::size_t(std::max(Width >> Level, 1u)) * std::max(Height >> Level, 1u) * 4;
+			Levels[Level].resize(Size);
+			std::vector<uint8_t> Stored(Size);
+			for(std::size_t i = 0; i < Size; ++i)
+				Levels[Level][i] = uint8_t(i * 13 + Level * 37 + 1);
+			for(std::size_t i = 0; i < Size; i += 4)
+			{
+				Stored[i + 0] = Levels[Level][i + (Bgra ? 2 : 0)];
+				Stored[i + 1] = Levels[Level][i + 1];
+				Stored[i + 2] = Levels[Level][i + (Bgra ? 0 : 2)];
+				Stored[i + 3] = Levels[Level][i + 3];
+			}
+			std::fwrite(&Stored[0], Size, 1, File);
+		}
+		std::fclose(File);
+		return Levels;
+	}
+
+	// Levels of the texture read back with glGetTexImage
+	int check_levels(TextureStreamer const & Streamer, TextureStreamer::Handle Handle, levels const & Expected)
+	{
+		int Error = 0;
+
+		Error += Streamer.level_count(Handle) == Expected.size() ? 0 : 1;
+		Error += Streamer.resident_level(Handle) == 0 ? 0 : 1;
+
+		glBindTexture(GL_TEXTURE_2D, Streamer.texture(Handle));
+		GLint BaseLevel = -1;
+		glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, &BaseLevel);
+		Error += BaseLevel == 0 ? 0 : 1;
+		for(std::size_t Level = 0; Level < Expected.size(); ++Level)
+		{
+			std::vector<uint8_t> Pixels(Expected[Level].size());
+			glGetTexImage(GL_TEXTURE_2D, GLint(Level), GL_RGBA, GL_UNSIGNED_BYTE, &Pixels[0]);
+			Error += Pixels == Expected[Level] ? 0 : 1;
+		}
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		return Error;
+	}
+
+	int test_streaming()
+	{
+		int Error = 0;
+
+		levels const Rgba = write_dds("texture_streamer_rgba.dds", 64, 32, 7, 7, false);
+		// The header claims more levels than a 16x16 texture has
+		levels const Bgra = write_dds("texture_streamer_bgra.dds", 16, 16, 5, 0xFFFFFFFFu, true);
+		// 65536 x 65536 pixels in a file of 64 bytes of pixels
+		write_dds("texture_streamer_truncated.dds", 65536, 65536, 0, 17, false);
+		{
+			FILE * File = std::fopen("texture_streamer_truncated.dds", "ab");
+			uint8_t const Pixels[64] = {0};
+			std::fwrite(Pixels, sizeof(Pixels), 1, File);
+			std::fclose(File);
+		}
+
+		JobSystem Jobs(2);
+		TextureStreamSettings Settings;
+		// Several frames and pixel buffers per level
+		Settings.bufferSize = 1024;
+		Settings.uploadBytesPerFrame = 2048;
+		TextureStreamer Streamer(Jobs, Settings);
+
+		TextureStreamer::Handle const RgbaHandle = Streamer.request("texture_streamer_rgba.dds");
+		TextureStreamer::Handle const BgraHandle = Streamer.request("texture_streamer_bgra.dds");
+		TextureStreamer::Handle const TruncatedHandle = Streamer.request("texture_streamer_truncated.dds");
+		TextureStreamer::Handle const MissingHandle = Streamer.request("texture_streamer_missing.dds");
+
+		// Frames of 1 ms, the worker may not run during a frame on a single core
+		for(int Frame = 0; Frame < 10000 && !Streamer.idle(); ++Frame)
+		{
+			Streamer.update();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		Error += Streamer.idle() ? 0 : 1;
+
+		Error += check_levels(Streamer, RgbaHandle, Rgba);
+		Error += check_levels(Streamer, BgraHandle, Bgra);
+
+		Error += Streamer.level_count(TruncatedHandle) == 0 ? 0 : 1;
+		Error += Streamer.level_count(MissingHandle) == 0 ? 0 : 1;
+
+		TextureStreamStats const Stats = Streamer.stats();
+		std::size_t Bytes = 0;
+		for(std::size_t Level = 0; Level < Rgba.size(); ++Level)
+			Bytes += Rgba[Level].size();
+		for(std::size_t Level = 0; Level < Bgra.size(); ++Level)
+			Bytes += Bgra[Level].size();
+		Error += Stats.failedLoads == 2 ? 0 : 1;
+		Error += Stats.bytesUploaded == Bytes ? 0 : 1;
+		Error += Stats.levelsUploaded == Rgba.size() + Bgra.size() ? 0 : 1;
+		Error += glGetError() == GL_NO_ERROR ? 0 : 1;
+
+		std::remove("texture_streamer_rgba.dds");
+		std::remove("texture_streamer_bgra.dds");
+		std::remove("texture_streamer_truncated.dds");
+
+		return Error;
+	}
+}//namespace
+
+int test_common_texture_streamer()
+{
+	gl_context Context;
+	if(!Context.create())
+	{
+		std::printf("No surfaceless EGL context with GL 4.0\n");
+		return 1;
+	}
+
+	int Error = 0;
+
+	Error += test_streaming();
+
+	return Error;
+}
@@ -0,0 +1,127 @@
+#include <glm/glm.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+// The AVX kernels of aligned dvec4 against the scalar code of packed dvec4. Component wise functions are
+// bit identical but for the sign of abs(-0.0), the reductions of dot, length, distance and normalize may
+// be summed in another order.
+// Build with GLM_TEST_ENABLE_SIMD_AVX2 for the AVX kernels, otherwise both types run the same code.
+namespace
+{
+	double const Infinity = std::numeric_limits<double>::infinity();
+
+	bool same(glm::dvec4 const & a, glm::aligned_dvec4 const & b)
+	{
+		for(glm::length_t i = 0; i < 4; ++i)
+			if(std::memcmp(&a[i], &b[i], sizeof(double)) != 0)
+				return false;
+		return true;
+	}
+
+	// Within Tolerance relative to Magnitude, the sum of the magnitudes of the terms of a reduction
+	bool close(double a, double b, double Magnitude, double Tolerance)
+	{
+		return std::abs(a - b) <= Tolerance * Magnitude;
+	}
+
+	glm::dvec4 random_dvec4(std::mt19937 & Generator)
+	{
+		std::uniform_real_distribution<double> Value(-1000.0, 1000.0);
+		return glm::dvec4(Value(Generator), Value(Generator), Value(Generator), Value(Generator));
+	}
+
+	int test_component_wise()
+	{
+		int Error = 0;
+
+		std::mt19937 Generator(1);
+		for(int i = 0; i < 100000; ++i)
+		{
+			glm::dvec4 const a = random_dvec4(Generator);
+			glm::dvec4 const b = random_dvec4(Generator);
+			glm::aligned_dvec4 const A(a);
+			glm::aligned_dvec4 const B(b);
+
+			Error += same(glm::abs(a), glm::abs(A)) ? 0 : 1;
+			Error += same(glm::floor(a), glm::floor(A)) ? 0 : 1;
+			Error += same(glm::min(a, b), glm::min(A, B)) ? 0 : 1;
+			Error += same(glm::max(a, b), glm::max(A, B)) ? 0 : 1;
+			Error += same(glm::min(a, b.x), glm::min(A, B.x)) ? 0 : 1;
+			Error += same(glm::max(a, b.x), glm::max(A, B.x)) ? 0 : 1;
+			Error += same(glm::clamp(a, -glm::abs(b), glm::abs(b)), glm::clamp(A, -glm::abs(B), glm::abs(B))) ? 0 : 1;
+			Error += same(glm::clamp(a, -100.0, 100.0), glm::clamp(A, -100.0, 100.0)) ? 0 : 1;
+			Error += same(glm::sqrt(glm::abs(a)), glm::sqrt(glm::abs(A))) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test_reduction()
+	{
+		int Error = 0;
+
+		std::mt19937 Generator(2);
+		for(int i = 0; i < 100000; ++i)
+		{
+			glm::dvec4 const a = random_dvec4(Generator);
+			glm::dvec4 const b = random_dvec4(Generator);
+			glm::aligned_dvec4 const A(a);
+			glm::aligned_dvec4 const B(b);
+
+			// The terms of dot may cancel, the error is relative to the sum of their magnitudes
+			double const Magnitude = glm::dot(glm::abs(a), glm::abs(b));
+			Error += close(glm::dot(a, b), glm::dot(A, B), Magnitude, 1e-15) ? 0 : 1;
+			Error += close(glm::length(a), glm::length(A), glm::length(a), 1e-15) ? 0 : 1;
+			Error += close(glm::distance(a, b), glm::distance(A, B), glm::distance(a, b), 1e-15) ? 0 : 1;
+
+			glm::dvec4 const Normalized = glm::normalize(a);
+			glm::aligned_dvec4 const AlignedNormalized = glm::normalize(A);
+			for(glm::length_t c = 0; c < 4; ++c)
+				Error += close(Normalized[c], AlignedNormalized[c], 1.0, 1e-15) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test_special_values()
+	{
+		int Error = 0;
+
+		glm::dvec4 const a(-0.0, -0.5, 9007199254740993.0, -Infinity);
+		glm::dvec4 const b(0.0, Infinity, -Infinity, 1.0);
+		glm::aligned_dvec4 const A(a);
+		glm::aligned_dvec4 const B(b);
+
+		// The scalar abs returns -0.0 unchanged, the AVX one clears the sign like the SSE abs of vec4
+		Error += glm::all(glm::equal(glm::abs(a), glm::dvec4(glm::abs(A)))) ? 0 : 1;
+		Error += same(glm::floor(a), glm::floor(A)) ? 0 : 1;
+		Error += glm::floor(A).y == -1.0 && std::signbit(glm::floor(A).x) ? 0 : 1;
+		Error += same(glm::min(a, b), glm::min(A, B)) ? 0 : 1;
+		Error += same(glm::max(a, b), glm::max(A, B)) ? 0 : 1;
+		Error += same(glm::clamp(a, -1.0, 1.0), glm::clamp(A, -1.0, 1.0)) ? 0 : 1;
+
+		glm::aligned_dvec4 const Roots = glm::sqrt(glm::aligned_dvec4(0.0, 4.0, Infinity, -1.0));
+		Error += Roots.x == 0.0 && Roots.y == 2.0 && Roots.z == Infinity && std::isnan(Roots.w) ? 0 : 1;
+
+		Error += glm::length(glm::aligned_dvec4(3.0, 0.0, 4.0, 0.0)) == 5.0 ? 0 : 1;
+		Error += glm::length(glm::aligned_dvec4(1.0, -Infinity, 0.0, 0.0)) == Infinity ? 0 : 1;
+		Error += glm::dot(glm::aligned_dvec4(1.0, 2.0, 3.0, 4.0), glm::aligned_dvec4(5.0, 6.0, 7.0, 8.0)) == 70.0 ? 0 : 1;
+		Error += glm::all(glm::equal(glm::normalize(glm::aligned_dvec4(0.0, 0.0, -2.0, 0.0)), glm::aligned_dvec4(0.0, 0.0, -1.0, 0.0))) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+int test_core_func_dvec4_simd()
+{
+	int Error = 0;
+
+	Error += test_component_wise();
+	Error += test_reduction();
+	Error += test_special_values();
+
+	return Error;
+}
@@ -0,0 +1,261 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/gtx/exponential_batch.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// The polynomial kernels of aligned_mediump and aligned_lowp vec4 and of the batch functions against a double
+// precision reference, within the ulp bounds documented by GTX_exponential_batch, and their special values.
+// aligned_highp vec4 must keep the results of the standard library.
+namespace
+{
+	typedef glm::tvec4<float, glm::aligned_highp> highp_vec4;
+	typedef glm::tvec4<float, glm::aligned_mediump> mediump_vec4;
+	typedef glm::tvec4<float, glm::aligned_lowp> lowp_vec4;
+
+	float const Infinity = std::numeric_limits<float>::infinity();
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+	float const Denormal = std::numeric_limits<float>::denorm_min();
+
+	std::size_t const Count = 1 << 18;
+
+	// Error of Result in units of the spacing of the floats around Exact
+	double ulps(float Result, double Exact)
+	{
+		if(static_cast<double>(Result) == Exact)
+			return 0.0;
+		int Exponent = 0;
+		std::frexp(Exact, &Exponent);
+		double const Spacing = std::ldexp(1.0, glm::max(Exponent, -125) - 24);
+		return std::abs(static_cast<double>(Result) - Exact) / Spacing;
+	}
+
+	bool same(float a, float b)
+	{
+		return std::memcmp(&a, &b, sizeof(float)) == 0 || (std::isnan(a) && std::isnan(b));
+	}
+
+	// Random floats whose bit patterns are uniform between Min and Max, to cover every exponent
+	std::vector<float> random_bits(float Min, float Max, unsigned Seed)
+	{
+		glm::uint32 MinBits, MaxBits;
+		std::memcpy(&MinBits, &Min, sizeof(float));
+		std::memcpy(&MaxBits, &Max, sizeof(float));
+
+		std::mt19937 Generator(Seed);
+		std::uniform_int_distribution<glm::uint32> Bits(MinBits, MaxBits);
+		std::vector<float> Result(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint32 const Value = Bits(Generator);
+			std::memcpy(&Result[i], &Value, sizeof(float));
+		}
+		return Result;
+	}
+
+	std::vector<float> random_floats(float Min, float Max, unsigned Seed)
+	{
+		std::mt19937 Generator(Seed);
+		std::uniform_real_distribution<float> Value(Min, Max);
+		std::vector<float> Result(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = Value(Generator);
+		return Result;
+	}
+
+	// The mediump, lowp and batch results of each input must be identical, and within MaxUlps of Exact.
+	// Exact results out of the range of normal floats are skipped.
+	template <typename vectorType, typename batchType, typename exactType>
+	int test_ulps(std::vector<float> const & In, vectorType const & Vector, batchType const & Batch, exactType const & Exact, double MaxUlps)
+	{
+		int Error = 0;
+
+		std::vector<float> Out(In.size());
+		Batch(In.size(), &In[0], &Out[0]);
+
+		for(std::size_t i = 0; i < In.size(); i += 4)
+		{
+			mediump_vec4 const Mediump = Vector(mediump_vec4(In[i + 0], In[i + 1], In[i + 2], In[i + 3]));
+			lowp_vec4 const Lowp = Vector(lowp_vec4(In[i + 0], In[i + 1], In[i + 2], In[i + 3]));
+			for(glm::length_t c = 0; c < 4; ++c)
+			{
+				Error += same(Mediump[c], Out[i + c]) && same(Lowp[c], Out[i + c]) ? 0 : 1;
+
+				double const Expected = Exact(static_cast<double>(In[i + c]));
+				if(std::abs(Expected) < static_cast<double>(std::numeric_limits<float>::min()) || std::abs(Expected) > static_cast<double>(std::numeric_limits<float>::max()))
+					continue;
+				Error += ulps(Out[i + c], Expected) <= MaxUlps ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	int test_exp()
+	{
+		int Error = 0;
+
+		Error += test_ulps(random_floats(-87.0f, 88.5f, 1),
+			[](auto const & x) { return glm::exp(x); },
+			[](std::size_t n, float const * x, float * y) { glm::expBatch(n, x, y); },
+			[](double x) { return std::exp(x); }, 2.5);
+		Error += test_ulps(random_floats(-126.0f, 127.9f, 2),
+			[](auto const & x) { return glm::exp2(x); },
+			[](std::size_t n, float const * x, float * y) { glm::exp2Batch(n, x, y); },
+			[](double x) { return std::exp2(x); }, 2.5);
+
+		// exp2 of integers is exact, down to the denormals
+		for(int n = -149; n <= 127; ++n)
+			Error += glm::exp2(mediump_vec4(static_cast<float>(n))).x == std::ldexp(1.0f, n) ? 0 : 1;
+
+		mediump_vec4 const Exp = glm::exp(mediump_vec4(0.0f, Infinity, -Infinity, NaN));
+		Error += Exp.x == 1.0f && Exp.y == Infinity && Exp.z == 0.0f && std::isnan(Exp.w) ? 0 : 1;
+		mediump_vec4 const Range = glm::exp(mediump_vec4(89.0f, -104.0f, 1000.0f, -1000.0f));
+		Error += Range.x == Infinity && Range.y == 0.0f && Range.z == Infinity && Range.w == 0.0f ? 0 : 1;
+		mediump_vec4 const Exp2 = glm::exp2(mediump_vec4(128.0f, -150.0f, -Infinity, NaN));
+		Error += Exp2.x == Infinity && Exp2.y == 0.0f && Exp2.z == 0.0f && std::isnan(Exp2.w) ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_log()
+	{
+		int Error = 0;
+
+		// Every positive normal float
+		std::vector<float> const Positives = random_bits(std::numeric_limits<float>::min(), std::numeric_limits<float>::max(), 3);
+		Error += test_ulps(Positives,
+			[](auto const & x) { return glm::log(x); },
+			[](std::size_t n, float const * x, float * y) { glm::logBatch(n, x, y); },
+			[](double x) { return std::log(x); }, 6.0);
+		Error += test_ulps(Positives,
+			[](auto const & x) { return glm::log2(x); },
+			[](std::size_t n, float const * x, float * y) { glm::log2Batch(n, x, y); },
+			[](double x) { return std::log2(x); }, 6.0);
+
+		// Denormals are scaled before the reduction
+		std::vector<float> const Denormals = random_bits(Denormal, std::numeric_limits<float>::min(), 4);
+		Error += test_ulps(Denormals,
+			[](auto const & x) { return glm::log2(x); },
+			[](std::size_t n, float const * x, float * y) { glm::log2Batch(n, x, y); },
+			[](double x) { return std::log2(x); }, 6.0);
+
+		// log2 of powers of two is exact, denormals included
+		for(int n = -149; n <= 127; ++n)
+			Error += glm::log2(mediump_vec4(std::ldexp(1.0f, n))).x == static_cast<float>(n) ? 0 : 1;
+
+		mediump_vec4 const Log = glm::log(mediump_vec4(0.0f, -0.0f, Infinity, 1.0f));
+		Error += Log.x == -Infinity && Log.y == -Infinity && Log.z == Infinity && Log.w == 0.0f ? 0 : 1;
+		mediump_vec4 const Invalid = glm::log2(mediump_vec4(-1.0f, -Denormal, -Infinity, NaN));
+		Error += glm::all(glm::isnan(Invalid)) ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_inversesqrt()
+	{
+		int Error = 0;
+
+		Error += test_ulps(random_bits(std::numeric_limits<float>::min(), std::numeric_limits<float>::max(), 5),
+			[](auto const & x) { return glm::inversesqrt(x); },
+			[](std::size_t n, float const * x, float * y) { glm::inversesqrtBatch(n, x, y); },
+			[](double x) { return 1.0 / std::sqrt(x); }, 4.0);
+
+		// The estimate flushes denormals to zero
+		mediump_vec4 const Special = glm::inversesqrt(mediump_vec4(0.0f, Denormal, Infinity, NaN));
+		Error += Special.x == Infinity && Special.y == Infinity && Special.z == 0.0f && std::isnan(Special.w) ? 0 : 1;
+		Error += std::isnan(glm::inversesqrt(mediump_vec4(-1.0f)).x) ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_pow()
+	{
+		int Error = 0;
+
+		// The error of log2 is scaled by the exponent
+		float const Exponents[] = {0.5f, 2.4f, 32.0f, 128.0f};
+		double const MaxUlps[] = {6.0, 40.0, 90.0, 230.0};
+		std::vector<float> const Bases = random_floats(0.0f, 1000.0f, 6);
+		for(std::size_t e = 0; e < sizeof(Exponents) / sizeof(Exponents[0]); ++e)
+		{
+			float const y = Exponents[e];
+			Error += test_ulps(Bases,
+				[y](auto const & x) { return glm::pow(x, typename std::decay<decltype(x)>::type(y)); },
+				[y](std::size_t n, float const * x, float * Out) { glm::powBatch(n, x, y, Out); },
+				[y](double x) { return std::pow(x, static_cast<double>(y)); }, MaxUlps[e]);
+		}
+
+		// pow(x, 0) is 1 like std::pow, negative bases give NaN even for integer exponents
+		mediump_vec4 const Zero = glm::pow(mediump_vec4(0.0f, -2.0f, Infinity, NaN), mediump_vec4(0.0f));
+		Error += glm::all(glm::equal(Zero, mediump_vec4(1.0f))) ? 0 : 1;
+		mediump_vec4 const Negative = glm::pow(mediump_vec4(-2.0f, -1.0f, -0.5f, -Infinity), mediump_vec4(2.0f));
+		Error += glm::all(glm::isnan(Negative)) ? 0 : 1;
+		mediump_vec4 const Special = glm::pow(mediump_vec4(0.0f, 0.0f, Infinity, 2.0f), mediump_vec4(2.0f, -2.0f, 2.0f, NaN));
+		Error += Special.x == 0.0f && Special.y == Infinity && Special.z == Infinity && std::isnan(Special.w) ? 0 : 1;
+
+		return Error;
+	}
+
+	// aligned_highp keeps the results of the standard library, like packed vec4
+	int test_highp()
+	{
+		int Error = 0;
+
+		std::vector<float> const In = random_floats(0.001f, 80.0f, 7);
+		for(std::size_t i = 0; i < In.size(); i += 4)
+		{
+			glm::vec4 const Packed(In[i + 0], In[i + 1], In[i + 2], In[i + 3]);
+			highp_vec4 const Aligned(Packed);
+			glm::vec4 const Results[] = {glm::exp(Packed), glm::exp2(Packed), glm::log(Packed), glm::log2(Packed), glm::pow(Packed, glm::vec4(2.4f)), glm::inversesqrt(Packed)};
+			highp_vec4 const AlignedResults[] = {glm::exp(Aligned), glm::exp2(Aligned), glm::log(Aligned), glm::log2(Aligned), glm::pow(Aligned, highp_vec4(2.4f)), glm::inversesqrt(Aligned)};
+			for(std::size_t f = 0; f < sizeof(Results) / sizeof(Results[0]); ++f)
+			for(glm::length_t c = 0; c < 4; ++c)
+				Error += same(Results[f][c], AlignedResults[f][c]) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Counts that aren't a multiple of the SIMD width, and results written over the inputs
+	int test_batch()
+	{
+		int Error = 0;
+
+		std::vector<float> const In = random_floats(0.5f, 8.0f, 8);
+		for(std::size_t n = 0; n < 20; ++n)
+		{
+			std::vector<float> InPlace(In.begin(), In.begin() + n);
+			glm::powBatch(n, &InPlace[0], 2.4f, &InPlace[0]);
+			for(std::size_t i = 0; i < n; ++i)
+				Error += same(InPlace[i], glm::pow(mediump_vec4(In[i]), mediump_vec4(2.4f)).x) ? 0 : 1;
+
+			std::vector<float> Exponents(n, 0.5f);
+			std::vector<float> Out(n);
+			glm::powBatch(n, &In[0], n == 0 ? 0 : &Exponents[0], n == 0 ? 0 : &Out[0]);
+			for(std::size_t i = 0; i < n; ++i)
+				Error += same(Out[i], glm::pow(mediump_vec4(In[i]), mediump_vec4(0.5f)).x) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace
+
+int test_core_func_exponential_simd()
+{
+	int Error = 0;
+
+	Error += test_exp();
+	Error += test_log();
+	Error += test_inversesqrt();
+	Error += test_pow();
+	Error += test_highp();
+	Error += test_batch();
+
+	return Error;
+}
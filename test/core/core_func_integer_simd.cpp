@@ -0,0 +1,230 @@
+#include <glm/glm.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <random>
+
+// The SIMD integer functions of aligned ivec4 and uvec4 against the scalar code of packed ivec4 and uvec4
+// and against 64 bits arithmetic, on random inputs biased towards edge cases.
+namespace
+{
+	int const Iterations = 200000;
+
+	class generator
+	{
+	public:
+		explicit generator(unsigned Seed) : Engine(Seed) {}
+
+		// Every bit width is equally likely, with zero, one and all bits set among them
+		glm::uint next()
+		{
+			glm::uint const Value = Engine();
+			switch(Engine() % 8)
+			{
+			case 0:
+				return Value >> (Engine() % 32);
+			case 1:
+				return ~(Value >> (Engine() % 32));
+			case 2:
+			{
+				glm::uint const Edges[] = {0u, 1u, 0x7FFFFFFFu, 0x80000000u, 0xFFFFFFFFu};
+				return Edges[Engine() % 5];
+			}
+			default:
+				return Value;
+			}
+		}
+
+		glm::uvec4 uvec4()
+		{
+			glm::uint const x = next();
+			glm::uint const y = next();
+			glm::uint const z = next();
+			glm::uint const w = next();
+			return glm::uvec4(x, y, z, w);
+		}
+
+		glm::ivec4 ivec4()
+		{
+			return glm::ivec4(uvec4());
+		}
+
+		int range(int Max)
+		{
+			return static_cast<int>(Engine() % static_cast<glm::uint>(Max + 1));
+		}
+
+	private:
+		std::mt19937 Engine;
+	};
+
+	int test_find()
+	{
+		int Error = 0;
+
+		generator Generator(1);
+		for(int i = 0; i < Iterations; ++i)
+		{
+			glm::uvec4 const u = Generator.uvec4();
+			glm::ivec4 const s = Generator.ivec4();
+
+			glm::ivec4 const MSB(glm::findMSB(glm::aligned_uvec4(u)));
+			glm::ivec4 const LSB(glm::findLSB(glm::aligned_uvec4(u)));
+			Error += MSB == glm::findMSB(u) ? 0 : 1;
+			Error += LSB == glm::findLSB(u) ? 0 : 1;
+			Error += glm::ivec4(glm::findMSB(glm::aligned_ivec4(s))) == glm::findMSB(s) ? 0 : 1;
+			Error += glm::ivec4(glm::findLSB(glm::aligned_ivec4(s))) == glm::findLSB(s) ? 0 : 1;
+			Error += glm::ivec4(glm::bitCount(glm::aligned_uvec4(u))) == glm::bitCount(u) ? 0 : 1;
+			Error += glm::ivec4(glm::bitCount(glm::aligned_ivec4(s))) == glm::bitCount(s) ? 0 : 1;
+			Error += glm::uvec4(glm::bitfieldReverse(glm::aligned_uvec4(u))) == glm::bitfieldReverse(u) ? 0 : 1;
+
+			for(glm::length_t k = 0; k < 4; ++k)
+			{
+				int ExpectedMSB = -1;
+				int ExpectedLSB = -1;
+				int ExpectedCount = 0;
+				for(int b = 0; b < 32; ++b)
+				{
+					if(!(u[k] & (1u << b)))
+						continue;
+					ExpectedMSB = b;
+					ExpectedLSB = ExpectedLSB < 0 ? b : ExpectedLSB;
+					++ExpectedCount;
+				}
+				Error += MSB[k] == ExpectedMSB ? 0 : 1;
+				Error += LSB[k] == ExpectedLSB ? 0 : 1;
+				Error += glm::bitCount(u[k]) == ExpectedCount ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	int test_carry()
+	{
+		int Error = 0;
+
+		generator Generator(2);
+		for(int i = 0; i < Iterations; ++i)
+		{
+			glm::uvec4 const x = Generator.uvec4();
+			glm::uvec4 const y = Generator.uvec4();
+
+			glm::aligned_uvec4 AlignedCarry;
+			glm::uvec4 Carry;
+			glm::uvec4 const Sum(glm::uaddCarry(glm::aligned_uvec4(x), glm::aligned_uvec4(y), AlignedCarry));
+			Error += Sum == glm::uaddCarry(x, y, Carry) ? 0 : 1;
+			Error += glm::uvec4(AlignedCarry) == Carry ? 0 : 1;
+
+			glm::aligned_uvec4 AlignedBorrow;
+			glm::uvec4 Borrow;
+			glm::uvec4 const Difference(glm::usubBorrow(glm::aligned_uvec4(x), glm::aligned_uvec4(y), AlignedBorrow));
+			Error += Difference == glm::usubBorrow(x, y, Borrow) ? 0 : 1;
+			Error += glm::uvec4(AlignedBorrow) == Borrow ? 0 : 1;
+
+			for(glm::length_t k = 0; k < 4; ++k)
+			{
+				glm::uint64 const Wide = static_cast<glm::uint64>(x[k]) + static_cast<glm::uint64>(y[k]);
+				Error += Sum[k] == static_cast<glm::uint>(Wide) ? 0 : 1;
+				Error += AlignedCarry[k] == static_cast<glm::uint>(Wide >> 32) ? 0 : 1;
+				Error += AlignedBorrow[k] == (x[k] < y[k] ? 1u : 0u) ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	int test_multiply()
+	{
+		int Error = 0;
+
+		generator Generator(3);
+		for(int i = 0; i < Iterations; ++i)
+		{
+			glm::uvec4 const ux = Generator.uvec4();
+			glm::uvec4 const uy = Generator.uvec4();
+			glm::ivec4 const sx = Generator.ivec4();
+			glm::ivec4 const sy = Generator.ivec4();
+
+			glm::aligned_uvec4 UnsignedHigh, UnsignedLow;
+			glm::umulExtended(glm::aligned_uvec4(ux), glm::aligned_uvec4(uy), UnsignedHigh, UnsignedLow);
+			glm::aligned_ivec4 SignedHigh, SignedLow;
+			glm::imulExtended(glm::aligned_ivec4(sx), glm::aligned_ivec4(sy), SignedHigh, SignedLow);
+
+			glm::uvec4 ScalarUnsignedHigh, ScalarUnsignedLow;
+			glm::umulExtended(ux, uy, ScalarUnsignedHigh, ScalarUnsignedLow);
+			glm::ivec4 ScalarSignedHigh, ScalarSignedLow;
+			glm::imulExtended(sx, sy, ScalarSignedHigh, ScalarSignedLow);
+
+			Error += glm::uvec4(UnsignedHigh) == ScalarUnsignedHigh ? 0 : 1;
+			Error += glm::uvec4(UnsignedLow) == ScalarUnsignedLow ? 0 : 1;
+			Error += glm::ivec4(SignedHigh) == ScalarSignedHigh ? 0 : 1;
+			Error += glm::ivec4(SignedLow) == ScalarSignedLow ? 0 : 1;
+
+			for(glm::length_t k = 0; k < 4; ++k)
+			{
+				glm::uint64 const Unsigned = static_cast<glm::uint64>(ux[k]) * static_cast<glm::uint64>(uy[k]);
+				Error += UnsignedHigh[k] == static_cast<glm::uint>(Unsigned >> 32) ? 0 : 1;
+				Error += UnsignedLow[k] == static_cast<glm::uint>(Unsigned) ? 0 : 1;
+
+				glm::uint64 const Signed = static_cast<glm::uint64>(static_cast<glm::int64>(sx[k]) * static_cast<glm::int64>(sy[k]));
+				Error += static_cast<glm::uint>(SignedHigh[k]) == static_cast<glm::uint>(Signed >> 32) ? 0 : 1;
+				Error += static_cast<glm::uint>(SignedLow[k]) == static_cast<glm::uint>(Signed) ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	int test_bitfield()
+	{
+		int Error = 0;
+
+		generator Generator(4);
+		for(int i = 0; i < Iterations; ++i)
+		{
+			glm::uvec4 const u = Generator.uvec4();
+			glm::uvec4 const v = Generator.uvec4();
+			glm::ivec4 const s = Generator.ivec4();
+			glm::ivec4 const t = Generator.ivec4();
+
+			// Offset + Bits <= 32, Bits may be 0 or 32
+			int const Bits = Generator.range(32);
+			int const Offset = Generator.range(32 - Bits);
+
+			Error += glm::uvec4(glm::bitfieldExtract(glm::aligned_uvec4(u), Offset, Bits)) == glm::bitfieldExtract(u, Offset, Bits) ? 0 : 1;
+			Error += glm::ivec4(glm::bitfieldExtract(glm::aligned_ivec4(s), Offset, Bits)) == glm::bitfieldExtract(s, Offset, Bits) ? 0 : 1;
+			Error += glm::uvec4(glm::bitfieldInsert(glm::aligned_uvec4(u), glm::aligned_uvec4(v), Offset, Bits)) == glm::bitfieldInsert(u, v, Offset, Bits) ? 0 : 1;
+			Error += glm::ivec4(glm::bitfieldInsert(glm::aligned_ivec4(s), glm::aligned_ivec4(t), Offset, Bits)) == glm::bitfieldInsert(s, t, Offset, Bits) ? 0 : 1;
+
+			glm::uvec4 const Extract(glm::bitfieldExtract(glm::aligned_uvec4(u), Offset, Bits));
+			glm::ivec4 const SignedExtract(glm::bitfieldExtract(glm::aligned_ivec4(s), Offset, Bits));
+			glm::uvec4 const Insert(glm::bitfieldInsert(glm::aligned_uvec4(u), glm::aligned_uvec4(v), Offset, Bits));
+			for(glm::length_t k = 0; k < 4; ++k)
+			{
+				// The field is bits [Offset, Offset + Bits), signed fields are sign extended
+				glm::uint64 const Mask = (static_cast<glm::uint64>(1) << Bits) - 1u;
+				glm::uint64 const Field = (static_cast<glm::uint64>(u[k]) >> Offset) & Mask;
+				glm::uint64 const SignedField = (static_cast<glm::uint64>(static_cast<glm::uint>(s[k])) >> Offset) & Mask;
+				glm::int64 const Sign = Bits > 0 && (SignedField >> (Bits - 1)) ? static_cast<glm::int64>(Mask) + 1 : 0;
+				glm::uint64 const Inserted = (static_cast<glm::uint64>(u[k]) & ~(Mask << Offset)) | ((v[k] & Mask) << Offset);
+
+				Error += Extract[k] == static_cast<glm::uint>(Field) ? 0 : 1;
+				Error += SignedExtract[k] == static_cast<int>(static_cast<glm::int64>(SignedField) - Sign) ? 0 : 1;
+				Error += Insert[k] == static_cast<glm::uint>(Inserted) ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+}//namespace
+
+int test_core_func_integer_simd()
+{
+	int Error = 0;
+
+	Error += test_find();
+	Error += test_carry();
+	Error += test_multiply();
+	Error += test_bitfield();
+
+	return Error;
+}
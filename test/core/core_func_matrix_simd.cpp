@@ -0,0 +1,338 @@
+#include <glm/glm.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+// The SIMD kernels of aligned mat4 and vec4 against a double precision reference.
+// Sums of 4 products are allowed 4 ulps of the sum of the magnitudes of the products, the worst case
+// of 4 roundings whatever the order of the additions and whether they are fused.
+// The SIMD kernels of aligned mat3 and mat2 against the scalar code of the packed types, within the same
+// bounds: the two may round differently, the scalar code may be contracted to FMA by the compiler.
+namespace
+{
+	typedef glm::tmat4x4<float, glm::aligned_highp> aligned_mat4;
+	typedef glm::tmat3x3<float, glm::aligned_highp> aligned_mat3;
+	typedef glm::tmat2x2<float, glm::aligned_highp> aligned_mat2;
+
+	double const MaxUlps = 4.0;
+
+	double ulp(double Magnitude)
+	{
+		float const Value = static_cast<float>(Magnitude);
+		return static_cast<double>(std::nextafter(Value, std::numeric_limits<float>::infinity()) - Value);
+	}
+
+	// Error of Result in ulps of Magnitude, at least the smallest normal float
+	double ulps(float Result, double Exact, double Magnitude)
+	{
+		return std::abs(static_cast<double>(Result) - Exact) / ulp(std::max(Magnitude, static_cast<double>(std::numeric_limits<float>::min())));
+	}
+
+	template <typename matType>
+	matType random_mat4(std::mt19937 & Generator)
+	{
+		std::uniform_real_distribution<float> Value(-100.0f, 100.0f);
+		matType Result;
+		for(glm::length_t c = 0; c < 4; ++c)
+		for(glm::length_t r = 0; r < 4; ++r)
+			Result[c][r] = Value(Generator);
+		return Result;
+	}
+
+	template <typename matType>
+	matType random_mat(std::mt19937 & Generator)
+	{
+		std::uniform_real_distribution<float> Value(-100.0f, 100.0f);
+		matType Result;
+		for(glm::length_t c = 0; c < Result.length(); ++c)
+		for(glm::length_t r = 0; r < Result[c].length(); ++r)
+			Result[c][r] = Value(Generator);
+		return Result;
+	}
+
+	template <typename vecType>
+	vecType random_vec4(std::mt19937 & Generator)
+	{
+		std::uniform_real_distribution<float> Value(-100.0f, 100.0f);
+		return vecType(Value(Generator), Value(Generator), Value(Generator), Value(Generator));
+	}
+
+	int test_mat4_mul()
+	{
+		int Error = 0;
+		double MaxError = 0.0;
+
+		std::mt19937 Generator(1);
+		for(int i = 0; i < 100000; ++i)
+		{
+			aligned_mat4 const A = random_mat4<aligned_mat4>(Generator);
+			aligned_mat4 const B = random_mat4<aligned_mat4>(Generator);
+			aligned_mat4 const Result = A * B;
+
+			for(glm::length_t c = 0; c < 4; ++c)
+			for(glm::length_t r = 0; r < 4; ++r)
+			{
+				double Exact = 0.0;
+				double Magnitude = 0.0;
+				for(glm::length_t k = 0; k < 4; ++k)
+				{
+					double const Product = static_cast<double>(A[k][r]) * static_cast<double>(B[c][k]);
+					Exact += Product;
+					Magnitude += std::abs(Product);
+				}
+				MaxError = std::max(MaxError, ulps(Result[c][r], Exact, Magnitude));
+			}
+
+			// The output may alias an input
+			aligned_mat4 C = A;
+			C = C * B;
+			Error += C == Result ? 0 : 1;
+		}
+		Error += MaxError <= MaxUlps ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_mat4_mul_vec4()
+	{
+		int Error = 0;
+		double MaxError = 0.0;
+
+		std::mt19937 Generator(2);
+		for(int i = 0; i < 100000; ++i)
+		{
+			aligned_mat4 const M = random_mat4<aligned_mat4>(Generator);
+			glm::aligned_vec4 const V = random_vec4<glm::aligned_vec4>(Generator);
+			glm::aligned_vec4 const Result = M * V;
+
+			for(glm::length_t r = 0; r < 4; ++r)
+			{
+				double Exact = 0.0;
+				double Magnitude = 0.0;
+				for(glm::length_t k = 0; k < 4; ++k)
+				{
+					double const Product = static_cast<double>(M[k][r]) * static_cast<double>(V[k]);
+					Exact += Product;
+					Magnitude += std::abs(Product);
+				}
+				MaxError = std::max(MaxError, ulps(Result[r], Exact, Magnitude));
+			}
+		}
+		Error += MaxError <= MaxUlps ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_dot()
+	{
+		int Error = 0;
+		double MaxError = 0.0;
+
+		std::mt19937 Generator(3);
+		for(int i = 0; i < 100000; ++i)
+		{
+			glm::aligned_vec4 const A = random_vec4<glm::aligned_vec4>(Generator);
+			glm::aligned_vec4 const B = random_vec4<glm::aligned_vec4>(Generator);
+
+			double Exact = 0.0;
+			double Magnitude = 0.0;
+			for(glm::length_t k = 0; k < 4; ++k)
+			{
+				double const Product = static_cast<double>(A[k]) * static_cast<double>(B[k]);
+				Exact += Product;
+				Magnitude += std::abs(Product);
+			}
+			MaxError = std::max(MaxError, ulps(glm::dot(A, B), Exact, Magnitude));
+		}
+		Error += MaxError <= MaxUlps ? 0 : 1;
+
+		return Error;
+	}
+
+	// x + a * (y - x), exact at a = 0
+	int test_mix()
+	{
+		int Error = 0;
+		double MaxError = 0.0;
+
+		std::mt19937 Generator(4);
+		std::uniform_real_distribution<float> Weight(0.0f, 1.0f);
+		for(int i = 0; i < 100000; ++i)
+		{
+			glm::aligned_vec4 const X = random_vec4<glm::aligned_vec4>(Generator);
+			glm::aligned_vec4 const Y = random_vec4<glm::aligned_vec4>(Generator);
+			glm::aligned_vec4 const A(Weight(Generator), Weight(Generator), Weight(Generator), Weight(Generator));
+			float const S = Weight(Generator);
+
+			glm::aligned_vec4 const Vector = glm::mix(X, Y, A);
+			glm::aligned_vec4 const Scalar = glm::mix(X, Y, S);
+			for(glm::length_t k = 0; k < 4; ++k)
+			{
+				double const Magnitude = std::abs(static_cast<double>(X[k])) + std::abs(static_cast<double>(Y[k]));
+				double const Difference = static_cast<double>(Y[k]) - static_cast<double>(X[k]);
+				MaxError = std::max(MaxError, ulps(Vector[k], X[k] + A[k] * Difference, Magnitude));
+				MaxError = std::max(MaxError, ulps(Scalar[k], X[k] + S * Difference, Magnitude));
+			}
+
+			Error += glm::mix(X, Y, 0.0f) == X ? 0 : 1;
+			Error += glm::mix(X, Y, glm::aligned_vec4(0.0f)) == X ? 0 : 1;
+		}
+		Error += MaxError <= MaxUlps ? 0 : 1;
+
+		return Error;
+	}
+	// Sums of products of the components of A and B, Magnitude the sums of their absolute values
+	glm::dvec3 cross(glm::dvec3 const & a, glm::dvec3 const & b, glm::dvec3 & Magnitude)
+	{
+		Magnitude = glm::abs(glm::dvec3(a.y * b.z, a.z * b.x, a.x * b.y)) + glm::abs(glm::dvec3(a.z * b.y, a.x * b.z, a.y * b.x));
+		return glm::cross(a, b);
+	}
+
+	// Errors of the components of an inverse transpose, in ulps of the magnitude of their rounding errors:
+	// the cofactor roundings divided by the determinant, plus the determinant rounding propagated to the
+	// quotient.
+	double inverse_ulps(float Result, double Cofactor, double CofactorMagnitude, double Determinant, double DeterminantMagnitude)
+	{
+		double const Magnitude = CofactorMagnitude / std::abs(Determinant) + std::abs(Cofactor) * DeterminantMagnitude / (Determinant * Determinant);
+		return ulps(Result, Cofactor / Determinant, Magnitude);
+	}
+
+	int test_mat3()
+	{
+		int Error = 0;
+		double MaxError = 0.0;
+
+		std::mt19937 Generator(5);
+		for(int i = 0; i < 100000; ++i)
+		{
+			glm::mat3 const A = random_mat<glm::mat3>(Generator);
+			glm::mat3 const B = random_mat<glm::mat3>(Generator);
+			aligned_mat3 const AlignedA(A);
+			aligned_mat3 const AlignedB(B);
+
+			glm::mat3 const Product = A * B;
+			aligned_mat3 const AlignedProduct = AlignedA * AlignedB;
+			glm::vec3 const Transformed = A * B[0];
+			glm::aligned_vec3 const AlignedTransformed = AlignedA * AlignedB[0];
+			for(glm::length_t c = 0; c < 3; ++c)
+			for(glm::length_t r = 0; r < 3; ++r)
+			{
+				double Magnitude = 0.0;
+				for(glm::length_t k = 0; k < 3; ++k)
+					Magnitude += std::abs(static_cast<double>(A[k][r]) * static_cast<double>(B[c][k]));
+				MaxError = std::max(MaxError, ulps(AlignedProduct[c][r], Product[c][r], Magnitude));
+				if(c == 0)
+					MaxError = std::max(MaxError, ulps(AlignedTransformed[r], Transformed[r], Magnitude));
+			}
+
+			Error += glm::mat3(glm::transpose(AlignedA)) == glm::transpose(A) ? 0 : 1;
+
+			// Cofactors are the cross products of the columns, determinant their dot product with the first column
+			glm::dvec3 const Column[3] = {glm::dvec3(A[0]), glm::dvec3(A[1]), glm::dvec3(A[2])};
+			glm::dvec3 CofactorMagnitude[3];
+			glm::dvec3 const Cofactor[3] = {cross(Column[1], Column[2], CofactorMagnitude[0]), cross(Column[2], Column[0], CofactorMagnitude[1]), cross(Column[0], Column[1], CofactorMagnitude[2])};
+			double const Determinant = glm::dot(Column[0], Cofactor[0]);
+			double const DeterminantMagnitude = glm::dot(glm::abs(Column[0]), CofactorMagnitude[0]);
+
+			MaxError = std::max(MaxError, ulps(glm::determinant(AlignedA), glm::determinant(A), DeterminantMagnitude));
+
+			glm::mat3 const Inverse = glm::inverse(A);
+			glm::mat3 const InverseTranspose = glm::inverseTranspose(A);
+			aligned_mat3 const AlignedInverse = glm::inverse(AlignedA);
+			aligned_mat3 const AlignedInverseTranspose = glm::inverseTranspose(AlignedA);
+			for(glm::length_t c = 0; c < 3; ++c)
+			for(glm::length_t r = 0; r < 3; ++r)
+			{
+				MaxError = std::max(MaxError, inverse_ulps(AlignedInverseTranspose[c][r], Cofactor[c][r], CofactorMagnitude[c][r], Determinant, DeterminantMagnitude));
+				MaxError = std::max(MaxError, inverse_ulps(InverseTranspose[c][r], Cofactor[c][r], CofactorMagnitude[c][r], Determinant, DeterminantMagnitude));
+				MaxError = std::max(MaxError, inverse_ulps(AlignedInverse[r][c], Cofactor[c][r], CofactorMagnitude[c][r], Determinant, DeterminantMagnitude));
+				MaxError = std::max(MaxError, inverse_ulps(Inverse[r][c], Cofactor[c][r], CofactorMagnitude[c][r], Determinant, DeterminantMagnitude));
+			}
+		}
+		Error += MaxError <= MaxUlps ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_mat2()
+	{
+		int Error = 0;
+		double MaxError = 0.0;
+
+		std::mt19937 Generator(6);
+		for(int i = 0; i < 100000; ++i)
+		{
+			glm::mat2 const A = random_mat<glm::mat2>(Generator);
+			glm::mat2 const B = random_mat<glm::mat2>(Generator);
+			aligned_mat2 const AlignedA(A);
+			aligned_mat2 const AlignedB(B);
+
+			glm::mat2 const Product = A * B;
+			aligned_mat2 const AlignedProduct = AlignedA * AlignedB;
+			for(glm::length_t c = 0; c < 2; ++c)
+			for(glm::length_t r = 0; r < 2; ++r)
+			{
+				double const Magnitude = std::abs(static_cast<double>(A[0][r]) * static_cast<double>(B[c][0])) + std::abs(static_cast<double>(A[1][r]) * static_cast<double>(B[c][1]));
+				MaxError = std::max(MaxError, ulps(AlignedProduct[c][r], Product[c][r], Magnitude));
+			}
+
+			Error += glm::mat2(glm::transpose(AlignedA)) == glm::transpose(A) ? 0 : 1;
+
+			// The cofactors are components of the matrix, only the determinant is rounded
+			double const Cofactor[2][2] = {{A[1][1], -A[1][0]}, {-A[0][1], A[0][0]}};
+			double const Determinant = static_cast<double>(A[0][0]) * A[1][1] - static_cast<double>(A[1][0]) * A[0][1];
+			double const DeterminantMagnitude = std::abs(static_cast<double>(A[0][0]) * A[1][1]) + std::abs(static_cast<double>(A[1][0]) * A[0][1]);
+
+			MaxError = std::max(MaxError, ulps(glm::determinant(AlignedA), glm::determinant(A), DeterminantMagnitude));
+
+			glm::mat2 const Inverse = glm::inverse(A);
+			glm::mat2 const InverseTranspose = glm::inverseTranspose(A);
+			aligned_mat2 const AlignedInverse = glm::inverse(AlignedA);
+			aligned_mat2 const AlignedInverseTranspose = glm::inverseTranspose(AlignedA);
+			for(glm::length_t c = 0; c < 2; ++c)
+			for(glm::length_t r = 0; r < 2; ++r)
+			{
+				MaxError = std::max(MaxError, inverse_ulps(AlignedInverseTranspose[c][r], Cofactor[c][r], 0.0, Determinant, DeterminantMagnitude));
+				MaxError = std::max(MaxError, inverse_ulps(InverseTranspose[c][r], Cofactor[c][r], 0.0, Determinant, DeterminantMagnitude));
+				MaxError = std::max(MaxError, inverse_ulps(AlignedInverse[r][c], Cofactor[c][r], 0.0, Determinant, DeterminantMagnitude));
+				MaxError = std::max(MaxError, inverse_ulps(Inverse[r][c], Cofactor[c][r], 0.0, Determinant, DeterminantMagnitude));
+			}
+		}
+		Error += MaxError <= MaxUlps ? 0 : 1;
+
+		return Error;
+	}
+
+	// inverseTranspose of mat2 used to return the inverse
+	int test_mat2_inverseTranspose()
+	{
+		int Error = 0;
+
+		glm::mat2 const M(1.0f, 2.0f, 3.0f, 4.0f);
+		glm::mat2 const Expected(-2.0f, 1.5f, 1.0f, -0.5f);
+		Error += glm::inverseTranspose(M) == Expected ? 0 : 1;
+		Error += glm::inverseTranspose(M) == glm::transpose(glm::inverse(M)) ? 0 : 1;
+		Error += glm::mat2(glm::inverseTranspose(aligned_mat2(M))) == Expected ? 0 : 1;
+		Error += glm::inverseTranspose(glm::dmat2(M)) == glm::dmat2(Expected) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+int test_core_func_matrix_simd()
+{
+	int Error = 0;
+
+	Error += test_mat4_mul();
+	Error += test_mat4_mul_vec4();
+	Error += test_dot();
+	Error += test_mix();
+	Error += test_mat3();
+	Error += test_mat2();
+	Error += test_mat2_inverseTranspose();
+
+	return Error;
+}
@@ -0,0 +1,139 @@
+#include <glm/glm.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+// aligned_vec3 computes its padding lane along with x, y and z. Whatever the padding holds, results must
+// be bit identical to those of a zero padding and match packed vec3.
+namespace
+{
+	struct results
+	{
+		glm::vec3 Vectors[13];
+		float Scalars[3];
+	};
+
+	// Write Pad in the padding lane, past z
+	glm::aligned_vec3 poison(glm::vec3 const & v, float Pad)
+	{
+		glm::aligned_vec3 Result(v.x, v.y, v.z);
+		std::memcpy(reinterpret_cast<char *>(&Result) + sizeof(float) * 3, &Pad, sizeof(Pad));
+		return Result;
+	}
+
+	template <typename vecType>
+	glm::vec3 xyz(vecType const & v)
+	{
+		return glm::vec3(v.x, v.y, v.z);
+	}
+
+	template <typename vecType>
+	results compute(vecType const & a, vecType const & b, float s)
+	{
+		vecType c = a;
+		c += b;
+		c *= s;
+		c /= b;
+		c -= a;
+
+		results Results;
+		Results.Vectors[0] = xyz(a + b);
+		Results.Vectors[1] = xyz(a - b);
+		Results.Vectors[2] = xyz(a * b);
+		Results.Vectors[3] = xyz(a / b);
+		Results.Vectors[4] = xyz(a * s);
+		Results.Vectors[5] = xyz(s * a);
+		Results.Vectors[6] = xyz(a / s);
+		Results.Vectors[7] = xyz(s - a);
+		Results.Vectors[8] = xyz(c);
+		Results.Vectors[9] = xyz(glm::cross(a, b));
+		Results.Vectors[10] = xyz(glm::normalize(a));
+		Results.Vectors[11] = xyz(glm::reflect(a, glm::normalize(b)));
+		// The padding of a result feeds the next operation
+		Results.Vectors[12] = xyz(glm::normalize(glm::cross(a / b, b / a)));
+		Results.Scalars[0] = glm::dot(a, b);
+		Results.Scalars[1] = glm::length(a);
+		Results.Scalars[2] = glm::distance(a, b);
+		return Results;
+	}
+
+	// Cross and reflect cancel, the absolute term covers their rounding differences
+	bool close(float a, float b)
+	{
+		return std::abs(a - b) <= 1e-5f * std::max(std::abs(a), std::abs(b)) + 1e-4f;
+	}
+
+	int test_padding()
+	{
+		int Error = 0;
+
+		float const Pads[] =
+		{
+			std::numeric_limits<float>::quiet_NaN(),
+			std::numeric_limits<float>::infinity(),
+			-std::numeric_limits<float>::infinity(),
+			std::numeric_limits<float>::denorm_min(),
+			3e38f,
+			-1.0f
+		};
+		std::size_t const PadCount = sizeof(Pads) / sizeof(Pads[0]);
+
+		std::mt19937 Generator(1);
+		std::uniform_real_distribution<float> Value(-10.0f, 10.0f);
+		for(int i = 0; i < 20000; ++i)
+		{
+			glm::vec3 const a(Value(Generator), Value(Generator), Value(Generator));
+			glm::vec3 const b(Value(Generator), Value(Generator), Value(Generator));
+			float const s = Value(Generator);
+
+			results const Packed = compute(a, b, s);
+			results const Zero = compute(poison(a, 0.0f), poison(b, 0.0f), s);
+			for(std::size_t p = 0; p < PadCount; ++p)
+			{
+				results const Poisoned = compute(poison(a, Pads[p]), poison(b, Pads[(p + 1) % PadCount]), s);
+				Error += std::memcmp(&Poisoned, &Zero, sizeof(results)) == 0 ? 0 : 1;
+			}
+
+			// The packed code may be contracted to fused multiply-adds
+			for(std::size_t v = 0; v < 13; ++v)
+			for(glm::length_t k = 0; k < 3; ++k)
+				Error += close(Zero.Vectors[v][k], Packed.Vectors[v][k]) ? 0 : 1;
+			for(std::size_t v = 0; v < 3; ++v)
+				Error += close(Zero.Scalars[v], Packed.Scalars[v]) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test_layout()
+	{
+		int Error = 0;
+
+		Error += sizeof(glm::aligned_vec3) == 16 ? 0 : 1;
+		Error += sizeof(glm::vec3) == 12 ? 0 : 1;
+
+		// Scalar and component constructors don't leave the padding uninitialized
+		glm::aligned_vec3 const Scalar(2.0f);
+		glm::aligned_vec3 const Components(1.0f, 2.0f, 3.0f);
+		float Pad = 0.0f;
+		std::memcpy(&Pad, reinterpret_cast<char const *>(&Scalar) + sizeof(float) * 3, sizeof(Pad));
+		Error += Pad == 2.0f ? 0 : 1;
+		std::memcpy(&Pad, reinterpret_cast<char const *>(&Components) + sizeof(float) * 3, sizeof(Pad));
+		Error += Pad == 3.0f ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+int test_core_type_aligned_vec3()
+{
+	int Error = 0;
+
+	Error += test_layout();
+	Error += test_padding();
+
+	return Error;
+}
@@ -0,0 +1,63 @@
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+// Each static_assert fails to compile when its matrix can't be computed at compile time.
+// The same matrices computed at run time must be equal.
+#if GLM_HAS_CONSTEXPR_CXX14
+namespace
+{
+	constexpr glm::mat4 Identity(1.0f);
+	constexpr glm::mat4 Translate = glm::translate(Identity, glm::vec3(1.0f, 2.0f, 3.0f));
+	constexpr glm::mat4 Scale = glm::scale(Identity, glm::vec3(2.0f, 4.0f, 8.0f));
+	constexpr glm::mat4 Ortho = glm::ortho(-2.0f, 2.0f, -1.0f, 1.0f, 1.0f, 3.0f);
+	constexpr glm::mat4 Frustum = glm::frustum(-1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 3.0f);
+	constexpr glm::mat4 LookAt = glm::lookAt(glm::vec3(0.0f, 0.0f, 4.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	constexpr glm::mat4 TranslateScale = Translate * Scale;
+	constexpr glm::mat4 ModelViewProjection = Frustum * LookAt * TranslateScale;
+
+	static_assert(Translate[3] == glm::vec4(1.0f, 2.0f, 3.0f, 1.0f), "translate");
+	static_assert(Translate[0] == Identity[0] && Translate[1] == Identity[1] && Translate[2] == Identity[2], "translate");
+
+	static_assert(Scale[0] == glm::vec4(2.0f, 0.0f, 0.0f, 0.0f), "scale");
+	static_assert(Scale[1] == glm::vec4(0.0f, 4.0f, 0.0f, 0.0f), "scale");
+	static_assert(Scale[2] == glm::vec4(0.0f, 0.0f, 8.0f, 0.0f), "scale");
+	static_assert(Scale[3] == Identity[3], "scale");
+
+	static_assert(Ortho[0][0] == 0.5f && Ortho[1][1] == 1.0f && Ortho[2][2] == -1.0f, "ortho");
+	static_assert(Ortho[3] == glm::vec4(0.0f, 0.0f, -2.0f, 1.0f), "ortho");
+
+	static_assert(Frustum[0][0] == 1.0f && Frustum[1][1] == 1.0f, "frustum");
+	static_assert(Frustum[2][2] == -2.0f && Frustum[2][3] == -1.0f && Frustum[3][2] == -3.0f && Frustum[3][3] == 0.0f, "frustum");
+
+	// The eye is on the z axis looking at the origin, lookAt is a translation by -4 along z
+	static_assert(LookAt[0] == Identity[0] && LookAt[1] == Identity[1] && LookAt[2] == Identity[2], "lookAt");
+	static_assert(LookAt[3] == glm::vec4(0.0f, 0.0f, -4.0f, 1.0f), "lookAt");
+
+	static_assert(TranslateScale[0][0] == 2.0f && TranslateScale[1][1] == 4.0f && TranslateScale[2][2] == 8.0f, "operator*");
+	static_assert(TranslateScale[3] == Translate[3], "operator*");
+	static_assert(Scale * Translate != TranslateScale, "operator*");
+	static_assert(Identity * Frustum == Frustum && Frustum * Identity == Frustum, "operator*");
+	static_assert(TranslateScale * glm::vec4(1.0f) == glm::vec4(3.0f, 6.0f, 11.0f, 1.0f), "operator*");
+
+	// A point on the far plane
+	constexpr glm::vec4 Far = ModelViewProjection * glm::vec4(0.0f, 0.0f, -0.25f, 1.0f);
+	static_assert(Far.z == Far.w, "operator*");
+}//namespace
+#endif//GLM_HAS_CONSTEXPR_CXX14
+
+int test_core_type_mat4x4_constexpr()
+{
+	int Error = 0;
+
+#	if GLM_HAS_CONSTEXPR_CXX14
+		glm::mat4 const Model = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f)) * glm::scale(glm::mat4(1.0f), glm::vec3(2.0f, 4.0f, 8.0f));
+		glm::mat4 const View = glm::lookAt(glm::vec3(0.0f, 0.0f, 4.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+		Error += Model == TranslateScale ? 0 : 1;
+		Error += View == LookAt ? 0 : 1;
+		Error += glm::ortho(-2.0f, 2.0f, -1.0f, 1.0f, 1.0f, 3.0f) == Ortho ? 0 : 1;
+		Error += glm::frustum(-1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 3.0f) * View * Model == ModelViewProjection ? 0 : 1;
+#	endif//GLM_HAS_CONSTEXPR_CXX14
+
+	return Error;
+}
@@ -0,0 +1,226 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/bvh.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+	struct scene
+	{
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint32> Indices;
+		std::vector<glm::vec3> Origins;
+		std::vector<glm::vec3> Directions;
+	};
+
+	// Small triangles scattered in a box, and rays from inside the box
+	scene make_scene(std::size_t TriangleCount, std::size_t RayCount)
+	{
+		std::mt19937 Generator(1);
+		std::uniform_real_distribution<float> Box(-10.0f, 10.0f);
+		std::uniform_real_distribution<float> Offset(-0.5f, 0.5f);
+
+		scene Scene;
+		for(std::size_t i = 0; i < TriangleCount; ++i)
+		{
+			glm::vec3 const Center(Box(Generator), Box(Generator), Box(Generator));
+			for(int v = 0; v < 3; ++v)
+			{
+				Scene.Indices.push_back(static_cast<glm::uint32>(Scene.Positions.size()));
+				Scene.Positions.push_back(Center + glm::vec3(Offset(Generator), Offset(Generator), Offset(Generator)));
+			}
+		}
+
+		for(std::size_t i = 0; i < RayCount; ++i)
+		{
+			Scene.Origins.push_back(glm::vec3(Box(Generator), Box(Generator), Box(Generator)));
+			Scene.Directions.push_back(glm::normalize(glm::vec3(Box(Generator), Box(Generator), Box(Generator))));
+		}
+
+		return Scene;
+	}
+
+	// Closest hit by testing every triangle with intersectRayTriangle
+	glm::uint32 brute_force(scene const & Scene, std::size_t Ray, float & Distance)
+	{
+		glm::uint32 Closest = glm::bvh::invalid;
+		Distance = 1e30f;
+		for(std::size_t t = 0; t < Scene.Indices.size() / 3; ++t)
+		{
+			glm::vec2 Barycentric;
+			float TriangleDistance = 0.0f;
+			bool const Hit = glm::intersectRayTriangle(
+				Scene.Origins[Ray], Scene.Directions[Ray],
+				Scene.Positions[Scene.Indices[t * 3 + 0]], Scene.Positions[Scene.Indices[t * 3 + 1]], Scene.Positions[Scene.Indices[t * 3 + 2]],
+				Barycentric, TriangleDistance);
+			if(Hit && TriangleDistance > 0.0f && TriangleDistance < Distance)
+			{
+				Distance = TriangleDistance;
+				Closest = static_cast<glm::uint32>(t);
+			}
+		}
+		return Closest;
+	}
+
+	int test_intersect()
+	{
+		int Error = 0;
+
+		scene const Scene = make_scene(5000, 1000);
+
+		glm::bvh_build_params Params;
+		Params.parallelThreshold = 256;
+		Params.threadCount = 4;
+
+		glm::bvh Bvh;
+		Bvh.build(&Scene.Positions[0], &Scene.Indices[0], Scene.Indices.size() / 3, Params);
+		Error += Bvh.triangleCount() == Scene.Indices.size() / 3 ? 0 : 1;
+
+		int Hits = 0;
+		for(std::size_t r = 0; r < Scene.Origins.size(); ++r)
+		{
+			float Distance = 0.0f;
+			glm::uint32 const Expected = brute_force(Scene, r, Distance);
+
+			glm::bvh_hit Hit;
+			bool const Found = Bvh.intersect(Scene.Origins[r], Scene.Directions[r], 1e30f, Hit);
+			Hits += Found ? 1 : 0;
+
+			Error += Found == (Expected != glm::bvh::invalid) ? 0 : 1;
+			// Two triangles may be hit at the same distance
+			Error += Hit.triangle == Expected || std::abs(Hit.distance - Distance) < 1e-3f ? 0 : 1;
+			Error += Bvh.occluded(Scene.Origins[r], Scene.Directions[r], 1e30f) == Found ? 0 : 1;
+
+			if(Found)
+			{
+				Error += !Bvh.occluded(Scene.Origins[r], Scene.Directions[r], Hit.distance * 0.99f) ? 0 : 1;
+				glm::bvh_hit Near;
+				Error += !Bvh.intersect(Scene.Origins[r], Scene.Directions[r], Hit.distance * 0.99f, Near) ? 0 : 1;
+				Error += Near.triangle == glm::bvh::invalid ? 0 : 1;
+			}
+		}
+
+		// The scene is dense enough for most rays to hit something
+		Error += Hits > 100 ? 0 : 1;
+
+		return Error;
+	}
+
+	template <glm::length_t L>
+	int test_packet()
+	{
+		int Error = 0;
+
+		scene const Scene = make_scene(5000, 512);
+
+		glm::bvh Bvh;
+		Bvh.build(&Scene.Positions[0], 0, Scene.Positions.size() / 3);
+
+		for(std::size_t r = 0; r + L <= Scene.Origins.size(); r += L)
+		{
+			glm::bvh_ray_packet<L> Rays;
+			for(glm::length_t l = 0; l < L; ++l)
+			{
+				Rays.origX[l] = Scene.Origins[r + l].x;
+				Rays.origY[l] = Scene.Origins[r + l].y;
+				Rays.origZ[l] = Scene.Origins[r + l].z;
+				Rays.dirX[l] = Scene.Directions[r + l].x;
+				Rays.dirY[l] = Scene.Directions[r + l].y;
+				Rays.dirZ[l] = Scene.Directions[r + l].z;
+				// Lane 1 is inactive
+				Rays.tmax[l] = l == 1 ? 0.0f : 1e30f;
+			}
+
+			glm::bvh_hit_packet<L> Hits;
+			Bvh.intersect(Rays, Hits);
+
+			for(glm::length_t l = 0; l < L; ++l)
+			{
+				glm::bvh_hit Hit;
+				Bvh.intersect(Scene.Origins[r + l], Scene.Directions[r + l], Rays.tmax[l], Hit);
+				Error += Hits.triangle[l] == Hit.triangle ? 0 : 1;
+				if(Hit.triangle != glm::bvh::invalid)
+				{
+					Error += std::abs(Hits.distance[l] - Hit.distance) < 1e-4f ? 0 : 1;
+					Error += std::abs(Hits.u[l] - Hit.barycentric.x) < 1e-4f ? 0 : 1;
+					Error += std::abs(Hits.v[l] - Hit.barycentric.y) < 1e-4f ? 0 : 1;
+				}
+			}
+			Error += Hits.triangle[1] == glm::bvh::invalid ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Indexed grid in the z = 0 plane, each cell split in two triangles
+	int test_indexed()
+	{
+		int Error = 0;
+
+		int const Size = 16;
+		std::vector<glm::vec3> Positions;
+		for(int y = 0; y <= Size; ++y)
+		for(int x = 0; x <= Size; ++x)
+			Positions.push_back(glm::vec3(x, y, 0));
+
+		std::vector<glm::uint32> Indices;
+		for(int y = 0; y < Size; ++y)
+		for(int x = 0; x < Size; ++x)
+		{
+			glm::uint32 const i = static_cast<glm::uint32>(y * (Size + 1) + x);
+			glm::uint32 const Quad[6] = {i, i + 1, i + Size + 2, i, i + Size + 2, i + Size + 1};
+			Indices.insert(Indices.end(), Quad, Quad + 6);
+		}
+
+		glm::bvh Bvh;
+		Bvh.build(&Positions[0], &Indices[0], Indices.size() / 3);
+
+		for(int y = 0; y < Size; ++y)
+		for(int x = 0; x < Size; ++x)
+		{
+			// Below the diagonal of the cell, in its first triangle
+			glm::bvh_hit Hit;
+			bool const Found = Bvh.intersect(glm::vec3(x + 0.75f, y + 0.25f, 5.0f), glm::vec3(0, 0, -1), 1e30f, Hit);
+			Error += Found ? 0 : 1;
+			Error += Hit.triangle == static_cast<glm::uint32>((y * Size + x) * 2) ? 0 : 1;
+			Error += std::abs(Hit.distance - 5.0f) < 1e-5f ? 0 : 1;
+		}
+
+		// Outside of the grid and away from it
+		glm::bvh_hit Hit;
+		Error += !Bvh.intersect(glm::vec3(-1, -1, 5), glm::vec3(0, 0, -1), 1e30f, Hit) ? 0 : 1;
+		Error += !Bvh.intersect(glm::vec3(4, 4, 5), glm::vec3(0, 0, 1), 1e30f, Hit) ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_empty()
+	{
+		int Error = 0;
+
+		glm::bvh Bvh;
+		Bvh.build(0, 0, 0);
+
+		glm::bvh_hit Hit;
+		Error += !Bvh.intersect(glm::vec3(0), glm::vec3(0, 0, 1), 1e30f, Hit) ? 0 : 1;
+		Error += Hit.triangle == glm::bvh::invalid ? 0 : 1;
+		Error += !Bvh.occluded(glm::vec3(0), glm::vec3(0, 0, 1), 1e30f) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+int test_gtx_bvh()
+{
+	int Error = 0;
+
+	Error += test_intersect();
+	Error += test_packet<4>();
+	Error += test_packet<8>();
+	Error += test_indexed();
+	Error += test_empty();
+
+	return Error;
+}
@@ -0,0 +1,224 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/fused.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// fused() expressions of aligned vec4 and vec3 are computed with single rounding fused multiply-adds when
+// GLM_HAS_FMA is set, with the regular operators otherwise. fused() of other vectors returns the vector.
+// Build with GLM_TEST_ENABLE_SIMD_AVX2 for the FMA instructions.
+namespace
+{
+	// a * b + c is 1 + 2^-11 + 2^-24 - (1 + 2^-11): the product rounds to 1 + 2^-11, only the fused sum keeps 2^-24
+	float const Factor = 1.0f + 1.0f / 4096.0f;
+	float const Product = 1.0f + 1.0f / 2048.0f;
+	float const Residual = 1.0f / 16777216.0f;
+
+	bool const Fused = (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_FMA;
+
+	template <typename vecType>
+	bool same(vecType const & a, vecType const & b)
+	{
+		for(glm::length_t i = 0; i < a.length(); ++i)
+			if(std::memcmp(&a[i], &b[i], sizeof(float)) != 0)
+				return false;
+		return true;
+	}
+
+	// Component wise a * b + c rounded once with FMA, twice otherwise
+	template <typename vecType>
+	vecType multiply_add(vecType const & a, vecType const & b, vecType const & c)
+	{
+		if(!Fused)
+			return a * b + c;
+		vecType Result;
+		for(glm::length_t i = 0; i < a.length(); ++i)
+			Result[i] = std::fma(a[i], b[i], c[i]);
+		return Result;
+	}
+
+	template <typename vecType>
+	vecType random_vec(std::mt19937 & Generator)
+	{
+		std::uniform_real_distribution<float> Value(-10.0f, 10.0f);
+		vecType Result;
+		for(glm::length_t i = 0; i < Result.length(); ++i)
+			Result[i] = Value(Generator);
+		return Result;
+	}
+
+	template <typename vecType>
+	int test_lowering()
+	{
+		int Error = 0;
+
+		vecType const a(Factor);
+		vecType const b(Factor);
+		vecType const c(Product);
+
+		// Only the fused results keep the residual
+		vecType const Expected(Fused ? Residual : 0.0f);
+		Error += same<vecType>(glm::fused(a) * b - c, Expected) ? 0 : 1;
+		Error += same<vecType>(-c + glm::fused(a) * b, Expected) ? 0 : 1;
+		Error += same<vecType>(glm::fused(a) * b + -c, Expected) ? 0 : 1;
+		Error += same<vecType>(c - a * glm::fused(b), vecType(Fused ? -Residual : 0.0f)) ? 0 : 1;
+		Error += same<vecType>(glm::fused(a) * glm::fused(b) - glm::fused(c), Expected) ? 0 : 1;
+
+		std::mt19937 Generator(1);
+		for(int i = 0; i < 10000; ++i)
+		{
+			vecType const x = random_vec<vecType>(Generator);
+			vecType const y = random_vec<vecType>(Generator);
+			vecType const z = random_vec<vecType>(Generator);
+			vecType const w = random_vec<vecType>(Generator);
+
+			Error += same<vecType>(glm::fused(x) * y + z, multiply_add(x, y, z)) ? 0 : 1;
+			Error += same<vecType>(z + glm::fused(x) * y, multiply_add(x, y, z)) ? 0 : 1;
+			Error += same<vecType>(glm::fused(x) * y - z, multiply_add(x, y, -z)) ? 0 : 1;
+			Error += same<vecType>(z - glm::fused(x) * y, multiply_add(-x, y, z)) ? 0 : 1;
+
+			// The second product is computed first, then the first one is fused with the sum
+			Error += same<vecType>(glm::fused(x) * y + glm::fused(z) * w, multiply_add(x, y, vecType(z * w))) ? 0 : 1;
+			Error += same<vecType>(glm::fused(x) * y - glm::fused(z) * w, multiply_add(x, y, vecType(-(z * w)))) ? 0 : 1;
+
+			// Nested expressions, Horner's scheme
+			Error += same<vecType>((glm::fused(x) * y + z) * x + w, multiply_add(multiply_add(x, y, z), x, w)) ? 0 : 1;
+
+			// Other operators compute what the regular ones do
+			Error += same<vecType>(glm::fused(x) + y - z, x + y - z) ? 0 : 1;
+			Error += same<vecType>(glm::fused(x) / y, x / y) ? 0 : 1;
+			Error += same<vecType>(-glm::fused(x) * y, -x * y) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	template <typename vecType>
+	int test_scalar()
+	{
+		int Error = 0;
+
+		std::mt19937 Generator(2);
+		std::uniform_real_distribution<float> Scalar(-10.0f, 10.0f);
+		for(int i = 0; i < 10000; ++i)
+		{
+			vecType const x = random_vec<vecType>(Generator);
+			vecType const y = random_vec<vecType>(Generator);
+			float const s = Scalar(Generator);
+			float const t = Scalar(Generator);
+
+			Error += same<vecType>(glm::fused(x) * s + y, multiply_add(x, vecType(s), y)) ? 0 : 1;
+			Error += same<vecType>(s * glm::fused(x) + y, multiply_add(vecType(s), x, y)) ? 0 : 1;
+			Error += same<vecType>(glm::fused(x) * y + t, multiply_add(x, y, vecType(t))) ? 0 : 1;
+			Error += same<vecType>(t - glm::fused(x) * s, multiply_add(-x, vecType(s), vecType(t))) ? 0 : 1;
+			Error += same<vecType>(glm::fused(x) * s - t, multiply_add(x, vecType(s), vecType(-t))) ? 0 : 1;
+			Error += same<vecType>(glm::fused(x) / s + t, x / s + t) ? 0 : 1;
+			Error += same<vecType>(s / glm::fused(x) - t, s / x - t) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// fused() of the vectors without FMA kernels is the vector itself
+	int test_pass_through()
+	{
+		int Error = 0;
+
+		glm::vec4 const Packed4(1.0f);
+		glm::vec3 const Packed3(1.0f);
+		glm::aligned_dvec4 const Double(1.0);
+		glm::aligned_ivec4 const Integer(1);
+		glm::aligned_vec2 const Aligned2(1.0f);
+
+		Error += std::is_same<decltype(glm::fused(Packed4)), glm::vec4 const &>::value ? 0 : 1;
+		Error += std::is_same<decltype(glm::fused(Packed3)), glm::vec3 const &>::value ? 0 : 1;
+		Error += std::is_same<decltype(glm::fused(Double)), glm::aligned_dvec4 const &>::value ? 0 : 1;
+		Error += std::is_same<decltype(glm::fused(Integer)), glm::aligned_ivec4 const &>::value ? 0 : 1;
+		Error += std::is_same<decltype(glm::fused(Aligned2)), glm::aligned_vec2 const &>::value ? 0 : 1;
+		Error += &glm::fused(Packed4) == &Packed4 ? 0 : 1;
+
+		bool const Expression = GLM_ARCH & GLM_ARCH_SSE2_BIT;
+		Error += std::is_same<decltype(glm::fused(glm::aligned_vec4(1.0f))), glm::aligned_vec4 const &>::value != Expression ? 0 : 1;
+		Error += std::is_same<decltype(glm::fused(glm::aligned_vec3(1.0f))), glm::aligned_vec3 const &>::value != Expression ? 0 : 1;
+
+		// Packed vectors go through the regular operators
+		glm::vec4 const Result = glm::fused(Packed4) * Packed4 + Packed4;
+		Error += Result == glm::vec4(2.0f) ? 0 : 1;
+
+		return Error;
+	}
+
+	template <typename vecType>
+	int test_batch()
+	{
+		int Error = 0;
+
+		std::mt19937 Generator(3);
+		std::size_t const Count = 1000;
+		std::vector<vecType> Positions(Count), Velocities(Count), Accelerations(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Positions[i] = random_vec<vecType>(Generator);
+			Velocities[i] = random_vec<vecType>(Generator);
+			Accelerations[i] = random_vec<vecType>(Generator);
+		}
+		float const DeltaTime = 1.0f / 60.0f;
+
+		// Out is the first operand of the sum
+		std::vector<vecType> Expected(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Expected[i] = multiply_add(Velocities[i], vecType(DeltaTime), Positions[i]);
+		std::vector<vecType> Integrated(Positions);
+		glm::fusedBatch(Count, glm::fused(&Integrated[0]) + glm::fused(&Velocities[0]) * DeltaTime, &Integrated[0]);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same(Integrated[i], Expected[i]) ? 0 : 1;
+
+		// Out is an operand of the product
+		for(std::size_t i = 0; i < Count; ++i)
+			Expected[i] = multiply_add(Accelerations[i], vecType(DeltaTime), Velocities[i]) * Velocities[i];
+		std::vector<vecType> Updated(Velocities);
+		glm::fusedBatch(Count, (glm::fused(&Accelerations[0]) * DeltaTime + glm::fused(&Updated[0])) * glm::fused(&Updated[0]), &Updated[0]);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same(Updated[i], Expected[i]) ? 0 : 1;
+
+		// Zero vectors and the conversion of an array expression, which uses its first element
+		glm::fusedBatch(0, glm::fused(&Positions[0]) * 2.0f, static_cast<vecType *>(0));
+		vecType const First = glm::fused(&Positions[0]) * glm::fused(&Velocities[0]) + glm::fused(&Accelerations[0]);
+		Error += same(First, multiply_add(Positions[0], Velocities[0], Accelerations[0])) ? 0 : 1;
+
+		return Error;
+	}
+
+	// Arrays of packed vectors use the regular operators
+	int test_batch_packed()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> Positions(100, glm::vec3(1.0f, 2.0f, 3.0f));
+		std::vector<glm::vec3> const Velocities(100, glm::vec3(4.0f, 8.0f, 12.0f));
+		glm::fusedBatch(Positions.size(), glm::fused(&Positions[0]) + glm::fused(&Velocities[0]) * 0.25f, &Positions[0]);
+		for(std::size_t i = 0; i < Positions.size(); ++i)
+			Error += Positions[i] == glm::vec3(2.0f, 4.0f, 6.0f) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+int test_gtx_fused()
+{
+	int Error = 0;
+
+	Error += test_lowering<glm::aligned_vec4>();
+	Error += test_lowering<glm::aligned_vec3>();
+	Error += test_scalar<glm::aligned_vec4>();
+	Error += test_scalar<glm::aligned_vec3>();
+	Error += test_pass_through();
+	Error += test_batch<glm::aligned_vec4>();
+	Error += test_batch<glm::aligned_vec3>();
+	Error += test_batch_packed();
+
+	return Error;
+}
@@ -0,0 +1,98 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_batch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+// normalMatrixBatch against inverseTranspose(mat3(ModelView[i])) for every count up to two AVX iterations
+// past the SSE2 tail, and the matrices after the output array must not be written.
+// The batch and the loop may round differently when the compiler contracts the scalar code to FMA, the
+// components are allowed 4 ulps of the magnitude of the rounding errors of the cofactors and determinant.
+namespace
+{
+	double const MaxUlps = 4.0;
+
+	double ulp(double Magnitude)
+	{
+		float const Value = static_cast<float>(Magnitude);
+		return static_cast<double>(std::nextafter(Value, std::numeric_limits<float>::infinity()) - Value);
+	}
+
+	// |a.y * b.z| + |a.z * b.y| ... the magnitude of the rounding errors of cross(a, b)
+	glm::dvec3 cross_magnitude(glm::dvec3 const & a, glm::dvec3 const & b)
+	{
+		return glm::abs(glm::dvec3(a.y * b.z, a.z * b.x, a.x * b.y)) + glm::abs(glm::dvec3(a.z * b.y, a.x * b.z, a.y * b.x));
+	}
+
+	// Largest error of the components of Result in ulps of their magnitudes
+	double normal_matrix_ulps(glm::mat4 const & ModelView, glm::mat3 const & Result)
+	{
+		glm::dvec3 const Column[3] = {glm::dvec3(ModelView[0]), glm::dvec3(ModelView[1]), glm::dvec3(ModelView[2])};
+		glm::dvec3 const Cofactor[3] = {glm::cross(Column[1], Column[2]), glm::cross(Column[2], Column[0]), glm::cross(Column[0], Column[1])};
+		glm::dvec3 const CofactorMagnitude[3] = {cross_magnitude(Column[1], Column[2]), cross_magnitude(Column[2], Column[0]), cross_magnitude(Column[0], Column[1])};
+		double const Determinant = glm::dot(Column[0], Cofactor[0]);
+		double const DeterminantMagnitude = glm::dot(glm::abs(Column[0]), CofactorMagnitude[0]);
+
+		double MaxError = 0.0;
+		for(glm::length_t c = 0; c < 3; ++c)
+		for(glm::length_t r = 0; r < 3; ++r)
+		{
+			double const Magnitude = CofactorMagnitude[c][r] / std::abs(Determinant) + std::abs(Cofactor[c][r]) * DeterminantMagnitude / (Determinant * Determinant);
+			double const Error = std::abs(static_cast<double>(Result[c][r]) - Cofactor[c][r] / Determinant) / ulp(std::max(Magnitude, static_cast<double>(std::numeric_limits<float>::min())));
+			MaxError = std::max(MaxError, Error);
+		}
+		return MaxError;
+	}
+
+	int test_normalMatrixBatch()
+	{
+		int Error = 0;
+
+		std::mt19937 Generator(1);
+		std::uniform_real_distribution<float> Value(-100.0f, 100.0f);
+		std::vector<glm::mat4> ModelView(40);
+		for(std::size_t i = 0; i < ModelView.size(); ++i)
+		for(glm::length_t c = 0; c < 4; ++c)
+		for(glm::length_t r = 0; r < 4; ++r)
+			ModelView[i][c][r] = Value(Generator);
+
+		glm::mat3 const Sentinel(-1.0f);
+		for(std::size_t Count = 0; Count <= ModelView.size() - 4; ++Count)
+		{
+			std::vector<glm::mat3> Out(Count + 2, Sentinel);
+			glm::normalMatrixBatch(Count, Count == 0 ? 0 : &ModelView[0], &Out[0]);
+
+			double MaxError = 0.0;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				MaxError = std::max(MaxError, normal_matrix_ulps(ModelView[i], Out[i]));
+				MaxError = std::max(MaxError, normal_matrix_ulps(ModelView[i], glm::inverseTranspose(glm::mat3(ModelView[i]))));
+			}
+			Error += MaxError <= MaxUlps ? 0 : 1;
+			Error += std::memcmp(&Out[Count], &Sentinel, sizeof(glm::mat3)) == 0 && std::memcmp(&Out[Count + 1], &Sentinel, sizeof(glm::mat3)) == 0 ? 0 : 1;
+		}
+
+		// The normal matrix of a rotation is the rotation, of a scale the inverse scale
+		glm::mat4 const Rotation(glm::vec4(0.0f, 1.0f, 0.0f, 0.0f), glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f), glm::vec4(0.0f, 0.0f, 1.0f, 0.0f), glm::vec4(3.0f, 4.0f, 5.0f, 1.0f));
+		glm::mat4 const Scale(glm::vec4(2.0f, 0.0f, 0.0f, 0.0f), glm::vec4(0.0f, 4.0f, 0.0f, 0.0f), glm::vec4(0.0f, 0.0f, 0.5f, 0.0f), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+		glm::mat4 const Matrices[3] = {Rotation, Scale, Rotation};
+		glm::mat3 Normals[3];
+		glm::normalMatrixBatch(3, Matrices, Normals);
+		Error += Normals[0] == glm::mat3(Rotation) && Normals[2] == glm::mat3(Rotation) ? 0 : 1;
+		Error += Normals[1] == glm::mat3(0.5f, 0.0f, 0.0f, 0.0f, 0.25f, 0.0f, 0.0f, 0.0f, 2.0f) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+int test_gtx_matrix_batch()
+{
+	int Error = 0;
+
+	Error += test_normalMatrixBatch();
+
+	return Error;
+}
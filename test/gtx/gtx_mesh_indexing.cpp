@@ -0,0 +1,196 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/mesh_indexing.hpp>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	// Interleaved layout of Test003
+	struct vertex
+	{
+		glm::vec3 Position;
+		glm::vec2 TexCoord;
+	};
+
+	// VertexCount vertices picked among UniqueCount random ones
+	std::vector<vertex> make_vertices(std::size_t VertexCount, std::size_t UniqueCount, unsigned Seed)
+	{
+		std::mt19937 Generator(Seed);
+		std::uniform_real_distribution<float> Value(-1.0f, 1.0f);
+		std::uniform_int_distribution<std::size_t> Pick(0, UniqueCount - 1);
+
+		std::vector<vertex> Unique(UniqueCount);
+		for(std::size_t i = 0; i < UniqueCount; ++i)
+		{
+			Unique[i].Position = glm::vec3(Value(Generator), Value(Generator), Value(Generator));
+			Unique[i].TexCoord = glm::vec2(Value(Generator), Value(Generator));
+		}
+
+		std::vector<vertex> Vertices(VertexCount);
+		for(std::size_t i = 0; i < VertexCount; ++i)
+			Vertices[i] = Unique[i < UniqueCount ? i : Pick(Generator)];
+		std::shuffle(Vertices.begin(), Vertices.end(), Generator);
+		return Vertices;
+	}
+
+	// The std::unordered_map deduplication generateVertexRemap replaces
+	std::size_t baseline_remap(std::vector<vertex> const & Vertices, std::vector<glm::uint32> & Remap)
+	{
+		std::unordered_map<std::string, glm::uint32> Table;
+		Remap.resize(Vertices.size());
+		for(std::size_t i = 0; i < Vertices.size(); ++i)
+		{
+			std::string const Key(reinterpret_cast<char const *>(&Vertices[i]), sizeof(vertex));
+			std::pair<std::unordered_map<std::string, glm::uint32>::iterator, bool> const Result =
+				Table.insert(std::make_pair(Key, static_cast<glm::uint32>(Table.size())));
+			Remap[i] = Result.first->second;
+		}
+		return Table.size();
+	}
+
+	glm::uint32 read_index(glm::indexed_mesh const & Mesh, std::size_t i)
+	{
+		if(Mesh.indexSize == 2)
+		{
+			glm::uint16 Index;
+			std::memcpy(&Index, &Mesh.indices[i * 2], sizeof(Index));
+			return Index;
+		}
+
+		glm::uint32 Index;
+		std::memcpy(&Index, &Mesh.indices[i * 4], sizeof(Index));
+		return Index;
+	}
+
+	int test_remap(std::size_t VertexCount, std::size_t UniqueCount)
+	{
+		int Error = 0;
+
+		std::vector<vertex> const Vertices = make_vertices(VertexCount, UniqueCount, static_cast<unsigned>(VertexCount));
+
+		std::vector<glm::uint32> Expected;
+		std::size_t const ExpectedCount = baseline_remap(Vertices, Expected);
+
+		std::vector<glm::uint32> Remap(Vertices.size());
+		std::size_t const Count = glm::generateVertexRemap(Vertices.size(), &Vertices[0], sizeof(vertex), &Remap[0]);
+
+		Error += Count == ExpectedCount ? 0 : 1;
+		Error += Remap == Expected ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_index(std::size_t VertexCount, std::size_t UniqueCount)
+	{
+		int Error = 0;
+
+		std::vector<vertex> const Vertices = make_vertices(VertexCount, UniqueCount, 7);
+
+		glm::indexed_mesh Mesh;
+		glm::indexVertices(Vertices.size(), &Vertices[0], sizeof(vertex), Mesh);
+
+		Error += Mesh.vertexCount == UniqueCount ? 0 : 1;
+		Error += Mesh.stride == sizeof(vertex) ? 0 : 1;
+		Error += Mesh.vertices.size() == UniqueCount * sizeof(vertex) ? 0 : 1;
+		Error += Mesh.indexCount == VertexCount ? 0 : 1;
+		Error += Mesh.indexSize == (UniqueCount <= 65535 ? 2u : 4u) ? 0 : 1;
+		Error += Mesh.indices.size() == VertexCount * Mesh.indexSize ? 0 : 1;
+		if(Error)
+			return Error;
+
+		// Every index leads back to the original vertex
+		for(std::size_t i = 0; i < VertexCount; ++i)
+		{
+			glm::uint32 const Index = read_index(Mesh, i);
+			Error += Index < Mesh.vertexCount ? 0 : 1;
+			if(Index < Mesh.vertexCount)
+				Error += std::memcmp(&Mesh.vertices[Index * sizeof(vertex)], &Vertices[i], sizeof(vertex)) == 0 ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Vertices are compared as bytes
+	int test_signed_zero()
+	{
+		int Error = 0;
+
+		vertex Vertices[3];
+		for(std::size_t i = 0; i < 3; ++i)
+		{
+			Vertices[i].Position = glm::vec3(0.0f);
+			Vertices[i].TexCoord = glm::vec2(0.0f);
+		}
+		Vertices[1].Position.x = -0.0f;
+
+		glm::uint32 Remap[3];
+		Error += glm::generateVertexRemap(3, Vertices, sizeof(vertex), Remap) == 2 ? 0 : 1;
+		Error += Remap[0] == 0 && Remap[1] == 1 && Remap[2] == 0 ? 0 : 1;
+
+		return Error;
+	}
+
+	bool within(vertex const & a, vertex const & b, float Epsilon)
+	{
+		return
+			glm::all(glm::lessThanEqual(glm::abs(a.Position - b.Position), glm::vec3(Epsilon))) &&
+			glm::all(glm::lessThanEqual(glm::abs(a.TexCoord - b.TexCoord), glm::vec2(Epsilon)));
+	}
+
+	int test_weld()
+	{
+		int Error = 0;
+
+		float const Epsilon = 1e-3f;
+
+		std::vector<vertex> Vertices = make_vertices(4000, 500, 3);
+		std::mt19937 Generator(5);
+		std::uniform_real_distribution<float> Jitter(-Epsilon * 0.25f, Epsilon * 0.25f);
+		for(std::size_t i = 0; i < Vertices.size(); ++i)
+		{
+			Vertices[i].Position += glm::vec3(Jitter(Generator), Jitter(Generator), Jitter(Generator));
+			Vertices[i].TexCoord += glm::vec2(Jitter(Generator), Jitter(Generator));
+		}
+
+		std::vector<glm::uint32> Remap(Vertices.size());
+		std::size_t const Count = glm::generateVertexRemapWeld(Vertices.size(), &Vertices[0], sizeof(vertex), 0, Epsilon, &Remap[0]);
+
+		// Each vertex is merged with the first unique vertex within Epsilon, found here by testing all of them
+		std::vector<std::size_t> Unique;
+		for(std::size_t i = 0; i < Vertices.size(); ++i)
+		{
+			std::size_t Expected = Unique.size();
+			for(std::size_t u = 0; u < Unique.size() && Expected == Unique.size(); ++u)
+				if(within(Vertices[i], Vertices[Unique[u]], Epsilon))
+					Expected = u;
+			if(Expected == Unique.size())
+				Unique.push_back(i);
+			Error += Remap[i] == Expected ? 0 : 1;
+		}
+
+		Error += Count == Unique.size() ? 0 : 1;
+		Error += Count == 500 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+int test_gtx_mesh_indexing()
+{
+	int Error = 0;
+
+	Error += test_remap(1, 1);
+	Error += test_remap(1000, 1000);
+	Error += test_remap(100000, 3000);
+	Error += test_remap(300000, 100000);
+	Error += test_index(30000, 5000);
+	Error += test_index(200000, 70000);
+	Error += test_signed_zero();
+	Error += test_weld();
+
+	return Error;
+}
@@ -0,0 +1,73 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#ifdef GLM_TEST_ENABLE_GL
+int test_common_texture_streamer();
+#endif
+int test_core_func_dvec4_simd();
+int test_core_func_exponential_simd();
+int test_core_func_integer_simd();
+int test_core_func_matrix_simd();
+int test_core_type_aligned_vec3();
+int test_core_type_mat4x4_constexpr();
+int test_gtx_bvh();
+int test_gtx_fused();
+int test_gtx_matrix_batch();
+int test_gtx_mesh_indexing();
+
+namespace
+{
+	struct suite
+	{
+		char const * name;
+		int (*run)();
+	};
+
+	suite const Suites[] =
+	{
+#		ifdef GLM_TEST_ENABLE_GL
+			{"common_texture_streamer", test_common_texture_streamer},
+#		endif
+		{"core_func_dvec4_simd", test_core_func_dvec4_simd},
+		{"core_func_exponential_simd", test_core_func_exponential_simd},
+		{"core_func_integer_simd", test_core_func_integer_simd},
+		{"core_func_matrix_simd", test_core_func_matrix_simd},
+		{"core_type_aligned_vec3", test_core_type_aligned_vec3},
+		{"core_type_mat4x4_constexpr", test_core_type_mat4x4_constexpr},
+		{"gtx_bvh", test_gtx_bvh},
+		{"gtx_fused", test_gtx_fused},
+		{"gtx_matrix_batch", test_gtx_matrix_batch},
+		{"gtx_mesh_indexing", test_gtx_mesh_indexing}
+	};
+}//namespace
+
+// test-glm runs every suite, test-glm <suite>... runs the named ones
+int main(int argc, char * argv[])
+{
+	int Error = 0;
+	int Selected = 0;
+
+	for(std::size_t i = 0; i < sizeof(Suites) / sizeof(Suites[0]); ++i)
+	{
+		bool Run = argc < 2;
+		for(int a = 1; a < argc; ++a)
+			Run = Run || std::strcmp(argv[a], Suites[i].name) == 0;
+		if(!Run)
+			continue;
+
+		int const SuiteError = Suites[i].run();
+		std::printf("%s: %d error(s)\n", Suites[i].name, SuiteError);
+		Error += SuiteError;
+		++Selected;
+	}
+
+	if(Selected == 0)
+	{
+		std::printf("Unknown suite\n");
+		return 1;
+	}
+
+	// Exit codes are truncated to 8 bits
+	return Error > 0 ? 1 : 0;
+}